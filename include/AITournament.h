@@ -0,0 +1,83 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AITOURNAMENT_H
+#define AITOURNAMENT_H
+
+#include <misc/dune_clock.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+    Plays round-robin matches between AI player classes without drawing the games. Every pair of players meets on
+    every map with every seed, once on each side of the map. For every match the winner, the game length and the
+    wall-clock time each player spent thinking per game cycle are appended to a CSV file.
+
+    The tournament is described by an INI file:
+    \code
+    [Tournament]
+    Players = qBotEasy, qBotHard, SmartBot, AIPlayerMedium, CampaignAIPlayer
+    Maps = 2P - 64x64 - Sandy Spikes, 2P - 64x64 - Tough Life
+    Seeds = 3
+    Max Minutes = 120
+    Output = tournament.csv
+    \endcode
+    Maps are either paths to map files or names of maps in the multiplayer map directory.
+*/
+class AITournament final {
+public:
+    /**
+        Reads the tournament description. If the file is not a valid tournament description an exception is thrown.
+        \param  configFile  the INI file describing the tournament
+    */
+    explicit AITournament(const std::filesystem::path& configFile);
+
+    /**
+        Plays all matches of the tournament.
+        \return true if all results could be written, false otherwise
+    */
+    bool run() const;
+
+private:
+    struct PlayerResult {
+        std::string playerClass;
+        dune::dune_clock::duration thinkTime{};    ///< the time spent thinking over all game cycles
+        dune::dune_clock::duration maxThinkTime{}; ///< the longest time spent thinking in a single game cycle
+    };
+
+    struct MatchResult {
+        std::filesystem::path map;
+        int seed = 0;
+        PlayerResult players[2];
+        int winner          = -1; ///< the index into players of the winner or -1 for a draw
+        uint32_t gameCycles = 0;
+    };
+
+    MatchResult playMatch(const std::filesystem::path& mapFile, int seed, const std::string& player1,
+                          const std::string& player2) const;
+
+    std::vector<std::string> players_;       ///< the player classes taking part
+    std::vector<std::filesystem::path> maps_; ///< the map files to play on
+    int seeds_              = 1;              ///< the number of games per pairing and map
+    uint32_t maxGameCycles_ = 0;              ///< games running longer than this are stopped as a draw
+    std::filesystem::path output_;            ///< the CSV file the results are written to
+};
+
+#endif // AITOURNAMENT_H
@@ -230,6 +230,9 @@ public:
         std::string language;   ///< Language code: "en" = English, "fr" = French, "de" = German
         int scrollSpeed;        ///< Scroll speed in pixels
         bool showTutorialHints; ///< If true, tutorial hints are shown during the game
+        int autosaveInterval;   ///< Minutes between two autosaves; 0 disables autosaving
+        int autosaveSlots;      ///< Number of autosave files that are used in turn
+        bool compressSaveGames; ///< If true, savegames and replays are written compressed
     } general;
 
     class VideoClass {
@@ -245,6 +248,7 @@ public:
         bool rotateUnitGraphics;
         std::string renderer;
         std::string typeface;
+        bool fogMaskOverlay; ///< Draw unexplored and fogged tiles as one filtered overlay instead of per tile masks
     } video;
 
     class AudioClass {
@@ -31,8 +31,9 @@ inline constexpr auto AUDIO_FREQUENCY = 49716;
 inline constexpr auto DEFAULT_PORT       = 28747;
 inline constexpr auto DEFAULT_METASERVER = "http://dunelegacy.sourceforge.net/metaserver/metaserver.php";
 
-inline constexpr auto SAVEMAGIC       = 8675309;
-inline constexpr auto SAVEGAMEVERSION = 9704;
+inline constexpr auto SAVEMAGIC                    = 8675309;
+inline constexpr auto SAVEGAMEVERSION              = 9705;
+inline constexpr auto SAVEGAMEVERSION_UNCOMPRESSED = 9704; ///< the last version that is never compressed; still loadable
 
 inline constexpr auto MAX_PLAYERNAMELENGTH = 24;
 
@@ -18,33 +18,28 @@
 #ifndef DECODE_H
 #define DECODE_H
 
-/// A variant of memcpy that can handle overlapping memory areas.
-/**
-    Copies memory areas that may overlap byte by byte from small memory
-    addresses to big memory addresses. Thus, already copied bytes can be
-    copied again.
-    \param  dst destination
-    \param  src source
-    \param  cnt length in bytes
-*/
-inline void memcpy_overlap(unsigned char* dst, const unsigned char* src, unsigned cnt);
+#include <span>
 
 /// Decompresses format40 compressed images/data.
-/** Decompresses format40 compressed images/data specified by image_in to image_out.
-    \param  image_in    format80 compressed data
-    \param  image_out   pointer to output uncompressed data
+/** Decompresses format40 compressed images/data specified by image_in to image_out. Format40 data is a delta to
+    the previous frame, so image_out must already contain the previous frame. Throws std::invalid_argument if the data
+    is malformed, i.e. it ends without an end marker or it would write past the end of image_out.
+    \param  image_in    format40 compressed data
+    \param  image_out   output buffer for the uncompressed data
     \return written bytes to image_out
  */
-int decode40(const unsigned char* image_in, unsigned char* image_out);
+int decode40(std::span<const unsigned char> image_in, std::span<unsigned char> image_out);
 
 /// Decompresses format80 compressed images/data.
 /** Decompresses format80 compressed images/data specified by image_in to image_out. The checksum is also calculated and
-    compared with the parameter checksum.
+    compared with the parameter checksum. Throws std::invalid_argument if the data is malformed, i.e. it contains an
+    unknown command, ends without an end marker, refers to data before the start or after the end of image_out or it
+    would write past the end of image_out.
     \param  image_in    format80 compressed data
-    \param  image_out   pointer to output uncompressed data
+    \param  image_out   output buffer for the uncompressed data
     \param  checksum    checksum for this file
     \return 0 if checksum is correct<br> -1 if checksum is incorrect
  */
-int decode80(const unsigned char* image_in, unsigned char* image_out, unsigned checksum);
+int decode80(std::span<const unsigned char> image_in, std::span<unsigned char> image_out, unsigned checksum);
 
 #endif // DECODE_H
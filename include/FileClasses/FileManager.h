@@ -20,6 +20,7 @@
 
 #include "Pakfile.h"
 #include <misc/SDL2pp.h>
+#include <misc/string_util.h>
 
 #include <filesystem>
 #include <memory>
@@ -69,17 +70,25 @@ public:
 
     bool exists(const std::string& filename) const;
 
+    /// The MD5 checksums of all loaded PAK files, in load order
+    [[nodiscard]] std::span<const std::string> getMD5s() const noexcept { return pakMD5s_; }
+
 private:
-    using pak_directory_type = std::unordered_map<std::string, std::tuple<Pakfile*, int>>;
+    using pak_directory_type = std::unordered_map<std::string, std::tuple<Pakfile*, int>, CaseInsensitiveStringHash,
+                                                  CaseInsensitiveStringEqualTo>;
+    using pak_files_type     = std::tuple<std::vector<std::unique_ptr<Pakfile>>, std::vector<std::string>>;
+
+    explicit PakFileManager(pak_files_type&& pak_files);
 
     [[nodiscard]] static std::string md5FromFilename(std::filesystem::path filename);
 
-    [[nodiscard]] static std::vector<std::unique_ptr<Pakfile>>
-    loadPakFiles(const CaseInsensitiveFilesystemCache& cache, std::span<const std::string> files);
+    [[nodiscard]] static pak_files_type loadPakFiles(const CaseInsensitiveFilesystemCache& cache,
+                                                     std::span<const std::string> files);
 
     [[nodiscard]] pak_directory_type createPakDirectory() const;
 
     const std::vector<std::unique_ptr<Pakfile>> pakFiles_;
+    const std::vector<std::string> pakMD5s_;
     const pak_directory_type pak_directory_;
 };
 
@@ -116,6 +125,13 @@ public:
 
     [[nodiscard]] bool exists(std::filesystem::path filename) const;
 
+    /**
+        Returns the MD5 checksums of all loaded PAK files. They identify the installed game data, e.g. for
+        invalidating caches derived from it.
+        \return the MD5 checksums as hex strings, in the order the PAK files were loaded
+    */
+    [[nodiscard]] std::span<const std::string> getPakFileMD5s() const noexcept { return pak_files_.getMD5s(); }
+
 private:
     CaseInsensitiveFilesystemCache filesystem_cache_;
     PakFileManager pak_files_;
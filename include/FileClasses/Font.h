@@ -54,6 +54,24 @@ public:
         \return Number of pixels needed
     */
     [[nodiscard]] virtual int getTextHeight() const = 0;
+
+    /// Horizontal metrics of a single glyph in pixels
+    struct GlyphMetrics final {
+        int minX{};    ///< offset of the leftmost pixel of the glyph from the pen position
+        int advance{}; ///< distance from the pen position to the pen position of the next glyph
+    };
+
+    /// Returns true if this font has a glyph for the character ch
+    [[nodiscard]] virtual bool hasGlyph(char32_t ch) const = 0;
+
+    /// Returns the metrics of the glyph for the character ch
+    [[nodiscard]] virtual GlyphMetrics getGlyphMetrics(char32_t ch) const = 0;
+
+    /// Returns the kerning adjustment in pixels between the characters previous and ch
+    [[nodiscard]] virtual int getKerning(char32_t previous, char32_t ch) const = 0;
+
+    /// Renders the glyph for the character ch in white, as createTextSurface() would render a text of only ch
+    [[nodiscard]] virtual sdl2::surface_ptr createGlyphSurface(char32_t ch) const = 0;
 };
 
 #endif // FONT_H
@@ -51,6 +51,12 @@ public:
     }
     zoomable_texture getObjPic(ObjPic_enum id, HOUSETYPE house = HOUSETYPE::HOUSE_HARKONNEN) const;
 
+    /**
+        Creates the object pictures of zoom level z for all houses used so far. The textures returned by getObjPic()
+        for other zoom levels than the current one are only valid after this has been called for their zoom level.
+    */
+    void prepareObjPics(unsigned int z) const { duneTextures.prepare_object_pictures(static_cast<int>(z)); }
+
     [[nodiscard]] const DuneTexture* getSmallDetailPic(SmallDetailPics_Enum id) const;
     [[nodiscard]] const DuneTexture* getTinyPicture(TinyPicture_Enum id) const;
     [[nodiscard]] const DuneTexture*
@@ -18,10 +18,14 @@
 #ifndef PAKFILE_H
 #define PAKFILE_H
 
+#include <misc/MappedFile.h>
 #include <misc/SDL2pp.h>
+#include <misc/string_util.h>
 
 #include <filesystem>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class BasePakfile {
@@ -39,15 +43,13 @@ public:
 
     [[nodiscard]] const std::string& getFilename(unsigned int index) const;
 
+    /// Checks if a file is contained in this pak-File. The name is compared case insensitive.
     [[nodiscard]] bool exists(const std::string& filename) const;
 
+    /// Returns the index of the file with the given name (compared case insensitive) or -1 if there is no such file.
+    [[nodiscard]] int findFile(const std::string& filename) const;
+
 protected:
-    /// Internal structure used by opened SDL_RWop
-    struct RWopData {
-        const BasePakfile* curPakfile;
-        unsigned int fileIndex;
-        size_t fileOffset;
-    };
     /// Internal structure for representing one file in this PAK-File
     struct PakFileEntry final {
         uint32_t startOffset;
@@ -55,23 +57,21 @@ protected:
         std::string filename;
     };
 
-    static int64_t SizeFile(SDL_RWops* pRWop);
-    static int64_t SeekFile(SDL_RWops* pRWop, int64_t offset, int whence);
-    static size_t WriteFile(SDL_RWops* pRWop, const void* ptr, size_t size, size_t n);
-    static int CloseFile(SDL_RWops* pRWop);
-
-    void readIndex();
+    void addEntry(PakFileEntry entry);
 
-    sdl2::RWops_ptr fPakFile;
     std::filesystem::path filename_;
 
     std::vector<PakFileEntry> fileEntries;
+
+    /// Maps the file names to their index in fileEntries
+    std::unordered_map<std::string, int, CaseInsensitiveStringHash, CaseInsensitiveStringEqualTo> fileIndex_;
 };
 
 /// A class for reading PAK-Files.
 /**
     This class can be used to read PAK-Files. PAK-Files are archive files used by Dune2.
-    The files inside the PAK-File can an be read through SDL_RWops.
+    The PAK-File is memory mapped; the files inside can be accessed directly through getFileData() or
+    be read through SDL_RWops.
 */
 class Pakfile final : public BasePakfile {
 public:
@@ -81,8 +81,18 @@ public:
     sdl2::RWops_ptr openFile(const std::string& filename) const;
     sdl2::RWops_ptr openFile(int index) const;
 
+    /**
+        Returns the content of a file without copying it. The span is only valid as long as this Pakfile exists.
+        \param  index   Index in pak-File
+        \return the content of the file
+    */
+    [[nodiscard]] std::span<const uint8_t> getFileData(int index) const;
+    [[nodiscard]] std::span<const uint8_t> getFileData(const std::string& filename) const;
+
 private:
-    static size_t ReadFile(SDL_RWops* pRWop, void* ptr, size_t size, size_t n);
+    void readIndex();
+
+    dune::MappedFile file_;
 };
 
 /**
@@ -96,6 +106,8 @@ public:
     void addFile(SDL_RWops* rwop, const std::string& filename);
 
 private:
+    sdl2::RWops_ptr fPakFile;
+
     char* writeOutData{};
     int numWriteOutData{};
 };
@@ -23,7 +23,9 @@
 #include <misc/sound_util.h>
 
 #include <array>
+#include <mutex>
 #include <string>
+#include <vector>
 
 // Voice
 enum class Voice_enum {
@@ -115,7 +117,13 @@ private:
     void loadNonEnglishVoice(const std::string& languagePrefix);
     [[nodiscard]] Mix_Chunk* getNonEnglishVoice(Voice_enum id, HOUSETYPE house) const;
 
-    std::vector<sdl2::mix_chunk_ptr> lngVoice;
+    void checkVoiceFiles();
+    [[nodiscard]] Mix_Chunk* getVoiceChunk(int voice_index) const;
+
+    std::vector<std::vector<std::string>> voiceFiles_; ///< the files each voice is concatenated from
+
+    mutable std::mutex voiceMutex_;                    ///< guards the creation of the voices in getVoice()
+    mutable std::vector<sdl2::mix_chunk_ptr> lngVoice; ///< the voices, each is created when it is played first
     std::array<sdl2::mix_chunk_ptr, static_cast<int>(Sound_enum::NUM_SOUNDCHUNK)> soundChunk;
 };
 
@@ -0,0 +1,71 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SOUNDCACHE_H
+#define SOUNDCACHE_H
+
+#include <misc/MappedFile.h>
+#include <misc/sound_util.h>
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/// An on-disk cache of the VOC files converted to the format of the audio device.
+/**
+    Converting a VOC file means resampling it to the mixer frequency, which is by far the most expensive part of
+    loading the sounds. The cache stores the converted samples keyed by the MD5 checksum of the VOC file. The whole
+    cache is keyed by the frequency, sample format and channel count of the audio device, so changing any of them
+    rebuilds it. The cache file is memory mapped; new entries are written when the cache is destroyed.
+*/
+class SoundCache final {
+public:
+    SoundCache();
+    ~SoundCache();
+
+    SoundCache(const SoundCache&)            = delete;
+    SoundCache(SoundCache&&)                 = delete;
+    SoundCache& operator=(const SoundCache&) = delete;
+    SoundCache& operator=(SoundCache&&)      = delete;
+
+    /**
+        Loads a VOC file and converts it to the format of the audio device. The conversion is taken from the cache if
+        possible. This method is thread-safe.
+        \param  filename    the VOC file to load (see FileManager::openFile())
+        \return the converted sound
+    */
+    [[nodiscard]] sdl2::mix_chunk_ptr loadVOC(std::string_view filename);
+
+private:
+    void load();
+    void save();
+
+    std::string key_;
+    std::filesystem::path path_;
+
+    std::mutex mutex_;
+    std::unique_ptr<dune::MappedFile> file_;
+    std::unordered_map<std::string, std::span<const uint8_t>> entries_; ///< MD5 of the VOC file to the samples
+    std::unordered_map<std::string, std::vector<uint8_t>> added_;       ///< the samples converted in this session
+};
+
+#endif // SOUNDCACHE_H
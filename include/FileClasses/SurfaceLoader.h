@@ -29,7 +29,10 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "PictureFactory.h"
 
@@ -92,12 +95,31 @@ private:
     [[nodiscard]] sdl2::surface_ptr generateDoubledObjPic(unsigned int id, int h) const;
     [[nodiscard]] sdl2::surface_ptr generateTripledObjPic(unsigned int id, int h) const;
 
-    // 8-bit surfaces kept in main memory for processing as needed, e.g. color remapping
+    /**
+        Scales the Harkonnen object pictures to zoom level z and creates the shadow surfaces. This is only done once
+        per zoom level on the first call to getZoomedObjSurface() for that level, so zoom levels that are never shown
+        and texture atlases that come from the cache skip it entirely.
+    */
+    void generateZoomedObjPics(unsigned int z);
+
+    /// Converts the windtrap and shadow pictures to 32-bit surfaces with their transparent colors
+    [[nodiscard]] sdl2::surface_ptr createDisplayObjPic(unsigned int id, SDL_Surface* surface) const;
+
+    // 8-bit surfaces kept in main memory for processing as needed, e.g. color remapping. The remapped house
+    // pictures share the pixels of the Harkonnen picture and only have their own palette.
     std::array<std::array<std::array<sdl2::surface_ptr, NUM_ZOOMLEVEL>, NUM_HOUSES>, NUM_OBJPICS> objPic;
+    // 32-bit versions of the windtrap and shadow pictures
+    std::array<std::array<std::array<sdl2::surface_ptr, NUM_ZOOMLEVEL>, NUM_HOUSES>, NUM_OBJPICS> displayObjPic_;
+    // The object pictures loaded from the game data; all others are remapped on demand
+    std::vector<std::pair<unsigned int, int>> loadedObjPics_;
+    // objPic and displayObjPic_ may be filled in from a background thread
+    std::mutex objPicMutex_;
     std::array<std::array<sdl2::surface_ptr, NUM_HOUSES>, NUM_UIGRAPHICS> uiGraphic;
     std::array<std::array<sdl2::surface_ptr, NUM_HOUSES>, NUM_MAPCHOICEPIECES> mapChoicePieces;
     std::array<std::unique_ptr<Animation>, NUM_ANIMATION> animation{};
 
+    std::array<bool, NUM_ZOOMLEVEL> zoomedObjPicsGenerated_{};
+
     std::array<sdl2::surface_ptr, NUM_SMALLDETAILPICS> smallDetailPic;
     std::array<sdl2::surface_ptr, NUM_TINYPICTURE> tinyPicture;
 
@@ -53,6 +53,14 @@ public:
     */
     [[nodiscard]] int getTextHeight() const override { return characterHeight; }
 
+    [[nodiscard]] bool hasGlyph(char32_t ch) const override;
+
+    [[nodiscard]] GlyphMetrics getGlyphMetrics(char32_t ch) const override;
+
+    [[nodiscard]] int getKerning(char32_t previous, char32_t ch) const override;
+
+    [[nodiscard]] sdl2::surface_ptr createGlyphSurface(char32_t ch) const override;
+
 private:
     font_ptr pTTFFont;
     int characterHeight;
@@ -24,6 +24,8 @@
 #include <cstdint>
 #include <initializer_list>
 #include <memory>
+#include <span>
+#include <vector>
 
 /// A class for loading a *.WSA-File.
 /**
@@ -79,7 +81,7 @@ public:
     [[nodiscard]] bool isAnimationLooped() const noexcept { return looped; }
 
 private:
-    void decodeFrames(const unsigned char* pFiledata, uint32_t* index, int numberOfFrames,
+    void decodeFrames(std::span<const unsigned char> filedata, const uint32_t* index, int numberOfFrames,
                       unsigned char* pDecodedFrames, int x, int y) const;
     std::unique_ptr<unsigned char[]> readfile(SDL_RWops* rwop, int* filesize) const;
     void readdata(const std::initializer_list<SDL_RWops*>& rwops);
@@ -19,6 +19,7 @@
 #define DIRECTORYPLAYER_H
 
 #include <FileClasses/music/MusicPlayer.h>
+#include <FileClasses/music/MusicPrefetcher.h>
 
 #include <SDL2/SDL_mixer.h>
 #include <filesystem>
@@ -35,6 +36,11 @@ public:
     */
     void changeMusic(MUSICTYPE musicType) override;
 
+    /*!
+        Starts the requested music once it has been loaded in the background
+    */
+    void update() override;
+
     /*!
         Toggle the music on and off
     */
@@ -46,6 +52,12 @@ public:
     */
     bool isMusicPlaying() override;
 
+    /**
+        Returns whether the requested music is still being loaded
+        \return true = loading, false = nothing to wait for
+    */
+    bool isMusicPending() override;
+
     /*!
         turns music playing on or off
         @param value when true the function turns music on
@@ -69,9 +81,24 @@ private:
     */
     std::vector<std::filesystem::path> getMusicFileNames(const std::filesystem::path& dir);
 
+    /*!
+        Starts loading a random file of the given music type unless there already is one
+        @param musicType type of music to prefetch
+        @return true if there is a track for musicType, false otherwise
+    */
+    bool prefetch(MUSICTYPE musicType);
+
+    /*!
+        Prefetches the tracks that are most likely requested after the current one
+    */
+    void prefetchNext();
+
     std::array<std::vector<std::filesystem::path>, MUSIC_NUM_MUSIC_TYPES> musicFileList;
 
-    Mix_Music* music;
+    sdl2::mix_music_ptr music;
+
+    MusicPrefetcher prefetcher_;
+    bool pending_ = false; ///< waiting for the track of currentMusicType to be loaded
 };
 
 #endif // DIRECTORYPLAYER_H
@@ -75,13 +75,20 @@ public:
         other song being played
     */
     void musicCheck() {
+        update();
+
         if (musicOn) {
-            if (!isMusicPlaying()) {
+            if (!isMusicPlaying() && !isMusicPending()) {
                 changeMusic(MUSIC_PEACE);
             }
         }
     }
 
+    /*!
+        Starts music that has finished loading in the background. Called once per frame by the main loops.
+    */
+    virtual void update() { }
+
     /*!
         Toggle the music on and off
     */
@@ -99,6 +106,12 @@ public:
     */
     virtual bool isMusicPlaying() = 0;
 
+    /**
+        Returns whether the requested music is still being loaded
+        \return true = loading, false = nothing to wait for
+    */
+    virtual bool isMusicPending() { return false; }
+
     /**
         Returns whether music is on or off
         \return true = on, false = off
@@ -0,0 +1,86 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSICPREFETCHER_H
+#define MUSICPREFETCHER_H
+
+#include <FileClasses/music/MusicPlayer.h>
+
+#include <misc/SDL2pp.h>
+#include <misc/ThreadPool.h>
+
+#include <functional>
+#include <future>
+#include <map>
+#include <optional>
+#include <string>
+
+/**
+    Loads music tracks on a worker thread so that the main loop never waits for music files to be parsed or
+    converted. There is at most one track per music type; a music player prefetches the track it will most likely
+    need next (e.g. the attack music while the peace music is playing) and takes it once it has finished loading.
+*/
+class MusicPrefetcher final {
+public:
+    using loader_type = std::function<sdl2::mix_music_ptr()>;
+
+    struct Track {
+        std::string name;          ///< the name of the track for logging
+        sdl2::mix_music_ptr music; ///< the loaded music or nullptr if loading failed
+    };
+
+    MusicPrefetcher();
+    ~MusicPrefetcher();
+
+    MusicPrefetcher(const MusicPrefetcher&)            = delete;
+    MusicPrefetcher(MusicPrefetcher&&)                 = delete;
+    MusicPrefetcher& operator=(const MusicPrefetcher&) = delete;
+    MusicPrefetcher& operator=(MusicPrefetcher&&)      = delete;
+
+    /**
+        Starts loading a track for musicType unless there already is one.
+        \param  musicType   the music type the track is for
+        \param  name        the name of the track
+        \param  loader      loads the track; it is called on the worker thread
+    */
+    void prefetch(MUSICTYPE musicType, std::string name, loader_type loader);
+
+    /// Returns whether a track for musicType has been loaded or is still being loaded
+    [[nodiscard]] bool contains(MUSICTYPE musicType) const;
+
+    /**
+        Takes the track for musicType if it has finished loading.
+        \param  musicType   the music type to take the track for
+        \return the track or std::nullopt if there is none or it is still being loaded
+    */
+    std::optional<Track> take(MUSICTYPE musicType);
+
+    /// Waits for all pending loads and frees every track. Must be called before Mix_Quit().
+    void clear();
+
+private:
+    struct Entry {
+        std::string name;
+        std::future<sdl2::mix_music_ptr> music;
+    };
+
+    std::map<MUSICTYPE, Entry> entries_;
+
+    dune::ThreadPool pool_{1};
+};
+
+#endif // MUSICPREFETCHER_H
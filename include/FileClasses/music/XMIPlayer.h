@@ -19,9 +19,12 @@
 #define XMIPLAYER_H
 
 #include <FileClasses/music/MusicPlayer.h>
+#include <FileClasses/music/MusicPrefetcher.h>
 
 #include <SDL2/SDL_mixer.h>
 
+#include <string>
+
 class XMIPlayer final : public MusicPlayer {
 public:
     XMIPlayer();
@@ -33,6 +36,11 @@ public:
     */
     void changeMusic(MUSICTYPE musicType) override;
 
+    /*!
+        Starts the requested music once it has been converted in the background
+    */
+    void update() override;
+
     /*!
         Toggle the music on and off
     */
@@ -44,6 +52,12 @@ public:
     */
     bool isMusicPlaying() override;
 
+    /**
+        Returns whether the requested music is still being converted
+        \return true = converting, false = nothing to wait for
+    */
+    bool isMusicPending() override;
+
     /*!
         turns music playing on or off
         @param value when true the function turns music on
@@ -60,7 +74,34 @@ public:
     }
 
 private:
+    struct Track {
+        std::string filename; ///< the XMI file
+        int musicNum = -1;    ///< the number of the track inside the XMI file
+    };
+
+    /*!
+        Chooses a (random) track for the given music type
+        @param musicType type of music to choose a track for
+        @return the chosen track
+    */
+    Track chooseTrack(MUSICTYPE musicType);
+
+    /*!
+        Starts converting a track for the given music type unless there already is one
+        @param musicType type of music to prefetch
+        @return true if there is a track for musicType, false otherwise
+    */
+    bool prefetch(MUSICTYPE musicType);
+
+    /*!
+        Prefetches the tracks that are most likely requested after the current one
+    */
+    void prefetchNext();
+
     sdl2::mix_music_ptr music;
+
+    MusicPrefetcher prefetcher_;
+    bool pending_ = false; ///< waiting for the track of currentMusicType to be converted
 };
 
 #endif // XMIPLAYER_H
@@ -0,0 +1,75 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FOGMASK_H
+#define FOGMASK_H
+
+#include <misc/SDL2pp.h>
+
+#include <cstdint>
+#include <vector>
+
+class Game;
+class Map;
+
+/// Draws the unexplored and fogged tiles of one team as a single scaled overlay
+/**
+    The mask is a streaming texture with one texel per map tile. Only texels whose state changed since the last
+    frame are uploaded. Renderers that support it filter the mask linearly, which softens the borders of unexplored
+    areas; the software renderer uses nearest neighbour scaling and thus draws hard tile edges.
+*/
+class FogMask final {
+public:
+    FogMask(SDL_Renderer* renderer, int mapSizeX, int mapSizeY);
+    ~FogMask();
+
+    FogMask(const FogMask&)            = delete;
+    FogMask(FogMask&&)                 = delete;
+    FogMask& operator=(const FogMask&) = delete;
+    FogMask& operator=(FogMask&&)      = delete;
+
+    /**
+        Updates the texels of the tiles from (x1,y1) to (x2,y2) (exclusive) and draws them.
+        \param  renderer    the renderer to draw to
+        \param  game        the game the map belongs to
+        \param  map         the map to draw the mask for
+        \param  teamID      the team whose view is drawn
+        \param  fogOfWar    draw the fog of war in addition to the unexplored tiles?
+        \param  x1, y1      the top left tile to draw
+        \param  x2, y2      one after the bottom right tile to draw
+        \param  dest        the screen rectangle covered by the tiles from (x1,y1) to (x2,y2)
+    */
+    void draw(SDL_Renderer* renderer, const Game* game, const Map* map, int teamID, bool fogOfWar, int x1, int y1,
+              int x2, int y2, const SDL_FRect& dest);
+
+private:
+    void update(const Game* game, const Map* map, int teamID, bool fogOfWar, int x1, int y1, int x2, int y2);
+
+    static constexpr uint8_t unexploredAlpha = 255; ///< alpha of a tile that has never been seen
+    static constexpr uint8_t foggedAlpha     = 128; ///< alpha of a tile that is currently not seen
+
+    int sizeX_;
+    int sizeY_;
+
+    int teamID_    = -1;    ///< the team the texels were computed for
+    bool fogOfWar_ = false; ///< fog of war setting the texels were computed for
+
+    std::vector<uint32_t> pixels_; ///< copy of the texture content, sizeX_ * sizeY_ texels in SCREEN_FORMAT
+    sdl2::texture_ptr texture_;    ///< the streaming mask texture
+};
+
+#endif // FOGMASK_H
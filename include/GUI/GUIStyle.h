@@ -371,6 +371,28 @@ public:
     virtual DuneTextureOwned createMultilineText(SDL_Renderer* renderer, std::string_view text, uint32_t color,
                                                  unsigned int fontSize, bool bCentered = false) const = 0;
 
+    /**
+        Get the size of a single line of text as drawText() draws it. This is also the size of the texture
+        createText() would create for it.
+        \param  text        the text to get the size from
+        \param  fontSize    the size of the font to use
+        \return the size of the text
+    */
+    virtual SDL_FPoint getTextSize(std::string_view text, unsigned int fontSize) const = 0;
+
+    /**
+        Draws a single line of text without creating a texture for it. Use this instead of createText() for text that
+        changes often or is only drawn for a short time, e.g. counters, timers and tickers.
+        \param  renderer    the renderer to draw with
+        \param  text        the text to draw
+        \param  color       the color of the text
+        \param  fontSize    the size of the font to use
+        \param  x           the x coordinate of the left side of the text
+        \param  y           the y coordinate of the top of the text
+    */
+    virtual void drawText(SDL_Renderer* renderer, std::string_view text, uint32_t color, unsigned int fontSize, float x,
+                          float y) const = 0;
+
     /**
 
     */
@@ -21,6 +21,10 @@
 #include "Renderer/DuneSurface.h"
 #include <GUI/GUIStyle.h>
 
+#include <memory>
+#include <unordered_map>
+
+class DuneGlyphAtlas;
 class FontManager;
 
 class DuneStyle final : public GUIStyle {
@@ -280,6 +284,11 @@ public:
     [[nodiscard]] DuneTextureOwned createMultilineText(SDL_Renderer* renderer, std::string_view text, uint32_t color,
                                                        unsigned fontSize, bool bCentered) const override;
 
+    [[nodiscard]] SDL_FPoint getTextSize(std::string_view text, unsigned int fontSize) const override;
+
+    void drawText(SDL_Renderer* renderer, std::string_view text, uint32_t color, unsigned int fontSize, float x,
+                  float y) const override;
+
 public:
     static constexpr Uint32 defaultForegroundColor = COLOR_RGB(125, 0, 0);
     static constexpr Uint32 defaultShadowColor     = COLOR_LIGHTYELLOW;
@@ -334,7 +343,12 @@ private:
     uint32_t scaledFontSize(uint32_t font_size) const;
     int getPhysicalTextHeight(unsigned FontNum) const;
 
+    /// Returns the glyph atlas for the font with the given (unscaled) size
+    DuneGlyphAtlas& getGlyphAtlas(unsigned int fontSize) const;
+
     FontManager* fontManager_{};
+
+    mutable std::unordered_map<uint32_t, std::unique_ptr<DuneGlyphAtlas>> glyphAtlases_;
 };
 
 #endif // DUNESTYLEBASE_H
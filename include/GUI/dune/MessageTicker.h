@@ -18,7 +18,6 @@
 #ifndef MESSAGETICKER_H
 #define MESSAGETICKER_H
 
-#include "Renderer/DuneTexture.h"
 #include <GUI/Widget.h>
 #include <misc/SDL2pp.h>
 
@@ -40,8 +39,6 @@ public:
     */
     void draw(Point position) override;
 
-    void invalidateTextures() override;
-
     /**
         Returns the minimum size of this widget. The widget should not
         be resized to a size smaller than this.
@@ -50,7 +47,6 @@ public:
     [[nodiscard]] Point getMinimumSize() const override { return {0, 0}; }
 
 private:
-    DuneTextureOwned texture_;
     std::queue<std::string> messages;
     int timer;
 };
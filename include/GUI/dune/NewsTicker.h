@@ -74,8 +74,6 @@ private:
 
     const DuneTexture* pBackground;
     unique_queue<std::string> messages;
-    std::string currentMessage;
-    DuneTextureOwned pCurrentMessageTexture;
     int timer;
 };
 
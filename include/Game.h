@@ -38,6 +38,7 @@
 
 #include <array>
 #include <filesystem>
+#include <future>
 #include <unordered_set>
 #include <utility>
 
@@ -49,6 +50,11 @@ class WaitingForOtherPlayers;
 class ObjectManager;
 class House;
 class Explosion;
+class FogMask;
+
+namespace dune {
+class ThreadPool;
+}
 
 inline constexpr auto END_WAIT_TIME = dune::as_dune_clock_duration(6 * 1000);
 
@@ -98,6 +104,12 @@ private:
     */
     void processObjects();
 
+    /**
+        Lets the players of all houses think in parallel. The actions that may affect other houses are applied later
+        by House::update() in house order, so the outcome does not depend on the number of threads.
+    */
+    void thinkPlayers();
+
     /**
         This method draws a complete frame.
     */
@@ -215,10 +227,10 @@ private:
 
     /**
         This method loads a previously saved game.
-        \param stream the stream to load from
+        \param source the stream to load from; the savegame may be compressed
         \return true on success, false on failure
     */
-    bool loadSaveGame(InputStream& stream);
+    bool loadSaveGame(InputStream& source);
 
 public:
     /**
@@ -228,14 +240,33 @@ public:
     */
     bool saveGame(const std::filesystem::path& filename);
 
+    /**
+        This method saves the current running game.
+        \param stream the stream to save to
+    */
+    void saveGame(OutputStream& stream);
+
     /**
         This method starts the game. Will return when the game is finished or aborted.
     */
     void runMainLoop(const GameContext& context, MenuBase::event_handler_type handler);
 
+    /**
+        This method runs the game as fast as possible without drawing it or processing any input. Will return when
+        the game is finished or maxGameCycles game cycles have been played. No replay is recorded.
+        \param context         the game context
+        \param maxGameCycles   the number of game cycles after which the game is stopped unfinished
+    */
+    void runWithoutDrawing(const GameContext& context, uint32_t maxGameCycles);
+
     void quitGame() { bQuitGame_ = true; }
 
 private:
+    /**
+        This method sets up the interface and the end level conditions before the first game cycle is run.
+    */
+    void startRunning(const GameContext& context);
+
     /**
         This method pauses the current game.
     */
@@ -389,6 +420,12 @@ public:
     */
     [[nodiscard]] bool isGameFinished() const noexcept { return finished_; }
 
+    /**
+        This method returns whether the finished game was won by the team of the local house
+        \return true, if won, false if lost or not finished yet
+    */
+    [[nodiscard]] bool isGameWon() const noexcept { return won_; }
+
     /**
         Are cheats enabled?
         \return true = cheats enabled, false = cheats disabled
@@ -475,6 +512,11 @@ private:
     */
     void saveScreenshot();
 
+    /**
+        Serializes the game into memory and writes it to the next autosave slot on a background thread
+    */
+    void autoSave();
+
     /**
         Checks whether the cursor is on the radar view
         \param  mouseX  x-coordinate of cursor
@@ -614,6 +656,18 @@ private:
     float averageRenderTime_ = 10.0f; ///< The weighted average of the render time
     float averageUpdateTime_ = 10.0f; ///< The weighted average of the update time
 
+    /// Frame time split shown by the profiler overlay (weighted averages in milliseconds per frame)
+    struct FrameProfile final {
+        float drawScreen     = 0.0f; ///< time spent in drawScreen()
+        float renderPresent  = 0.0f; ///< time spent in Dune_RenderPresent()
+        float serviceNetwork = 0.0f; ///< time spent in serviceNetwork()
+        float updateGame     = 0.0f; ///< time spent in all updateGame() calls of a frame
+        int updateSteps      = 0;    ///< number of game cycles simulated in the last frame
+        int cappedFrames     = 0;    ///< number of frames where the 75ms catch-up cap stopped the simulation
+    };
+
+    FrameProfile frameProfile_;
+
     dune::dune_clock::time_point
         lastTargetGameCycleTime_{}; //< Remember the last time the target gameCycleCount was updated
 
@@ -624,6 +678,12 @@ private:
     bool takePeriodicScreenshots_ = false; ///< take a screenshot every 10 seconds
     bool pendingScreenshot_       = false;
 
+    uint32_t autosaveCount_  = 0;                  ///< number of autosaves so far; selects the next slot
+    size_t lastAutosaveSize_ = 0;                  ///< size of the last autosave; reserved for the next one
+    std::future<bool> pendingAutosave_;            ///< the autosave that is currently written to disk
+    std::unique_ptr<dune::ThreadPool> autosaveIO_; ///< writes the autosaves to disk
+    std::unique_ptr<dune::ThreadPool> thinkPool_;  ///< runs the think phase of the players
+
     SDL_FRect powerIndicatorPos_{14, 146, 4, 0}; ///< position of the power indicator in the right game bar
     SDL_FRect spiceIndicatorPos_{20, 146, 4, 0}; ///< position of the spice indicator in the right game bar
     SDL_FRect topBarPos_{};                      ///< position of the top game bar
@@ -654,6 +714,8 @@ private:
 
     bool bShowFPS_ = false; ///< Show the FPS
 
+    bool bShowProfiler_ = false; ///< Show the frame time profiler overlay
+
     bool bShowTime_ = false; ///< Show how long this game is running
 
     bool bCheatsEnabled_ = false; ///< Cheat codes are enabled?
@@ -680,6 +742,8 @@ private:
         selectedByOtherPlayerList_; ///< This is only used in multiplayer games where two players control one house
     std::vector<std::unique_ptr<Explosion>> explosionList_; ///< A list containing all the explosions that must be drawn
 
+    std::unique_ptr<FogMask> fogMask_; ///< The overlay for unexplored and fogged tiles if Video/FogMaskOverlay is set
+
     std::string localPlayerName_; ///< the name of the local player
     std::unordered_multimap<std::string, Player*>
         playerName2Player_;                                ///< mapping player names to players (one entry per player)
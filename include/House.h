@@ -22,19 +22,31 @@
 #include <AITeamInfo.h>
 #include <Choam.h>
 #include <DataTypes.h>
+#include <HouseInfluence.h>
 #include <data.h>
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
+#include <misc/RobustList.h>
 
+#include <array>
 #include <memory>
 
 // forward declarations
 class UnitBase;
 class StructureBase;
+class BuilderBase;
 class ObjectBase;
 class Player;
 class HumanPlayer;
 
+/// A sandworm that came close to a harvester
+struct SandwormContact {
+    const UnitBase* pSandworm;  ///< the sandworm (owned by any house)
+    const UnitBase* pHarvester; ///< the harvester of the house that keeps this contact
+
+    bool operator==(const SandwormContact&) const = default;
+};
+
 class House final {
     House(const GameContext& context);
 
@@ -80,6 +92,53 @@ public:
         return (isStructure(itemID) || isUnit(itemID)) ? numItem_[itemID] : 0;
     }
 
+    /// The units currently owned by this house (including deviated units of other houses)
+    [[nodiscard]] const RobustList<UnitBase*>& getUnitList() const noexcept { return unitList_; }
+    /// The structures currently owned by this house
+    [[nodiscard]] const RobustList<StructureBase*>& getStructureList() const noexcept { return structureList_; }
+    /// The units or structures of type itemID currently owned by this house
+    [[nodiscard]] const RobustList<ObjectBase*>& getItemList(ItemID_enum itemID) const {
+        return itemLists_.at(itemID);
+    }
+
+    /**
+        Adds pUnit to the lists of objects owned by this house. Must be called whenever a unit is created for or
+        changes over to this house. The lists keep the order of the global unit list.
+        \param  pUnit   the unit that is now owned by this house
+    */
+    void addToUnitList(UnitBase* pUnit);
+
+    /**
+        Removes pUnit from the lists of objects owned by this house. Must be called whenever a unit owned by this
+        house is removed or changes over to another house.
+        \param  pUnit   the unit that is no longer owned by this house
+    */
+    void removeFromUnitList(UnitBase* pUnit);
+
+    void addToStructureList(StructureBase* pStructure);
+    void removeFromStructureList(StructureBase* pStructure);
+
+    /// The running position sums of the units and structures owned by this house
+    [[nodiscard]] const HouseInfluence& getInfluence() const noexcept { return influence_; }
+
+    /**
+        The sandworms that are currently close to a harvester of this house. The list is kept up to date while
+        sandworms and harvesters move, so it never needs to be searched for by comparing every sandworm with every
+        harvester. The contacts are ordered by the object IDs of the sandworm and then of the harvester, so a loaded
+        game visits them in the same order as a game that kept running.
+    */
+    [[nodiscard]] const std::vector<SandwormContact>& getSandwormContacts() const noexcept {
+        return sandwormContacts_;
+    }
+
+    /**
+        An object owned by this house moved from one tile to another.
+        \param  pObject the object that moved (its location is still the old one)
+        \param  from    the old location (may be invalid)
+        \param  to      the new location (may be invalid)
+    */
+    void informHasMoved(const ObjectBase* pObject, const Coord& from, const Coord& to);
+
     [[nodiscard]] int getCapacity() const noexcept { return capacity_; }
 
     [[nodiscard]] int getProducedPower() const noexcept { return producedPower_; }
@@ -149,7 +208,11 @@ public:
 
     void printStat() const;
 
-    void updateBuildLists();
+    /**
+        Lets the players of this house decide what to do (see Player::think()). This may run in parallel with the
+        other houses but not with anything else.
+    */
+    void think();
 
     void update();
 
@@ -205,6 +268,13 @@ public:
 protected:
     void decrementHarvesters();
 
+    void updateSandwormContacts(const UnitBase* pUnit, const Coord& location);
+    void updateSandwormContact(const UnitBase* pSandworm, const Coord& sandwormLocation, const UnitBase* pHarvester,
+                               const Coord& harvesterLocation);
+    void removeSandwormContacts(const UnitBase* pUnit);
+
+    void updateBuildListsDependingOn(ItemID_enum structureID);
+
     std::vector<std::unique_ptr<Player>> players_; ///< List of associated players that control this house
 
     bool ai_{}; ///< Is this an ai player?
@@ -237,6 +307,13 @@ protected:
 
     std::vector<AITeamInfo> aiteams_; ///< the ai teams that were loaded from the map
 
+    RobustList<UnitBase*> unitList_;                            ///< the units owned by this house
+    RobustList<StructureBase*> structureList_;                  ///< the structures owned by this house
+    RobustList<BuilderBase*> builderList_;                      ///< the builders among the owned structures
+    std::array<RobustList<ObjectBase*>, Num_ItemID> itemLists_; ///< the owned units and structures by item type
+    HouseInfluence influence_;                                  ///< position sums of the owned units and structures
+    std::vector<SandwormContact> sandwormContacts_;             ///< the sandworms close to our harvesters
+
     int powerUsageTimer_{}; ///< every N ticks you have to pay for your power usage
 
     bool bHadContactWithEnemy_{}; ///< did this house already have contact with an enemy (= tiles with enemy units were
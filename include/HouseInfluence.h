@@ -0,0 +1,74 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOUSEINFLUENCE_H
+#define HOUSEINFLUENCE_H
+
+#include <DataTypes.h>
+#include <data.h>
+
+/**
+    Running sums over the positions of the objects a house owns. The house keeps them up to date as its objects are
+    created, change owner, move and are removed, so the AI can get the centre of a base or of a squad without walking
+    over all units and structures in the game.
+*/
+class HouseInfluence final {
+public:
+    struct Centroid {
+        int count = 0; ///< number of objects
+        int sumX  = 0; ///< sum of the x tile coordinates of these objects
+        int sumY  = 0; ///< sum of the y tile coordinates of these objects
+
+        /// The average position of the objects or Coord::Invalid() if there are none
+        [[nodiscard]] Coord getCentre() const noexcept {
+            return count > 0 ? Coord(sumX / count, sumY / count) : Coord::Invalid();
+        }
+
+        Centroid& operator+=(const Centroid& other) noexcept {
+            count += other.count;
+            sumX += other.sumX;
+            sumY += other.sumY;
+            return *this;
+        }
+    };
+
+    void add(ItemID_enum itemID, const Coord& location) { update(itemID, location, 1); }
+    void remove(ItemID_enum itemID, const Coord& location) { update(itemID, location, -1); }
+    void move(ItemID_enum itemID, const Coord& from, const Coord& to) {
+        update(itemID, from, -1);
+        update(itemID, to, 1);
+    }
+
+    /// All structures
+    [[nodiscard]] const Centroid& getStructures() const noexcept { return structures_; }
+    /// Structures that are bigger than one tile (no walls and turrets)
+    [[nodiscard]] const Centroid& getBaseStructures() const noexcept { return baseStructures_; }
+    /// Fighting units except troopers (no harvesters, MCVs, carryalls, frigates, saboteurs and sandworms)
+    [[nodiscard]] const Centroid& getSquad() const noexcept { return squad_; }
+    /// Troopers
+    [[nodiscard]] const Centroid& getTroopers() const noexcept { return troopers_; }
+
+private:
+    void update(ItemID_enum itemID, const Coord& location, int weight) noexcept;
+
+    Centroid structures_;
+    Centroid baseStructures_;
+    Centroid squad_;
+    Centroid troopers_;
+};
+
+#endif // HOUSEINFLUENCE_H
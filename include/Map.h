@@ -50,6 +50,13 @@ public:
     static Coord getMapPos(ANGLETYPE angle, const Coord& source);
     void removeObjectFromMap(uint32_t objectID);
     void spiceRemoved(const GameContext& context, const Coord& coord);
+
+    /**
+        Updates the spice index after a tile got spice or had all its spice removed.
+        \param location    the location of the tile
+        \param hasSpice    true if the tile has spice now, false if it has none left
+    */
+    void informSpiceChanged(const Coord& location, bool hasSpice);
     void selectObjects(const House* pHouse, int x1, int y1, int x2, int y2, int realX, int realY, bool objectARGMode);
 
     void viewMap(HOUSETYPE houseID, const Coord& location, int maxViewRange);
@@ -57,7 +64,8 @@ public:
         viewMap(houseID, Coord(x, y), maxViewRange);
     }
 
-    bool findSpice(Coord& destination, const Coord& origin);
+    bool findSpice(Coord& destination, const Coord& origin, Random& randomGen) const;
+    bool findSpice(Coord& destination, const Coord& origin) { return findSpice(destination, origin, random_); }
     bool okayToPlaceStructure(int x, int y, int buildingSizeX, int buildingSizeY, bool tilesRequired,
                               const House* pHouse, bool bIgnoreUnits = false) const;
     [[nodiscard]] bool
@@ -249,6 +257,9 @@ protected:
     public:
         BoxOffsets(int size, Coord box = Coord(1, 1));
         std::vector<std::pair<int, int>>& search_set(size_t depth) { return box_sets_[depth - 1]; }
+        [[nodiscard]] const std::vector<std::pair<int, int>>& search_set(size_t depth) const {
+            return box_sets_[depth - 1];
+        }
 
         [[nodiscard]] size_t max_depth() const noexcept { return box_sets_.size(); }
     };
@@ -607,6 +618,23 @@ private:
     std::unique_ptr<BoxOffsets> offsets_3x3_;
 
     void init_box_sets();
+
+    static constexpr int SPICE_CELL_SIZE = 8; ///< the width and height in tiles of the cells of the spice index
+
+    int spiceCellsX_ = 0;              ///< number of spice index cells in x direction
+    int spiceCellsY_ = 0;              ///< number of spice index cells in y direction
+    std::vector<uint16_t> spiceCells_; ///< the number of tiles with spice in each cell of the spice index
+    int numSpiceTiles_ = 0;            ///< the number of tiles with spice on the whole map
+
+    void init_spice_index();
+
+    [[nodiscard]] int spice_cell_index(int cellX, int cellY) const noexcept { return cellX * spiceCellsY_ + cellY; }
+
+    /// \return the box edge depth around (x, y) before which no tile has spice
+    [[nodiscard]] int spice_search_depth(int x, int y) const;
+
+    /// \return false if none of the tiles between (x1, y1) and (x2, y2) (inclusive) has spice
+    [[nodiscard]] bool may_have_spice(int x1, int y1, int x2, int y2) const;
 };
 
 #endif // MAP_H
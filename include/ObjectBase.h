@@ -273,11 +273,6 @@ public:
         return owner_;
     }
 
-    void setOwner(House* no) noexcept {
-        assert(no);
-        owner_ = no;
-    }
-
     static std::unique_ptr<ObjectBase>
     createObject(ItemID_enum itemID, uint32_t objectID, const ObjectInitializer& initializer);
     static std::unique_ptr<ObjectBase>
@@ -286,6 +281,13 @@ public:
 protected:
     bool targetInWeaponRange() const;
 
+    /**
+        Sets location_ to newLocation and tells the owner about the move. All changes of location_ after the object
+        was constructed have to go through here.
+        \param  newLocation the new location in tile coordinates (may be invalid)
+    */
+    void updateLocation(const Coord& newLocation);
+
     // constant for all objects of the same type
     const ObjectBaseConstants& constants_;
 
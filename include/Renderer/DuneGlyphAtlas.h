@@ -0,0 +1,109 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DUNEGLYPHATLAS_H
+#define DUNEGLYPHATLAS_H
+
+#include "DuneTexture.h"
+#include "misc/SDL2pp.h"
+
+#include <FileClasses/Font.h>
+#include <misc/string_util.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/// A texture with the glyphs of one font, used to draw single lines of text without rendering them to a surface first
+/**
+    Every glyph is rendered in white the first time it is used and packed into the rows of one texture. A text is then
+    drawn as one quad per glyph, tinted with the color and alpha modulation of the texture. As all quads of all texts
+    of a font come from the same texture, SDL can batch them into a single draw call. The glyph positions of recently
+    drawn texts are cached, so drawing a counter or a timer every frame neither renders nor measures it again.
+*/
+class DuneGlyphAtlas final {
+public:
+    explicit DuneGlyphAtlas(const Font* font);
+    ~DuneGlyphAtlas();
+
+    DuneGlyphAtlas(const DuneGlyphAtlas&)            = delete;
+    DuneGlyphAtlas(DuneGlyphAtlas&&)                 = delete;
+    DuneGlyphAtlas& operator=(const DuneGlyphAtlas&) = delete;
+    DuneGlyphAtlas& operator=(DuneGlyphAtlas&&)      = delete;
+
+    /**
+        Returns the size of a single line of text in pixels. This is the size of the surface Font::createTextSurface()
+        would create for it.
+        \param  text    the text to measure
+        \return the size of the text
+    */
+    [[nodiscard]] SDL_Point getTextSize(std::string_view text);
+
+    /**
+        Draws a single line of text. Texts with characters that the font has no glyph for, or that do not fit into
+        the atlas anymore, are not drawn.
+        \param  renderer    the renderer to draw with
+        \param  text        the text to draw
+        \param  color       the color of the text
+        \param  x           the x coordinate of the left side of the text
+        \param  y           the y coordinate of the top of the text
+        \param  scale       the number of pixels per unit of x and y
+        \return true if the text was drawn, false if it has to be rendered with Font::createTextSurface() instead
+    */
+    bool draw(SDL_Renderer* renderer, std::string_view text, uint32_t color, float x, float y, float scale);
+
+private:
+    struct Glyph final {
+        DuneTextureRect source; ///< the location of the glyph in the atlas, empty if it has no pixels
+        Font::GlyphMetrics metrics;
+    };
+
+    struct Quad final {
+        DuneTextureRect source;
+        int x{};
+    };
+
+    struct Layout final {
+        std::vector<Quad> quads;
+        SDL_Point size{};
+        bool complete{}; ///< false if a glyph is missing
+    };
+
+    const Layout& getLayout(std::string_view text);
+    const Glyph* getGlyph(char32_t ch);
+    std::optional<Glyph> addGlyph(char32_t ch);
+    bool grow();
+    bool updateTexture(SDL_Renderer* renderer);
+
+    const Font* const font_;
+
+    sdl2::surface_ptr surface_; ///< the glyphs as they are uploaded to texture_
+    sdl2::texture_ptr texture_;
+    SDL_Renderer* texture_renderer_{};
+    bool dirty_{};
+
+    int pen_x_{};
+    int pen_y_{};
+    int row_height_{};
+
+    std::unordered_map<char32_t, std::optional<Glyph>> glyphs_;
+    std::unordered_map<std::string, Layout, StringHash, std::equal_to<>> layouts_;
+};
+
+#endif // DUNEGLYPHATLAS_H
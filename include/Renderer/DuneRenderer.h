@@ -13,26 +13,47 @@ struct DuneTexture;
 
 #if _DEBUG
 #    include <map>
+#endif // _DEBUG
+
+/// Copy and texture switch counts of the most recently presented frame. These are available in release builds.
+struct DuneRenderStats final {
+    int copies{};
+    int texture_changes{};
+};
 
 namespace DuneRendererImplementation {
 extern SDL_Texture* render_texture;
 extern int render_texture_changes;
 extern int render_copies;
+extern DuneRenderStats render_last_frame;
+
+#if _DEBUG
 extern int render_presents;
 extern bool render_dump;
 extern std::map<SDL_Texture*, int> render_textures;
+#endif // _DEBUG
 
-void countRenderCopy(SDL_Texture* texture);
-} // namespace DuneRendererImplementation
+inline void countRenderCopy(SDL_Texture* texture) {
+    if (render_texture != texture) {
+        render_texture = texture;
+        ++render_texture_changes;
+    }
+    ++render_copies;
 
-void Dune_RenderDump();
-#else // DEBUG
-namespace DuneRendererImplementation {
-inline void countRenderCopy(SDL_Texture* texture) { }
+#if _DEBUG
+    ++render_textures[texture];
+#endif // _DEBUG
+}
 } // namespace DuneRendererImplementation
 
+#if _DEBUG
+void Dune_RenderDump();
 #endif // _DEBUG
 
+inline const DuneRenderStats& Dune_GetRenderStats() {
+    return DuneRendererImplementation::render_last_frame;
+}
+
 inline int
 Dune_RenderCopyEx(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* srcrect, const SDL_Rect* dstrect,
                   const double angle, const SDL_Point* center, const SDL_RendererFlip flip) {
@@ -79,19 +100,21 @@ Dune_RenderCopyF(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* s
 }
 
 inline void Dune_RenderPresent(SDL_Renderer* renderer) {
-#if _DEBUG
     using namespace DuneRendererImplementation;
 
+#if _DEBUG
     if (render_dump)
         Dune_RenderDump();
 
     render_textures.clear();
-    render_copies = 0;
     ++render_presents;
+#endif // _DEBUG
+
+    render_last_frame      = {render_copies, render_texture_changes};
+    render_copies          = 0;
     render_texture_changes = 0;
 
     render_texture = nullptr;
-#endif // _DEBUG
 
     SDL_RenderPresent(renderer);
 
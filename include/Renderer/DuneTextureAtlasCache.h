@@ -0,0 +1,88 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DUNETEXTUREATLASCACHE_H
+#define DUNETEXTUREATLASCACHE_H
+
+#include "DuneTexture.h"
+
+#include <FileClasses/GFXConstants.h>
+
+#include "DataTypes.h"
+
+#include <array>
+#include <filesystem>
+#include <string>
+
+/// An on-disk cache of the packed object picture atlases.
+/**
+    Building an object picture atlas means scaling the sprite sheets to a zoom level, remapping them to a house color
+    and packing the result. There is one atlas per zoom level and house, each stored in its own cache file together
+    with the location of every picture. The cache is keyed by the MD5 checksums of the PAK files, the selected scaler
+    and the texture format, so any change of the game data or of the relevant settings rebuilds it.
+
+    load() and save() may be called from a background thread.
+*/
+class DuneTextureAtlasCache final {
+public:
+    /// Where the picture of one zoom level and house is stored
+    enum class Location : uint16_t {
+        None,      ///< there is no such picture
+        Atlas,     ///< in the atlas of this zoom level and house
+        Harkonnen, ///< identical to the Harkonnen picture of this zoom level
+    };
+
+    struct Entry {
+        Location location = Location::None;
+        DuneTextureRect rect; ///< the location in the atlas if location is Location::Atlas
+    };
+
+    using page_rects_type = std::array<Entry, NUM_OBJPICS>;
+
+    DuneTextureAtlasCache(uint32_t format, int max_side);
+
+    /**
+        Loads the atlas of one zoom level and house from the cache.
+        \param  zoom    the zoom level
+        \param  house   the house
+        \param  atlas   the atlas surface read from the cache
+        \param  rects   the location of each object picture
+        \return true if a valid cache entry matching the current data and settings was found
+    */
+    bool load(int zoom, HOUSETYPE house, sdl2::surface_ptr& atlas, page_rects_type& rects) const;
+
+    /**
+        Replaces the cache content for one zoom level and house. Errors are logged but otherwise ignored.
+        \param  zoom    the zoom level
+        \param  house   the house
+        \param  atlas   the atlas surface (must be of the format passed to the constructor)
+        \param  rects   the location of each object picture
+    */
+    void save(int zoom, HOUSETYPE house, SDL_Surface* atlas, const page_rects_type& rects) const;
+
+private:
+    static std::string createKey(uint32_t format, int max_side);
+
+    [[nodiscard]] std::filesystem::path getPath(int zoom, HOUSETYPE house) const;
+
+    const uint32_t format_;
+    const int max_side_;
+    const std::string key_;
+    std::filesystem::path directory_;
+};
+
+#endif // DUNETEXTUREATLASCACHE_H
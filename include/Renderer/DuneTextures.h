@@ -6,6 +6,8 @@
 #include "DataTypes.h"
 #include "DuneTexture.h"
 
+#include <memory>
+
 class SurfaceLoader;
 
 class DuneTextures final {
@@ -14,9 +16,23 @@ public:
 
     static DuneTextures create(SDL_Renderer* renderer, SurfaceLoader* manager);
 
-    [[nodiscard]] const DuneTexture& get_object_picture(unsigned int id, HOUSETYPE house, int zoom) const {
-        return object_pictures_.at(zoom).at(id).at(static_cast<int>(house));
-    }
+    /**
+        Returns an object picture. The atlas with the pictures of this zoom level and house is created on first use.
+        The returned reference stays valid for the lifetime of this object.
+    */
+    [[nodiscard]] const DuneTexture& get_object_picture(unsigned int id, HOUSETYPE house, int zoom) const;
+
+    /**
+        Returns the slot of an object picture without creating its atlas. The slot is filled in once
+        prepare_object_pictures() has been called for this zoom level and house.
+    */
+    [[nodiscard]] const DuneTexture& get_object_picture_slot(unsigned int id, HOUSETYPE house, int zoom) const;
+
+    /// Creates the object picture atlas of this zoom level and house unless it exists already
+    void prepare_object_pictures(int zoom, HOUSETYPE house) const;
+
+    /// Creates the object picture atlases of this zoom level for every house that has been used so far
+    void prepare_object_pictures(int zoom) const;
 
     [[nodiscard]] const DuneTexture& get_small_object(unsigned int id) const { return small_details_.at(id); }
     [[nodiscard]] const DuneTexture& get_tiny_picture(unsigned int id) const { return tiny_pictures_.at(id); }
@@ -66,13 +82,15 @@ public:
     using border_style_type      = std::array<BorderStyle, NUM_DECORATIONFRAMES>;
 
 private:
+    class ObjectPictures;
+
     DuneTextures();
-    DuneTextures(std::vector<sdl2::texture_ptr>&& textures, object_pictures_type&& object_pictures,
+    DuneTextures(std::vector<sdl2::texture_ptr>&& textures, std::unique_ptr<ObjectPictures>&& object_pictures,
                  small_details_type&& small_details, tiny_pictures_type&& tiny_pictures, ui_graphics_type&& ui_graphics,
                  map_choice_type&& map_choice_, generated_type&& generated_pictures,
                  decoration_border_type&& decoration_border, border_style_type&& border_style);
 
-    const object_pictures_type object_pictures_{};
+    const std::unique_ptr<ObjectPictures> object_pictures_;
     const small_details_type small_details_{};
     const tiny_pictures_type tiny_pictures_{};
     const ui_graphics_type ui_graphics_{};
@@ -288,7 +288,7 @@ public:
     void squash(const GameContext& context) const;
     int getInfantryTeam(const ObjectManager& objectManager) const;
     FixPoint harvestSpice(const GameContext& context);
-    void setSpice(FixPoint newSpice);
+    void setSpice(const GameContext& context, FixPoint newSpice);
 
     /**
         Returns the center point of this tile
@@ -37,6 +37,7 @@ class MusicPlayer;
 class FileManager;
 class GFXManager;
 class SFXManager;
+class SoundCache;
 class FontManager;
 class TextManager;
 class NetworkManager;
@@ -68,6 +69,7 @@ extern std::unique_ptr<MusicPlayer> musicPlayer; ///< manager for playing backgr
 extern std::unique_ptr<FileManager> pFileManager; ///< manager for loading files from PAKs
 extern std::unique_ptr<GFXManager> pGFXManager;   ///< manager for loading and managing graphics
 extern std::unique_ptr<SFXManager> pSFXManager;   ///< manager for loading and managing sounds
+extern std::unique_ptr<SoundCache> pSoundCache;   ///< cache of the sounds converted to the audio device format
 extern std::unique_ptr<FontManager> pFontManager; ///< manager for loading and managing fonts
 extern std::unique_ptr<TextManager> pTextManager; ///< manager for loading and managing texts and providing localization
 extern std::unique_ptr<NetworkManager>
@@ -0,0 +1,113 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ICOMPRESSEDSTREAM_H
+#define ICOMPRESSEDSTREAM_H
+
+#include "InputStream.h"
+
+#include <SDL2/SDL_endian.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+/// Marks the start of data written by OCompressedStream; this is never a valid string length
+inline constexpr uint32_t COMPRESSEDSTREAMMAGIC = 0xFFFF5A4C;
+
+/// The largest block an OCompressedStream writes or an ICompressedStream accepts
+inline constexpr uint32_t COMPRESSEDSTREAM_MAX_BLOCKSIZE = 1024 * 1024;
+
+/// An InputStream reading data written by OCompressedStream from another stream
+/**
+    The constructor reads the first four bytes from the source stream. If they are COMPRESSEDSTREAMMAGIC the
+    following blocks are decompressed, otherwise everything (including those four bytes) is passed through
+    unchanged. This way uncompressed savegames and replays can be read with the same code. Data from a format
+    version that predates compression is passed through without looking at its first four bytes.
+*/
+class ICompressedStream final : public InputStream {
+public:
+    /**
+        \param source          the stream to read from
+        \param mayBeCompressed false if the source is known to be uncompressed (e.g. an old savegame version)
+    */
+    explicit ICompressedStream(InputStream& source, bool mayBeCompressed = true);
+    ~ICompressedStream() override;
+
+    ICompressedStream(const ICompressedStream&)            = delete;
+    ICompressedStream(ICompressedStream&&)                 = delete;
+    ICompressedStream& operator=(const ICompressedStream&) = delete;
+    ICompressedStream& operator=(ICompressedStream&&)      = delete;
+
+    [[nodiscard]] bool isCompressed() const noexcept { return compressed; }
+
+    std::string readString() override;
+
+    void readBytes(std::span<uint8_t> data) override { get(data.data(), data.size()); }
+
+    uint8_t readUint8() override {
+        uint8_t tmp = 0;
+        get(&tmp, sizeof(tmp));
+        return tmp;
+    }
+
+    uint16_t readUint16() override {
+        uint16_t tmp = 0;
+        get(&tmp, sizeof(tmp));
+        return SDL_SwapLE16(tmp);
+    }
+
+    uint32_t readUint32() override {
+        uint32_t tmp = 0;
+        get(&tmp, sizeof(tmp));
+        return SDL_SwapLE32(tmp);
+    }
+
+    uint64_t readUint64() override {
+        uint64_t tmp = 0;
+        get(&tmp, sizeof(tmp));
+        return SDL_SwapLE64(tmp);
+    }
+
+    bool readBool() override { return readUint8() == 1; }
+
+    float readFloat() override;
+
+private:
+    void get(void* data, size_t length) {
+        if (length <= buffer.size() - bufferPos) {
+            memcpy(data, buffer.data() + bufferPos, length);
+            bufferPos += length;
+            return;
+        }
+
+        getSlow(data, length);
+    }
+
+    void getSlow(void* data, size_t length);
+    bool readBlock();
+
+    InputStream& source;
+
+    bool compressed = false; ///< true if the source contains compressed blocks
+    bool finished   = false; ///< true if the end marker was read
+
+    std::vector<uint8_t> buffer; ///< the current decompressed block
+    size_t bufferPos{};          ///< the next byte to read from buffer
+};
+
+#endif // ICOMPRESSEDSTREAM_H
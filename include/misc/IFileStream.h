@@ -20,28 +20,84 @@
 
 #include "InputStream.h"
 
+#include <SDL2/SDL_endian.h>
+
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <string>
+#include <vector>
 
+/// An InputStream reading from a file
+/**
+    The file is read in large blocks into an internal buffer. The read methods are defined inline so that calls on an
+    IFileStream (instead of an InputStream) are devirtualized and reduced to a copy out of the buffer.
+*/
 class IFileStream final : public InputStream {
 public:
     IFileStream();
     ~IFileStream() override;
 
+    IFileStream(const IFileStream&)            = delete;
+    IFileStream(IFileStream&&)                 = delete;
+    IFileStream& operator=(const IFileStream&) = delete;
+    IFileStream& operator=(IFileStream&&)      = delete;
+
     bool open(const std::filesystem::path& filename);
     void close();
 
     std::string readString() override;
 
-    uint8_t readUint8() override;
-    uint16_t readUint16() override;
-    uint32_t readUint32() override;
-    uint64_t readUint64() override;
-    bool readBool() override;
+    void readBytes(std::span<uint8_t> data) override { get(data.data(), data.size(), "readBytes"); }
+
+    uint8_t readUint8() override {
+        uint8_t tmp = 0;
+        get(&tmp, sizeof(tmp), "readUint8");
+        return tmp;
+    }
+
+    uint16_t readUint16() override {
+        uint16_t tmp = 0;
+        get(&tmp, sizeof(tmp), "readUint16");
+        return SDL_SwapLE16(tmp);
+    }
+
+    uint32_t readUint32() override {
+        uint32_t tmp = 0;
+        get(&tmp, sizeof(tmp), "readUint32");
+        return SDL_SwapLE32(tmp);
+    }
+
+    uint64_t readUint64() override {
+        uint64_t tmp = 0;
+        get(&tmp, sizeof(tmp), "readUint64");
+        return SDL_SwapLE64(tmp);
+    }
+
+    bool readBool() override { return readUint8() == 1; }
+
     float readFloat() override;
 
 private:
-    FILE* fp;
+    static constexpr size_t bufferSize = 64 * 1024;
+
+    void get(void* data, size_t length, const char* caller) {
+        if (length <= bufferEnd - bufferPos) {
+            memcpy(data, buffer.data() + bufferPos, length);
+            bufferPos += length;
+            return;
+        }
+
+        getSlow(data, length, caller);
+    }
+
+    void getSlow(void* data, size_t length, const char* caller);
+
+    FILE* fp{};
+
+    std::vector<uint8_t> buffer; ///< holds the part of the file starting at the current read position
+    size_t bufferPos{};          ///< the next byte to read from buffer
+    size_t bufferEnd{};          ///< number of valid bytes in buffer
 };
 
 #endif // IFILESTREAM_H
@@ -52,6 +52,8 @@ public:
 
     float readFloat() override;
 
+    void readBytes(std::span<uint8_t> data) override;
+
 private:
     size_t currentPos{};
     size_t bufferSize{};
@@ -25,6 +25,7 @@
 
 #include <exception>
 #include <list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -47,6 +48,12 @@ public:
     virtual bool readBool()       = 0;
     virtual float readFloat()     = 0;
 
+    /**
+        Reads in a block of raw bytes. The default implementation calls readUint8() for every byte.
+        \param data    the buffer to fill
+    */
+    virtual void readBytes(std::span<uint8_t> data);
+
     /**
         Reads in a Sint8 value.
         \return the read value
@@ -0,0 +1,64 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace dune {
+
+/// A read-only view of the complete content of a file
+/**
+    The file is memory mapped, so only the pages that are actually used are read from disk. If the file cannot be
+    mapped it is read into memory instead. The view stays valid until the MappedFile is destroyed.
+*/
+class MappedFile final {
+public:
+    /**
+        Opens and maps the file. Throws io_error if the file cannot be opened.
+        \param  filename    the file to map
+    */
+    explicit MappedFile(const std::filesystem::path& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile(MappedFile&&)                 = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&)      = delete;
+
+    [[nodiscard]] std::span<const uint8_t> data() const noexcept { return data_; }
+
+    [[nodiscard]] size_t size() const noexcept { return data_.size(); }
+
+    /// true if the file is memory mapped, false if it was read into memory
+    [[nodiscard]] bool isMapped() const noexcept { return mapping_ != nullptr; }
+
+private:
+    void readFile(const std::filesystem::path& filename);
+
+    std::span<const uint8_t> data_;
+    void* mapping_ = nullptr;      ///< the start of the mapped view
+    std::vector<uint8_t> content_; ///< the file content if mapping failed
+};
+
+} // namespace dune
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,120 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCOMPRESSEDSTREAM_H
+#define OCOMPRESSEDSTREAM_H
+
+#include "OutputStream.h"
+
+#include <SDL2/SDL_endian.h>
+
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+/// An OutputStream compressing everything written to it and passing the result on to another stream
+/**
+    The first prefixLength bytes are passed through unchanged, so that e.g. the magic number and version of a
+    savegame stay readable. Then COMPRESSEDSTREAMMAGIC is written, followed by zlib compressed blocks. Each block
+    starts with its uncompressed and compressed size; a block with an uncompressed size of 0 ends the data.
+    finish() has to be called when all data is written. The data can be read back with ICompressedStream.
+*/
+class OCompressedStream final : public OutputStream {
+public:
+    /**
+        Constructor
+        \param  target          the stream to write to
+        \param  prefixLength    the number of bytes at the start that are written without compression
+    */
+    explicit OCompressedStream(OutputStream& target, size_t prefixLength = 0);
+    ~OCompressedStream() override;
+
+    OCompressedStream(const OCompressedStream&)            = delete;
+    OCompressedStream(OCompressedStream&&)                 = delete;
+    OCompressedStream& operator=(const OCompressedStream&) = delete;
+    OCompressedStream& operator=(OCompressedStream&&)      = delete;
+
+    /**
+        Compresses the remaining data and writes the end marker. Nothing may be written afterwards.
+    */
+    void finish();
+
+    /**
+        Compresses the data written so far into a block and flushes the target stream.
+    */
+    void flush() override;
+
+    // write operations
+
+    void writeString(std::string_view str) override {
+        writeUint32(static_cast<uint32_t>(str.length()));
+        put(str.data(), str.length());
+    }
+
+    void writeBytes(std::span<const uint8_t> data) override { put(data.data(), data.size()); }
+
+    void writeUint8(uint8_t x) override { put(&x, sizeof(x)); }
+
+    void writeUint16(uint16_t x) override {
+        x = SDL_SwapLE16(x);
+        put(&x, sizeof(x));
+    }
+
+    void writeUint32(uint32_t x) override {
+        x = SDL_SwapLE32(x);
+        put(&x, sizeof(x));
+    }
+
+    void writeUint64(uint64_t x) override {
+        x = SDL_SwapLE64(x);
+        put(&x, sizeof(x));
+    }
+
+    void writeBool(bool x) override { writeUint8(x ? 1 : 0); }
+
+    void writeFloat(float x) override {
+        uint32_t tmp = 0;
+        memcpy(&tmp, &x, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
+        writeUint32(tmp);
+    }
+
+private:
+    static constexpr size_t blockSize = 256 * 1024;
+
+    void put(const void* data, size_t length) {
+        if (prefixLength == 0 && length <= blockSize - buffer.size()) {
+            const auto pos = buffer.size();
+            buffer.resize(pos + length);
+            memcpy(buffer.data() + pos, data, length);
+            return;
+        }
+
+        putSlow(data, length);
+    }
+
+    void putSlow(const void* data, size_t length);
+    void writeBlock();
+
+    OutputStream& target;
+
+    size_t prefixLength; ///< number of bytes that are still to be written without compression
+    bool finished = false;
+
+    std::vector<uint8_t> buffer; ///< the data of the current block
+};
+
+#endif // OCOMPRESSEDSTREAM_H
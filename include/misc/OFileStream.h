@@ -20,14 +20,31 @@
 
 #include "OutputStream.h"
 
+#include <SDL2/SDL_endian.h>
+
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <string_view>
+#include <vector>
 
+/// An OutputStream writing to a file
+/**
+    All writes are collected in an internal buffer that is written out in large blocks when it is full and on
+    flush() or close(). I/O errors are therefore reported by the write that spills the buffer, by flush() or by
+    close(); the destructor silently drops them. The write methods are defined inline so that calls on an
+    OFileStream (instead of an OutputStream) are devirtualized and reduced to a copy into the buffer.
+*/
 class OFileStream final : public OutputStream {
 public:
     OFileStream();
     ~OFileStream() override;
 
+    OFileStream(const OFileStream&)            = delete;
+    OFileStream(OFileStream&&)                 = delete;
+    OFileStream& operator=(const OFileStream&) = delete;
+    OFileStream& operator=(OFileStream&&)      = delete;
+
     bool open(const std::filesystem::path& filename);
     void close();
 
@@ -35,17 +52,58 @@ public:
 
     // write operations
 
-    void writeString(std::string_view str) override;
+    void writeString(std::string_view str) override {
+        writeUint32(static_cast<uint32_t>(str.length()));
+        put(str.data(), str.length());
+    }
+
+    void writeBytes(std::span<const uint8_t> data) override { put(data.data(), data.size()); }
+
+    void writeUint8(uint8_t x) override { put(&x, sizeof(x)); }
+
+    void writeUint16(uint16_t x) override {
+        x = SDL_SwapLE16(x);
+        put(&x, sizeof(x));
+    }
+
+    void writeUint32(uint32_t x) override {
+        x = SDL_SwapLE32(x);
+        put(&x, sizeof(x));
+    }
+
+    void writeUint64(uint64_t x) override {
+        x = SDL_SwapLE64(x);
+        put(&x, sizeof(x));
+    }
 
-    void writeUint8(uint8_t x) override;
-    void writeUint16(uint16_t x) override;
-    void writeUint32(uint32_t x) override;
-    void writeUint64(uint64_t x) override;
-    void writeBool(bool x) override;
-    void writeFloat(float x) override;
+    void writeBool(bool x) override { writeUint8(x ? 1 : 0); }
+
+    void writeFloat(float x) override {
+        uint32_t tmp = 0;
+        memcpy(&tmp, &x, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
+        writeUint32(tmp);
+    }
 
 private:
+    static constexpr size_t bufferSize = 64 * 1024;
+
+    void put(const void* data, size_t length) {
+        if (length <= buffer.size() - bufferPos) {
+            memcpy(buffer.data() + bufferPos, data, length);
+            bufferPos += length;
+            return;
+        }
+
+        putSlow(data, length);
+    }
+
+    void putSlow(const void* data, size_t length);
+    bool writeBuffer() noexcept;
+
     FILE* fp{};
+
+    std::vector<uint8_t> buffer; ///< collects the output until it is written to fp
+    size_t bufferPos{};          ///< number of bytes used in buffer
 };
 
 #endif // OFILESTREAM_H
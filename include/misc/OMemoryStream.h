@@ -20,42 +20,82 @@
 
 #include "OutputStream.h"
 
-#include <string>
+#include <SDL2/SDL_endian.h>
 
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/// An OutputStream collecting everything written into a growing memory buffer
 class OMemoryStream final : public OutputStream {
 public:
     OMemoryStream();
-
     ~OMemoryStream() override;
 
-    void open();
+    OMemoryStream(const OMemoryStream&)            = delete;
+    OMemoryStream(OMemoryStream&&)                 = delete;
+    OMemoryStream& operator=(const OMemoryStream&) = delete;
+    OMemoryStream& operator=(OMemoryStream&&)      = delete;
+
+    /**
+        Discards everything written so far.
+        \param  capacity    the number of bytes to reserve
+    */
+    void open(size_t capacity = 0);
 
-    [[nodiscard]] const char* getData() const { return pBuffer; }
+    [[nodiscard]] std::span<const uint8_t> getData() const { return buffer; }
 
-    [[nodiscard]] size_t getDataLength() const { return (bReadOnly == true) ? bufferSize : currentPos; }
+    [[nodiscard]] size_t getDataLength() const { return buffer.size(); }
+
+    /**
+        Moves the written bytes out of the stream. The stream is empty afterwards.
+        \return the written bytes
+    */
+    std::vector<uint8_t> release();
 
     void flush() override;
 
-    void writeString(const std::string& str) override;
+    void writeString(std::string_view str) override {
+        writeUint32(static_cast<uint32_t>(str.length()));
+        put(str.data(), str.length());
+    }
 
-    void writeUint8(Uint8 x) override;
+    void writeBytes(std::span<const uint8_t> data) override { put(data.data(), data.size()); }
 
-    void writeUint16(Uint16 x) override;
+    void writeUint8(uint8_t x) override { put(&x, sizeof(x)); }
 
-    void writeUint32(Uint32 x) override;
+    void writeUint16(uint16_t x) override {
+        x = SDL_SwapLE16(x);
+        put(&x, sizeof(x));
+    }
 
-    void writeUint64(Uint64 x) override;
+    void writeUint32(uint32_t x) override {
+        x = SDL_SwapLE32(x);
+        put(&x, sizeof(x));
+    }
 
-    void writeBool(bool x) override;
+    void writeUint64(uint64_t x) override {
+        x = SDL_SwapLE64(x);
+        put(&x, sizeof(x));
+    }
 
-    void writeFloat(float x) override;
+    void writeBool(bool x) override { writeUint8(x ? 1 : 0); }
 
-    void ensureBufferSize(size_t minBufferSize);
+    void writeFloat(float x) override {
+        uint32_t tmp = 0;
+        memcpy(&tmp, &x, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
+        writeUint32(tmp);
+    }
 
 private:
-    size_t currentPos{};
-    size_t bufferSize{};
-    char* pBuffer{};
+    void put(const void* data, size_t length) {
+        const auto pos = buffer.size();
+        buffer.resize(pos + length);
+        memcpy(buffer.data() + pos, data, length);
+    }
+
+    std::vector<uint8_t> buffer;
 };
 
 #endif // OMEMORYSTREAM_H
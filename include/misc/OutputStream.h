@@ -26,6 +26,7 @@
 
 #include <exception>
 #include <list>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -50,6 +51,12 @@ public:
     virtual void writeBool(bool x)       = 0;
     virtual void writeFloat(float x)     = 0;
 
+    /**
+        Writes out a block of raw bytes. The default implementation calls writeUint8() for every byte.
+        \param data    the bytes to write
+    */
+    virtual void writeBytes(std::span<const uint8_t> data);
+
     /**
         Writes out a Sint8 value.
         \param x    the value to write out
@@ -34,6 +34,31 @@ class RobustListIterator;
 template<typename T>
 class RobustListConstIterator;
 
+/**
+    While an instance of this class exists, the robust list iterators created on the current thread do not register
+    at their list. Several threads may then iterate through the same lists at the same time. No list may be modified
+    while any thread is in such a scope, as the iterators that are not registered are not adjusted when an element is
+    removed.
+*/
+class RobustListReadOnlyScope final {
+public:
+    RobustListReadOnlyScope() noexcept : previous_{active_} { active_ = true; }
+    ~RobustListReadOnlyScope() { active_ = previous_; }
+
+    RobustListReadOnlyScope(const RobustListReadOnlyScope&)            = delete;
+    RobustListReadOnlyScope(RobustListReadOnlyScope&&)                 = delete;
+    RobustListReadOnlyScope& operator=(const RobustListReadOnlyScope&) = delete;
+    RobustListReadOnlyScope& operator=(RobustListReadOnlyScope&&)      = delete;
+
+    /// Is the current thread in a read-only scope?
+    static bool isActive() noexcept { return active_; }
+
+private:
+    static inline thread_local bool active_ = false;
+
+    bool previous_; ///< was the thread already in a read-only scope when this one was entered?
+};
+
 /**
     This iterator is designed for the robust list class. The iterator registers at the list
     and thus can be updated when a list element is removed from the list.
@@ -48,6 +73,7 @@ public:
         current          = nullptr;
         pList            = nullptr;
         AdvancingAllowed = true;
+        Registered       = false;
     }
 
     /**
@@ -57,6 +83,7 @@ public:
         current          = nullptr;
         pList            = nullptr;
         AdvancingAllowed = true;
+        Registered       = false;
         *this            = x;
     }
 
@@ -69,6 +96,7 @@ public:
         current          = start;
         pList            = List;
         AdvancingAllowed = true;
+        Registered       = false;
         registerAtList();
     }
 
@@ -203,8 +231,9 @@ private:
         Registers this iterator at the list
     */
     void registerAtList() {
-        if (pList != nullptr) {
+        if (pList != nullptr && !RobustListReadOnlyScope::isActive()) {
             pList->RegisterIterator(this);
+            Registered = true;
         }
     }
 
@@ -213,8 +242,10 @@ private:
     */
     void unregisterFromList() {
         if (pList != nullptr) {
-            pList->UnregisterIterator(this);
-            pList = nullptr;
+            if (Registered)
+                pList->UnregisterIterator(this);
+            pList      = nullptr;
+            Registered = false;
         }
     }
 
@@ -224,6 +255,7 @@ private:
     RobustListNode<T>* current;
     const RobustList<T>* pList;
     bool AdvancingAllowed;
+    bool Registered; ///< is this iterator registered at pList?
 };
 
 /**
@@ -240,6 +272,7 @@ public:
         current          = nullptr;
         pList            = nullptr;
         AdvancingAllowed = true;
+        Registered       = false;
     }
 
     /**
@@ -249,6 +282,7 @@ public:
         current          = nullptr;
         pList            = nullptr;
         AdvancingAllowed = true;
+        Registered       = false;
         *this            = x;
     }
 
@@ -259,6 +293,7 @@ public:
         current          = x.current;
         pList            = x.pList;
         AdvancingAllowed = x.AdvancingAllowed;
+        Registered       = false;
         registerAtList();
     }
 
@@ -271,6 +306,7 @@ public:
         current          = start;
         pList            = List;
         AdvancingAllowed = true;
+        Registered       = false;
         registerAtList();
     }
 
@@ -405,8 +441,9 @@ private:
         Registers this iterator at the list
     */
     void registerAtList() {
-        if (pList != nullptr) {
+        if (pList != nullptr && !RobustListReadOnlyScope::isActive()) {
             pList->RegisterConstIterator(this);
+            Registered = true;
         }
     }
 
@@ -415,8 +452,10 @@ private:
     */
     void unregisterFromList() {
         if (pList != nullptr) {
-            pList->UnregisterConstIterator(this);
-            pList = nullptr;
+            if (Registered)
+                pList->UnregisterConstIterator(this);
+            pList      = nullptr;
+            Registered = false;
         }
     }
 
@@ -426,11 +465,13 @@ private:
     const RobustListNode<T>* current;
     const RobustList<T>* pList;
     bool AdvancingAllowed;
+    bool Registered; ///< is this iterator registered at pList?
 };
 
 /**
         A robust list class. While iterator though the list it is allowed to modify the list in any way.
         The class is designed to be very similar to the stl list class but has only basic functionality.
+        Several threads may iterate through the list at the same time inside a RobustListReadOnlyScope.
 */
 template<typename T>
 class RobustList {
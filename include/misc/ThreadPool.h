@@ -0,0 +1,94 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace dune {
+
+/// A simple fixed size pool of worker threads.
+/**
+    Tasks are started in the order they are submitted. The caller is responsible for merging the results in a
+    deterministic order (e.g. by waiting on the returned futures in submission order). A pool with zero threads runs
+    every task on the calling thread inside submit(). The destructor finishes all queued tasks before joining.
+*/
+class ThreadPool final {
+public:
+    explicit ThreadPool(unsigned int thread_count = default_thread_count());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool(ThreadPool&&)                 = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&)      = delete;
+
+    /**
+        Queues a task.
+        \param  f   the callable to run on one of the workers
+        \return a future for the result of f; exceptions thrown by f are rethrown by get()
+    */
+    template<typename F>
+    auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using result_type = std::invoke_result_t<std::decay_t<F>>;
+
+        auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(f));
+        auto ret  = task->get_future();
+
+        if (threads_.empty()) {
+            (*task)();
+            return ret;
+        }
+
+        { // Scope
+            std::lock_guard lock{mutex_};
+            queue_.emplace_back([task = std::move(task)] { (*task)(); });
+        }
+
+        cv_.notify_one();
+
+        return ret;
+    }
+
+    [[nodiscard]] unsigned int size() const noexcept { return static_cast<unsigned int>(threads_.size()); }
+
+    /// The number of hardware threads minus the calling thread (at least one)
+    static unsigned int default_thread_count();
+
+private:
+    void worker();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+
+    std::vector<std::thread> threads_;
+};
+
+} // namespace dune
+
+#endif // THREADPOOL_H
@@ -23,6 +23,8 @@
 
 #include <Renderer/DuneRenderer.h>
 
+#include <array>
+
 /**
     Return the pixel value at (x, y) in surface
     NOTE: The surface must be locked before calling this!
@@ -150,6 +152,27 @@ sdl2::surface_ptr createShadowSurface(SDL_Surface* source);
 */
 sdl2::surface_ptr mapSurfaceColorRange(SDL_Surface* source, int srcColor, int destColor);
 
+/**
+    Returns the color map for mapSurfaceColorRange(), usable with mapColor(): every color between srcColor and
+    srcColor+7 is mapped to the color between destColor and destColor+7, every other color to itself.
+    \param  srcColor    Color range to change = [srcColor;srcColor+7]
+    \param  destColor   Color range to change to = [destColor;destColor+7]
+    \return The color map
+*/
+std::array<uint8_t, 256> createColorRangeMap(int srcColor, int destColor);
+
+/**
+    This function creates a surface that looks like mapSurfaceColorRange(source, srcColor, destColor) without copying
+    or touching a single pixel. The new surface shares the pixels of the 8-bit surface source and only gets its own
+    palette, in which every entry i holds the color source's palette has for the mapped color of i. The new surface
+    must not outlive source and the pixels of source must not be changed anymore.
+    \param  source      The source image (8-bit palettized, must not need locking)
+    \param  srcColor    Color range to change = [srcColor;srcColor+7]
+    \param  destColor   Color range to change to = [destColor;destColor+7]
+    \return The mapped surface
+*/
+sdl2::surface_ptr mapSurfacePaletteColorRange(SDL_Surface* source, int srcColor, int destColor);
+
 /**
     This function create a new blank surface with the same format and other attributes as the model surface.
     \param  model      The model surface
@@ -0,0 +1,44 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCALER_KERNELS_H
+#define SCALER_KERNELS_H
+
+#include <cstdint>
+
+/**
+    The Scale2x/Scale3x kernels used by Scaler for 8-bit palettized pixels (see
+    http://scale2x.sourceforge.net/algorithm.html ).
+
+    Each call scales one tile of width x height pixels starting at src into dst. Neighbours outside of the tile are
+    clamped to the tile border, so the tiles of a sprite sheet do not bleed into each other. The *_scalar versions
+    process one pixel at a time; the others use SSE2 or NEON where available and produce bit-identical output.
+*/
+namespace dune::scaler {
+
+void scale2x_scalar(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height);
+void scale2x(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height);
+
+void scale3x_scalar(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height);
+void scale3x(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height);
+
+/// The instruction set used by scale2x() and scale3x() ("SSE2", "NEON" or "none")
+const char* simd_name() noexcept;
+
+} // namespace dune::scaler
+
+#endif // SCALER_KERNELS_H
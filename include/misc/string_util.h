@@ -23,10 +23,12 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cctype>
 #include <charconv>
 #include <functional>
 #include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -203,6 +205,39 @@ inline std::string strToUpper(std::string_view str) {
     return result;
 }
 
+/// Hash for unordered containers with std::string keys that are looked up with std::string_view (use std::equal_to<>)
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view value) const noexcept { return std::hash<std::string_view>{}(value); }
+};
+
+/// Hash for unordered containers with case insensitive (ASCII) std::string keys, e.g. file names
+struct CaseInsensitiveStringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view value) const noexcept {
+        auto sum = value.size();
+
+        // Force "c" to be "unsigned char" or std::tolower()'s behavior is undefined.
+        for (const unsigned char c : value)
+            sum = sum * 101 + std::tolower(c);
+
+        return sum;
+    }
+};
+
+/// Comparison for unordered containers with case insensitive (ASCII) std::string keys, e.g. file names
+struct CaseInsensitiveStringEqualTo {
+    using is_transparent = void;
+
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept {
+        return std::ranges::equal(lhs, rhs, [](unsigned char a, unsigned char b) {
+            return a == b || std::tolower(a) == std::tolower(b);
+        });
+    }
+};
+
 inline bool utf8IsStartByte(unsigned char c) {
     return (c & 0x80u) == 0u || (c & 0xC0u) == 0xC0u;
 }
@@ -224,6 +259,13 @@ size_t utf8Length(std::string_view str);
 */
 std::string utf8Substr(std::string_view str, size_t pos, size_t len = std::string_view::npos);
 
+/**
+    Decodes an utf-8 string into its characters (=code points). Invalid or truncated sequences are decoded as U+FFFD.
+    \param  str an utf-8 string
+    \return the code points of str
+*/
+std::u32string utf8Decode(std::string_view str);
+
 /**
     This function splits a text into multiple lines such that each line is no longer than linewidth pixels. The function
    pGetTextWidth is used to determine how wide a given text will be in pixels.
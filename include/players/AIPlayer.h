@@ -47,11 +47,11 @@ private:
 
     int getNumAdjacentStructureTiles(Coord pos, int structureSizeX, int structureSizeY);
 
-    void checkAllUnits();
+    void checkAllUnits(int slice);
     void build();
     void attack();
 
-    void handle_sandworm(const UnitBase* sandworm);
+    void handle_sandworm(const UnitBase* sandworm, const Harvester* harvester);
 
     [[nodiscard]] bool isAllowedToArm() const;
 
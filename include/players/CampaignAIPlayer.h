@@ -67,8 +67,8 @@ private:
         Coord location;
     };
 
-    void updateStructures();
-    void updateUnits();
+    void updateStructures(int slice);
+    void updateUnits(int slice);
 
     static int calculateTargetPriority(const UnitBase* pUnit, const ObjectBase* pObject);
 
@@ -0,0 +1,64 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEFENDERSELECTION_H
+#define DEFENDERSELECTION_H
+
+#include <DataTypes.h>
+#include <data.h>
+
+namespace dune::ai {
+
+/**
+    Checks if unit is free to be scrambled against an intruder. It has to be respondable, must neither hunt nor have
+    a target yet and has to be a fighting unit. The do-methods on the own units act at once, so a unit that was just
+    sent against one intruder has a target and is not picked again for the next intruder of the same update.
+    \param  unit    the unit to check
+    \return true if unit may be sent against the intruder, false otherwise
+*/
+template<typename Unit>
+bool isFreeDefender(const Unit& unit) {
+    if (!unit.isRespondable() || unit.getAttackMode() == HUNT || unit.hasATarget())
+        return false;
+
+    switch (unit.getItemID()) {
+        case Unit_Harvester:
+        case Unit_MCV:
+        case Unit_Carryall:
+        case Unit_Frigate:
+        case Unit_Saboteur:
+        case Unit_Sandworm: return false;
+        default: return true;
+    }
+}
+
+/**
+    Calls order for every unit in units that is free to defend against an intruder (see isFreeDefender()).
+    \param  units   the units to choose from
+    \param  order   called with a pointer to each chosen unit
+*/
+template<typename Units, typename Order>
+void scrambleFreeDefenders(const Units& units, Order&& order) {
+    for (const auto* pUnit : units) {
+        if (isFreeDefender(*pUnit))
+            order(pUnit);
+    }
+}
+
+} // namespace dune::ai
+
+#endif // DEFENDERSELECTION_H
@@ -25,6 +25,10 @@
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
 #include <misc/RobustList.h>
+#include <misc/dune_clock.h>
+
+#include <functional>
+#include <vector>
 
 class GameInitSettings;
 class Random;
@@ -61,6 +65,25 @@ public:
 
     virtual void update() = 0;
 
+    /**
+        Runs update() so that the players of different houses may think at the same time. Actions on the own units
+        and structures are executed at once, so the player sees their effect right away. Actions that may affect
+        other houses or use the shared random generator are only collected and executed by applyActions(). While
+        thinking, the robust lists must not be modified (see RobustListReadOnlyScope).
+    */
+    void think();
+
+    /**
+        Executes the actions collected by the last call to think() in the order they were taken.
+    */
+    void applyActions();
+
+    /// \return the wall-clock time this player has spent thinking, summed over all game cycles
+    [[nodiscard]] dune::dune_clock::duration getThinkTime() const noexcept { return thinkTime_; }
+
+    /// \return the longest wall-clock time this player has spent thinking in a single game cycle
+    [[nodiscard]] dune::dune_clock::duration getMaxThinkTime() const noexcept { return maxThinkTime_; }
+
     /**
         Notifies that a structure or unit was built.
         \param  pObject  the object that was built
@@ -122,6 +145,26 @@ protected:
     Random& getRandomGen();
     [[nodiscard]] const GameInitSettings& getGameInitSettings() const;
     [[nodiscard]] uint32_t getGameCycleCount() const;
+
+    /**
+        AI players spread their periodic work over numSlices game cycles instead of doing all of it in one cycle.
+        The slice only depends on the game cycle and the house, so all peers do the same work in the same cycle.
+        \param  numSlices   the number of cycles one full update is spread over
+        \return the slice of the current cycle (0 to numSlices - 1)
+    */
+    [[nodiscard]] int getUpdateSlice(int numSlices) const;
+
+    /**
+        Checks if pObject is handled in the given slice. The objects are split into slices by their object id.
+        \param  pObject     the object to check
+        \param  slice       the slice returned by getUpdateSlice()
+        \param  numSlices   the number of slices passed to getUpdateSlice()
+        \return true if pObject is to be handled in this slice
+    */
+    [[nodiscard]] static bool isInUpdateSlice(const ObjectBase* pObject, int slice, int numSlices) {
+        return static_cast<int>(pObject->getObjectID() % static_cast<uint32_t>(numSlices)) == slice;
+    }
+
     [[nodiscard]] int getTechLevel() const;
 
     Map& getMap();
@@ -132,6 +175,13 @@ protected:
     const RobustList<const StructureBase*>& getStructureList();
     [[nodiscard]] const RobustList<const UnitBase*>& getUnitList() const;
 
+    /// The structures owned by the house of this player
+    [[nodiscard]] const RobustList<const StructureBase*>& getOwnStructureList() const;
+    /// The units owned by the house of this player
+    [[nodiscard]] const RobustList<const UnitBase*>& getOwnUnitList() const;
+    /// The units or structures of type itemID owned by the house of this player
+    [[nodiscard]] const RobustList<const ObjectBase*>& getOwnItemList(ItemID_enum itemID) const;
+
     const House* getHouse(HOUSETYPE houseID);
 
     /**
@@ -186,7 +236,7 @@ protected:
 
     /**
         Start building a random item in pBuilder. If pBuilder is a Starport a random item is
-        added to the order list
+        added to the order list. While thinking this is only queued.
         \param  pBuilder  the structure to build in
     */
     void doBuildRandom(const BuilderBase* pBuilder) const;
@@ -202,18 +252,19 @@ protected:
         \param  pConstYard  the construction yard that has produced the structure
         \param  x           the x coordinate (in tile coordinates)
         \param  y           the y coordinate (in tile coordinates)
-        \return true if placement was successful, false otherwise
+        \return true if placement was successful, false otherwise or if it was only queued while thinking
     */
     bool doPlaceStructure(const ConstructionYard* pConstYard, int x, int y) const;
 
     /**
-        Activate the special palace weapon Fremen or Saboteur. For the Deathhand see doLaunchDeathhand.
+        Activate the special palace weapon Fremen or Saboteur. For the Deathhand see doLaunchDeathhand. While
+        thinking this is only queued.
         \param  pPalace the palace to activate the special weapon of
     */
     void doSpecialWeapon(const Palace* pPalace) const;
 
     /**
-        Launch the deathhand missile an target position x,y.
+        Launch the deathhand missile an target position x,y. While thinking this is only queued.
         \param  pPalace the palace to activate the special weapon of
         \param  xpos    x coordinate (in tile coordinates)
         \param  ypos    y coordinate (in tile coordinates)
@@ -289,13 +340,14 @@ protected:
     /**
        Deploy MCV pMCV. If deploying was successful this unit does not exist anymore.
        \param  pMCV the MCV to deploy
-       \return true, if deploying was successful, false otherwise.
+       \return true, if deploying was successful, false otherwise or if it was only queued while thinking.
     */
     bool doDeploy(const MCV* pMCV) const;
 
     /**
         Request a carryall to take unit to location
         This isn't in the original game but will make it fun
+        \return true if a carryall was booked, false otherwise or if it was only queued while thinking
     */
 
     bool doRequestCarryallDrop(const GroundUnit* pGroundUnit) const;
@@ -303,6 +355,21 @@ protected:
 private:
     friend class House;
 
+    /**
+        While thinking, action is queued for applyActions() instead of being executed by the calling do-method. Only
+        the do-methods that may affect other houses or use the shared random generator defer their action.
+        \param  action  the call to the do-method that is to be repeated by applyActions()
+        \return true if the action was queued, false if the do-method shall execute it now
+    */
+    template<typename F>
+    bool deferAction(F&& action) const {
+        if (!thinking_)
+            return false;
+
+        actions_.emplace_back(std::forward<F>(action));
+        return true;
+    }
+
     House* pHouse;
     uint8_t playerID;
     std::string playername;
@@ -310,6 +377,12 @@ private:
 
     Random random_;
 
+    bool thinking_ = false;                              ///< is this player currently thinking?
+    mutable std::vector<std::function<void()>> actions_; ///< the actions taken while thinking
+
+    dune::dune_clock::duration thinkTime_{};    ///< the time spent in think() over all game cycles
+    dune::dune_clock::duration maxThinkTime_{}; ///< the longest time spent in a single call to think()
+
 protected:
     const GameContext context_;
 };
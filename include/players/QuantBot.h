@@ -68,6 +68,7 @@ private:
 
     Coord findMcvPlaceLocation(const MCV* pMCV);
     Coord findPlaceLocation(ItemID_enum itemID);
+    int rateSurroundings(ItemID_enum itemID, int x, int y, int sizeX, int sizeY);
     [[nodiscard]] Coord findSquadCenter(HOUSETYPE houseID) const;
     Coord findBaseCentre(HOUSETYPE houseID);
     Coord findSquadRallyLocation();
@@ -75,7 +76,18 @@ private:
 
     std::vector<Coord> placeLocations; ///< Where to place structures
 
-    void checkAllUnits();
+    /// A candidate location for the structure findPlaceLocation() currently looks for
+    struct PlacementCell {
+        uint32_t generation   = 0;     ///< the call of findPlaceLocation() this cell was last rated in
+        bool placeable        = false; ///< can the structure be placed here?
+        int surroundingsScore = 0;     ///< rating of the tiles around the structure
+        int score             = 0;     ///< accumulated score over all neighbouring structures
+    };
+
+    std::vector<PlacementCell> placementGrid; ///< one cell per map tile, reused by every findPlaceLocation() call
+    uint32_t placementGeneration = 0;         ///< incremented by every findPlaceLocation() call
+
+    void checkAllUnits(int slice);
     void retreatAllUnits();
     void build(int militaryValue);
     void attack(int militaryValue);
@@ -50,7 +50,7 @@ private:
 
     int getNumAdjacentStructureTiles(Coord pos, int structureSizeX, int structureSizeY);
 
-    void checkAllUnits();
+    void checkAllUnits(int slice);
     void build(const GameContext& context);
     void attack();
 
@@ -1,5 +1,6 @@
 add_sources(HEADERS
 	AITeamInfo.h
+	AITournament.h
 	AStarSearch.h
 	Bullet.h
 	Choam.h
@@ -43,6 +44,7 @@ add_sources(HEADERS
 	FileClasses/music/ADLPlayer.h
 	FileClasses/music/DirectoryPlayer.h
 	FileClasses/music/MusicPlayer.h
+	FileClasses/music/MusicPrefetcher.h
 	FileClasses/music/XMIPlayer.h
 	FileClasses/Pakfile.h
 	FileClasses/Palette.h
@@ -52,6 +54,7 @@ add_sources(HEADERS
 	FileClasses/SaveTextureAsBmp.h
 	FileClasses/SFXManager.h
 	FileClasses/Shpfile.h
+	FileClasses/SoundCache.h
 	FileClasses/SurfaceLoader.h
 	FileClasses/TextManager.h
 	FileClasses/TTFFont.h
@@ -76,6 +79,7 @@ add_sources(HEADERS
 	fixmath/FixPoint16.h
 	fixmath/FixPoint32.h
 	fixmath/int64.h
+	FogMask.h
 	Game.h
 	GameInitSettings.h
 	GameInterface.h
@@ -134,6 +138,7 @@ add_sources(HEADERS
 	GUI/WidgetWithBackground.h
 	GUI/Window.h
 	House.h
+	HouseInfluence.h
 	INIMap/INIMap.h
 	INIMap/INIMapEditorLoader.h
 	INIMap/INIMapLoader.h
@@ -186,11 +191,14 @@ add_sources(HEADERS
 	misc/FileSystem.h
 	misc/fnkdat.h
 	misc/generator.h
+	misc/ICompressedStream.h
 	misc/IFileStream.h
 	misc/IMemoryStream.h
 	misc/InputStream.h
 	misc/lemire_uniform_uint32_distribution.h
+	misc/MappedFile.h
 	misc/md5.h
+	misc/OCompressedStream.h
 	misc/OFileStream.h
 	misc/OMemoryStream.h
 	misc/OutputStream.h
@@ -202,11 +210,13 @@ add_sources(HEADERS
 	misc/reverse.h
 	misc/RobustList.h
 	misc/Scaler.h
+	misc/scaler_kernels.h
 	misc/SDL2pp.h
 	misc/sdl_support.h
 	misc/sound_util.h
 	misc/string_error.h
 	misc/string_util.h
+	misc/ThreadPool.h
 	misc/unique_or_nonowning_ptr.h
 	mmath.h
 	Network/ChangeEventList.h
@@ -226,6 +236,7 @@ add_sources(HEADERS
 	ObjectPointer.h
 	players/AIPlayer.h
 	players/CampaignAIPlayer.h
+	players/DefenderSelection.h
 	players/HumanPlayer.h
 	players/Player.h
 	players/PlayerFactory.h
@@ -233,10 +244,12 @@ add_sources(HEADERS
 	players/SmartBot.h
 	RadarView.h
 	RadarViewBase.h
+	Renderer/DuneGlyphAtlas.h
 	Renderer/DuneRenderer.h
 	Renderer/DuneRotateTexture.h
 	Renderer/DuneSurface.h
 	Renderer/DuneTexture.h
+	Renderer/DuneTextureAtlasCache.h
 	Renderer/DuneTextures.h
 	Renderer/DuneTileTexture.h
 	sand.h
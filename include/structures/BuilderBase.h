@@ -106,6 +106,15 @@ public:
     */
     virtual void updateBuildList();
 
+    /**
+        This method checks if the build list of this builder depends on the owner having a structure of type
+        structureID. Only then does the build list have to be updated when the owner gets its first or loses its
+        last structure of that type.
+        \param structureID    the type of the structure
+        \return true if an item of this builder requires a structure of type structureID, false otherwise
+    */
+    [[nodiscard]] virtual bool dependsOnStructure(ItemID_enum structureID) const;
+
     void setWaitingToPlace();
     void unSetWaitingToPlace();
 
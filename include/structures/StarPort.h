@@ -67,6 +67,9 @@ public:
 
     void updateBuildList() override;
 
+    /// The star port offers what the CHOAM has available, no matter which structures its owner has
+    [[nodiscard]] bool dependsOnStructure([[maybe_unused]] ItemID_enum structureID) const override { return false; }
+
     /**
         Begin with the deploying of the delivered units.
     */
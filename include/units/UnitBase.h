@@ -303,6 +303,12 @@ protected:
 
     void quitDeviation(const GameContext& context);
 
+    /**
+        Hands this unit over to newOwner and moves it from the unit lists of the old owner to those of newOwner.
+        \param  newOwner    the house that owns this unit from now on
+    */
+    void changeOwner(House* newOwner);
+
     bool SearchPathWithAStar();
 
     void drawSmoke(float x, float y) const;
@@ -0,0 +1,268 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <AITournament.h>
+
+#include <globals.h>
+
+#include <FileClasses/INIFile.h>
+#include <Game.h>
+#include <GameInitSettings.h>
+#include <House.h>
+#include <players/Player.h>
+#include <players/PlayerFactory.h>
+
+#include <misc/FileSystem.h>
+#include <misc/SDL2pp.h>
+#include <misc/exceptions.h>
+#include <misc/string_util.h>
+
+#include <fmt/format.h>
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+namespace {
+inline constexpr auto TOURNAMENT_SECTION = "Tournament";
+
+/// The game master seed of the given tournament seed; the same seed always yields the same game
+std::vector<uint8_t> createTournamentSeed(int seed) {
+    std::mt19937 generator{static_cast<std::mt19937::result_type>(seed)};
+
+    std::vector<uint8_t> randomSeed(RandomFactory::seed_size);
+    for (auto& byte : randomSeed)
+        byte = static_cast<uint8_t>(generator());
+
+    return randomSeed;
+}
+
+std::vector<std::string> readList(const INIFile& config, std::string_view key) {
+    std::vector<std::string> list;
+
+    for (const auto& entry : splitStringToStringVector(config.getStringValue(TOURNAMENT_SECTION, key))) {
+        const auto trimmed = trim(entry);
+        if (!trimmed.empty())
+            list.emplace_back(trimmed);
+    }
+
+    return list;
+}
+
+std::filesystem::path findMap(const std::string& name) {
+    std::filesystem::path mapFile{name};
+
+    if (!std::filesystem::exists(mapFile))
+        mapFile = getDuneLegacyDataDir() / "maps/multiplayer" / (name + ".ini");
+
+    if (!std::filesystem::exists(mapFile))
+        THROW(std::invalid_argument, "AITournament: Cannot find the map '%s'!", name);
+
+    return mapFile;
+}
+
+bool writeLine(SDL_RWops* file, std::string_view line) {
+    return 1 == SDL_RWwrite(file, line.data(), line.size(), 1) && 1 == SDL_RWwrite(file, "\n", 1, 1);
+}
+
+double averageMicroseconds(dune::dune_clock::duration time, uint64_t gameCycles) {
+    if (gameCycles == 0)
+        return 0.0;
+
+    return std::chrono::duration<double, std::micro>(time).count() / gameCycles;
+}
+
+double microseconds(dune::dune_clock::duration time) {
+    return std::chrono::duration<double, std::micro>(time).count();
+}
+} // namespace
+
+AITournament::AITournament(const std::filesystem::path& configFile) {
+    const INIFile config{configFile};
+
+    if (!config.hasSection(TOURNAMENT_SECTION))
+        THROW(std::invalid_argument, "AITournament: '%s' has no [%s] section!",
+              reinterpret_cast<const char*>(configFile.u8string().c_str()), TOURNAMENT_SECTION);
+
+    players_ = readList(config, "Players");
+    if (players_.size() < 2)
+        THROW(std::invalid_argument, "AITournament: At least two players are needed!");
+
+    for (const auto& player : players_) {
+        if (player == HUMANPLAYERCLASS || PlayerFactory::getByPlayerClass(player) == nullptr)
+            THROW(std::invalid_argument, "AITournament: '%s' is no AI player class!", player);
+    }
+
+    for (const auto& map : readList(config, "Maps"))
+        maps_.push_back(findMap(map));
+
+    if (maps_.empty())
+        THROW(std::invalid_argument, "AITournament: No maps given!");
+
+    seeds_ = std::max(1, config.getIntValue(TOURNAMENT_SECTION, "Seeds", 1));
+
+    const auto maxMinutes = std::max(1, config.getIntValue(TOURNAMENT_SECTION, "Max Minutes", 120));
+    maxGameCycles_        = MILLI2CYCLES(static_cast<uint32_t>(maxMinutes) * 60 * 1000);
+
+    output_ = config.getStringValue(TOURNAMENT_SECTION, "Output", "tournament.csv");
+}
+
+bool AITournament::run() const {
+    const sdl2::RWops_ptr file{SDL_RWFromFile(reinterpret_cast<const char*>(output_.u8string().c_str()), "wb")};
+
+    if (!file) {
+        sdl2::log_error(SDL_LOG_CATEGORY_APPLICATION, "AITournament: Unable to open '%s': %s",
+                        reinterpret_cast<const char*>(output_.u8string().c_str()), SDL_GetError());
+        return false;
+    }
+
+    if (!writeLine(file.get(), "map,seed,player1,player2,winner,cycles,minutes,player1_avg_us,player1_max_us,"
+                               "player2_avg_us,player2_max_us"))
+        return false;
+
+    struct Standing {
+        int wins   = 0;
+        int losses = 0;
+        int draws  = 0;
+        uint64_t gameCycles{};
+        dune::dune_clock::duration thinkTime{};
+        dune::dune_clock::duration maxThinkTime{};
+    };
+
+    std::map<std::string, Standing> standings;
+
+    for (const auto& map : maps_) {
+        for (auto seed = 0; seed < seeds_; ++seed) {
+            for (auto i = 0U; i < players_.size(); ++i) {
+                for (auto j = 0U; j < players_.size(); ++j) {
+                    if (i == j)
+                        continue;
+
+                    const auto result = playMatch(map, seed, players_[i], players_[j]);
+
+                    const auto& [p1, p2] = result.players;
+
+                    const auto winner =
+                        result.winner < 0 ? std::string{"draw"} : result.players[result.winner].playerClass;
+
+                    const auto line = fmt::format(
+                        "{},{},{},{},{},{},{:.1f},{:.1f},{:.1f},{:.1f},{:.1f}",
+                        reinterpret_cast<const char*>(getBasename(result.map, true).u8string().c_str()), result.seed,
+                        p1.playerClass, p2.playerClass, winner, result.gameCycles,
+                        result.gameCycles * (GAMESPEED_DEFAULT / 60000.0),
+                        averageMicroseconds(p1.thinkTime, result.gameCycles), microseconds(p1.maxThinkTime),
+                        averageMicroseconds(p2.thinkTime, result.gameCycles), microseconds(p2.maxThinkTime));
+
+                    if (!writeLine(file.get(), line)) {
+                        sdl2::log_error(SDL_LOG_CATEGORY_APPLICATION, "AITournament: Unable to write '%s': %s",
+                                        reinterpret_cast<const char*>(output_.u8string().c_str()), SDL_GetError());
+                        return false;
+                    }
+
+                    for (auto k = 0; k < 2; ++k) {
+                        const auto& player = result.players[k];
+                        auto& standing     = standings[player.playerClass];
+
+                        if (result.winner < 0)
+                            ++standing.draws;
+                        else if (result.winner == k)
+                            ++standing.wins;
+                        else
+                            ++standing.losses;
+
+                        standing.gameCycles += result.gameCycles;
+                        standing.thinkTime += player.thinkTime;
+                        standing.maxThinkTime = std::max(standing.maxThinkTime, player.maxThinkTime);
+                    }
+                }
+            }
+        }
+    }
+
+    sdl2::log_info("Tournament results:");
+    for (const auto& [playerClass, standing] : standings) {
+        sdl2::log_info("%-20s won %3d lost %3d draw %3d  thinking: avg %8.1fus max %10.1fus per game cycle",
+                       playerClass, standing.wins, standing.losses, standing.draws,
+                       averageMicroseconds(standing.thinkTime, standing.gameCycles),
+                       microseconds(standing.maxThinkTime));
+    }
+
+    return true;
+}
+
+AITournament::MatchResult AITournament::playMatch(const std::filesystem::path& mapFile, int seed,
+                                                  const std::string& player1, const std::string& player2) const {
+    sdl2::log_info("AITournament: %s vs. %s on %s (seed %d)", player1, player2,
+                   reinterpret_cast<const char*>(mapFile.u8string().c_str()), seed);
+
+    GameInitSettings init{getBasename(mapFile, true), readCompleteFile(mapFile), true,
+                          dune::globals::settings.gameOptions};
+    init.setRandomSeed(createTournamentSeed(seed));
+
+    const std::string playerNames[2] = {fmt::format("{} #1", player1), fmt::format("{} #2", player2)};
+
+    // The passive observer makes the house of player 1 the local house, so winning the game means player 1 has won
+    GameInitSettings::HouseInfo house1{HOUSETYPE::HOUSE_INVALID, 1};
+    house1.addPlayerInfo(GameInitSettings::PlayerInfo{playerNames[0], player1});
+    house1.addPlayerInfo(GameInitSettings::PlayerInfo{"Observer", HUMANPLAYERCLASS});
+    init.addHouseInfo(house1);
+
+    GameInitSettings::HouseInfo house2{HOUSETYPE::HOUSE_INVALID, 2};
+    house2.addPlayerInfo(GameInitSettings::PlayerInfo{playerNames[1], player2});
+    init.addHouseInfo(house2);
+
+    auto cleanup = gsl::finally([&] { dune::globals::currentGame.reset(); });
+
+    // The old game has to be deleted before the new one is created as its destructor has global side effects
+    dune::globals::currentGame.reset();
+    dune::globals::currentGame = std::make_unique<Game>();
+
+    auto* const game = dune::globals::currentGame.get();
+
+    game->initGame(init);
+
+    const GameContext context{*game, *game->getMap(), game->getObjectManager()};
+    game->runWithoutDrawing(context, maxGameCycles_);
+
+    MatchResult result;
+    result.map        = mapFile;
+    result.seed       = seed;
+    result.gameCycles = game->getGameCycleCount();
+
+    if (game->isGameFinished())
+        result.winner = game->isGameWon() ? 0 : 1;
+
+    for (auto k = 0; k < 2; ++k) {
+        result.players[k].playerClass = k == 0 ? player1 : player2;
+
+        for (auto h = 0; h < NUM_HOUSES; ++h) {
+            const auto* const pHouse = game->getHouse(static_cast<HOUSETYPE>(h));
+            if (pHouse == nullptr)
+                continue;
+
+            for (const auto& pPlayer : pHouse->getPlayerList()) {
+                if (pPlayer->getPlayername() == playerNames[k]) {
+                    result.players[k].thinkTime    = pPlayer->getThinkTime();
+                    result.players[k].maxThinkTime = pPlayer->getMaxThinkTime();
+                }
+            }
+        }
+    }
+
+    return result;
+}
@@ -47,6 +47,9 @@ void CutScene::run() {
 
         const auto nextFrameTime = draw();
 
+        if (dune::globals::musicPlayer != nullptr)
+            dune::globals::musicPlayer->update();
+
         const auto frameDone = std::chrono::milliseconds{nextFrameTime} + frameStart;
 
         for (;;) {
@@ -132,7 +135,8 @@ int CutScene::draw() {
         break;
     }
 
-    if (scenes.empty() && !dune::globals::musicPlayer->isMusicPlaying()) {
+    if (scenes.empty() && !dune::globals::musicPlayer->isMusicPlaying()
+        && !dune::globals::musicPlayer->isMusicPending()) {
         quit();
     }
 
@@ -70,8 +70,15 @@ sdl2::surface_ptr LoadCPS_RW(SDL_RWops* RWop) {
     const auto pImageOut = std::make_unique<uint8_t[]>(static_cast<size_t>(SIZE_X) * SIZE_Y);
     memset(pImageOut.get(), 0, static_cast<size_t>(SIZE_X) * SIZE_Y);
 
-    if (decode80(pFiledata.get() + 10 + PaletteSize, pImageOut.get(), 0) == -2) {
-        THROW(std::runtime_error, "LoadCPS_RW(): Decoding this *.cps-File failed!");
+    if (cpsFilesize < 10u + PaletteSize) {
+        THROW(std::runtime_error, "LoadCPS_RW(): No valid *.cps-File: File too small!");
+    }
+
+    try {
+        decode80({pFiledata.get() + 10 + PaletteSize, cpsFilesize - 10 - PaletteSize},
+                 {pImageOut.get(), static_cast<size_t>(SIZE_X) * SIZE_Y}, 0);
+    } catch (const std::invalid_argument& e) {
+        THROW(std::runtime_error, "LoadCPS_RW(): Decoding this *.cps-File failed: %s", e.what());
     }
 
     // create new picture surface
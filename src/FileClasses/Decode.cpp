@@ -17,26 +17,55 @@
 
 #include <FileClasses/Decode.h>
 
-#include <misc/SDL2pp.h>
+#include <Definitions.h>
 #include <misc/dune_endian.h>
 #include <misc/exceptions.h>
 
-void memcpy_overlap(unsigned char* dst, const unsigned char* src, unsigned cnt) {
-    /* Copies memory areas that may overlap byte by byte from small memory
-     * addresses to big memory addresses. Thus, already copied bytes can be
-     * copied again. */
-    if (dst + cnt < src || src + cnt < dst) {
-        memcpy(dst, src, cnt);
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/// Copies count bytes inside out from src to dst with the result of a forward byte by byte copy.
+/**
+    The format80 back references rely on this: if the source overlaps the destination, the bytes between src and dst
+    are repeated. Instead of copying byte by byte, the repeated pattern is copied with memcpy and doubles with every
+    copy.
+    \param  out     the output buffer
+    \param  dst     offset of the destination
+    \param  src     offset of the source
+    \param  count   number of bytes to copy
+*/
+void copy_forward(unsigned char* out, size_t dst, size_t src, size_t count) {
+    if (src >= dst || src + count <= dst) {
+        // A forward copy from behind the destination never reads bytes it has written itself
+        memmove(out + dst, out + src, count);
         return;
     }
-    while (cnt--) {
-        *dst = *src;
-        dst++;
-        src++;
+
+    while (count > 0) {
+        const auto n = std::min(count, dst - src);
+
+        memcpy(out + dst, out + src, n);
+
+        dst += n;
+        count -= n;
     }
 }
 
-int decode40(const unsigned char* image_in, unsigned char* image_out) {
+void xor_copy(unsigned char* RESTRICT dst, const unsigned char* RESTRICT src, size_t count) {
+    for (auto i = size_t{0}; i < count; ++i)
+        dst[i] ^= src[i];
+}
+
+void xor_fill(unsigned char* dst, unsigned char value, size_t count) {
+    for (auto i = size_t{0}; i < count; ++i)
+        dst[i] ^= value;
+}
+
+} // namespace
+
+int decode40(std::span<const unsigned char> image_in, std::span<unsigned char> image_out) {
     /*
     0 fill 00000000 c v
     1 copy 0ccccccc
@@ -46,86 +75,99 @@ int decode40(const unsigned char* image_in, unsigned char* image_out) {
     5 skip 1ccccccc
     */
 
-    const unsigned char* readp = image_in;
-    unsigned char* writep      = image_out;
-    uint16_t count             = 0;
+    const auto* const in = image_in.data();
+    auto* const out      = image_out.data();
+    size_t readp         = 0;
+    size_t writep        = 0;
+
+    const auto need_input = [&](size_t n) {
+        if (n > image_in.size() - readp)
+            THROW(std::invalid_argument, "decode40(): Unexpected end of the format40 data!");
+    };
+    const auto need_output = [&](size_t n) {
+        if (n > image_out.size() - writep)
+            THROW(std::invalid_argument, "decode40(): The format40 data does not fit into %u bytes!",
+                  image_out.size());
+    };
+
     while (true) {
-        uint16_t code = *readp++;
+        need_input(1);
+        const unsigned code = in[readp++];
+
         if (~code & 0x80) {
             // bit 7 = 0
             if (!code) {
                 // command 0 (00000000 c v): fill
-                count = *readp++;
-                code  = *readp++;
-                while (count--)
-                    *writep++ ^= code;
+                need_input(2);
+                const size_t count = in[readp];
+                const auto value   = in[readp + 1];
+                readp += 2;
+
+                need_output(count);
+                xor_fill(out + writep, value, count);
+                writep += count;
             } else {
                 // command 1 (0ccccccc): copy
-                count = code;
-                while (count--)
-                    *writep++ ^= *readp++;
+                const size_t count = code;
+
+                need_input(count);
+                need_output(count);
+                xor_copy(out + writep, in + readp, count);
+                readp += count;
+                writep += count;
             }
 
-        } else {
-            // bit 7 = 1
-            count = code & 0x7f;
+            continue;
+        }
+
+        // bit 7 = 1
+        size_t count = code & 0x7f;
+        if (count) {
+            // command 5 (1ccccccc): skip
+            need_output(count);
+            writep += count;
+            continue;
+        }
+
+        need_input(2);
+        count = dune::read_le_uint16(in + readp);
+        readp += 2;
+
+        if (~count & 0x8000) {
+            // command 2 (10000000 c 0ccccccc): skip
             if (!count) {
-                count = dune::read_le_uint16(readp);
-                readp += 2;
-                code = count >> 8;
-                if (~code & 0x80) {
-                    // bit 7 = 0
-                    // command 2 (10000000 c 0ccccccc): skip
-                    if (!count) {
-                        // end of image
-                        break;
-                    }
-                    writep += count;
-                } else {
-                    // bit 7 = 1
-                    count &= 0x3fff;
-                    if (~code & 0x40) {
-                        // bit 6 = 0
-                        // command 3 (10000000 c 10cccccc): copy
-                        while (count--) {
-                            *writep++ ^= *readp++;
-                        }
-                    } else {
-                        // bit 6 = 1
-                        // command 4 (10000000 c 11cccccc v): fill
-                        code = *readp++;
-                        while (count--) {
-                            *writep++ ^= code;
-                        }
-                    }
-                }
-            } else {
-                // command 5 (1ccccccc): skip
-                writep += count;
+                // end of image
+                break;
             }
+
+            need_output(count);
+            writep += count;
+        } else if (~count & 0x4000) {
+            // command 3 (10000000 c 10cccccc): copy
+            count &= 0x3fff;
+
+            need_input(count);
+            need_output(count);
+            xor_copy(out + writep, in + readp, count);
+            readp += count;
+            writep += count;
+        } else {
+            // command 4 (10000000 c 11cccccc v): fill
+            count &= 0x3fff;
+
+            need_input(1);
+            const auto value = in[readp++];
+
+            need_output(count);
+            xor_fill(out + writep, value, count);
+            writep += count;
         }
     }
-    return static_cast<int>(writep - image_out);
+
+    return static_cast<int>(writep);
 }
 
-int decode80(const unsigned char* image_in, unsigned char* image_out, unsigned checksum) {
-    //
-    // should decode all the format80 stuff ;-)
-    //
-
-    const unsigned char* readp = image_in;
-    unsigned char* writep      = image_out;
-
-    unsigned int a          = 0;
-    unsigned int b          = 0;
-    unsigned int c          = 0;
-    unsigned int d          = 0;
-    unsigned int e          = 0;
-    unsigned int megacounta = 0;
-    unsigned int megacountb = 0;
-    unsigned int megacountc = 0;
-    unsigned int megacountd = 0;
-    unsigned int megacounte = 0;
+int decode80(std::span<const unsigned char> image_in, std::span<unsigned char> image_out, unsigned checksum) {
     /*
        1 10cccccc
        2 0cccpppp p
@@ -134,72 +176,103 @@ int decode80(const unsigned char* image_in, unsigned char* image_out, unsigned c
        5 11111111 c c p p
      */
 
+    const auto* const in = image_in.data();
+    auto* const out      = image_out.data();
+    size_t readp         = 0;
+    size_t writep        = 0;
+    unsigned int total   = 0;
+
+    const auto need_input = [&](size_t n) {
+        if (n > image_in.size() - readp)
+            THROW(std::invalid_argument, "decode80(): Unexpected end of the format80 data!");
+    };
+    const auto need_output = [&](size_t n) {
+        if (n > image_out.size() - writep)
+            THROW(std::invalid_argument, "decode80(): The format80 data does not fit into %u bytes!",
+                  image_out.size());
+    };
+    const auto need_source = [&](size_t pos, size_t n) {
+        if (pos > image_out.size() || n > image_out.size() - pos)
+            THROW(std::invalid_argument, "decode80(): The format80 data refers to data outside of %u bytes!",
+                  image_out.size());
+    };
+
     while (true) {
-        if ((*readp & 0xc0) == 0x80) {
+        need_input(1);
+        const auto command = in[readp];
+
+        size_t count = 0;
+
+        if ((command & 0xc0) == 0x80) {
             //
             // 10cccccc (1)
             //
-            const unsigned count = readp[0] & 0x3f;
-            // sdl2::log_info("Cmd 1, count: %d", count);
-            megacounta += count;
+            count = command & 0x3f;
             if (!count) {
                 break;
             }
-            readp++;
-            memcpy_overlap(writep, readp, count);
+            ++readp;
+
+            need_input(count);
+            need_output(count);
+            memcpy(out + writep, in + readp, count);
             readp += count;
-            writep += count;
-            a++;
-        } else if ((*readp & 0x80) == 0x00) {
+        } else if ((command & 0x80) == 0x00) {
             //
             // 0cccpppp p (2)
             //
-            const unsigned count = ((readp[0] & 0x70) >> 4) + 3;
-            const unsigned short relpos =
-                static_cast<unsigned short>(readp[0] & 0xf) << 8 | static_cast<unsigned short>(readp[1]);
+            need_input(2);
+            count               = ((command & 0x70) >> 4) + 3;
+            const size_t relpos = (command & 0xf) << 8 | in[readp + 1];
             readp += 2;
-            megacountb += count;
-            memcpy_overlap(writep, writep - relpos, count);
-            writep += count;
-            b++;
-        } else if (*readp == 0xff) {
+
+            if (relpos > writep)
+                THROW(std::invalid_argument, "decode80(): The format80 data refers to data before the output!");
+
+            need_output(count);
+            copy_forward(out, writep, writep - relpos, count);
+        } else if (command == 0xff) {
             //
             // 11111111 c c p p (5)
             //
-            const unsigned short count = dune::read_le_uint16(readp + 1);
-            const unsigned short pos   = dune::read_le_uint16(readp + 3);
+            need_input(5);
+            count          = dune::read_le_uint16(in + readp + 1);
+            const auto pos = dune::read_le_uint16(in + readp + 3);
             readp += 5;
-            megacounte += count;
-            memcpy_overlap(writep, image_out + pos, count);
-            writep += count;
-            e++;
-        } else if (*readp == 0xfe) {
+
+            need_output(count);
+            need_source(pos, count);
+            copy_forward(out, writep, pos, count);
+        } else if (command == 0xfe) {
             //
-            // 11111110 c c v(4)
+            // 11111110 c c v (4)
             //
-            const unsigned short count = dune::read_le_uint16(readp + 1);
-            const unsigned char color  = readp[3];
+            need_input(4);
+            count            = dune::read_le_uint16(in + readp + 1);
+            const auto color = in[readp + 3];
             readp += 4;
-            memset(writep, color, count);
-            writep += count;
-            megacountd += count;
-            d++;
-        } else if ((*readp & 0xc0) == 0xc0) {
+
+            need_output(count);
+            memset(out + writep, color, count);
+        } else {
             //
             // 11cccccc p p (3)
             //
-            const unsigned short count = (*readp & 0x3f) + 3;
-            const unsigned short pos   = dune::read_le_uint16(readp + 1);
+            need_input(3);
+            count          = (command & 0x3f) + 3;
+            const auto pos = dune::read_le_uint16(in + readp + 1);
             readp += 3;
-            megacountc += count;
-            memcpy_overlap(writep, image_out + pos, count);
-            writep += count;
-            c++;
-        } else {
-            THROW(std::invalid_argument, "Decode: File contains unknown format80 command");
+
+            need_output(count);
+            need_source(pos, count);
+            copy_forward(out, writep, pos, count);
         }
+
+        writep += count;
+        total += count;
     }
-    if (megacounta + megacountb + megacountc + megacountd + megacounte != checksum)
+
+    if (total != checksum)
         return -1;
 
     return 0;
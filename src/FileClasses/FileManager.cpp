@@ -32,7 +32,7 @@
 #include <filesystem>
 #include <mutex>
 
-std::vector<std::unique_ptr<Pakfile>>
+PakFileManager::pak_files_type
 PakFileManager::loadPakFiles(const CaseInsensitiveFilesystemCache& cache, std::span<const std::string> files) {
     sdl2::log_info("FileManager is loading PAK-Files...");
     sdl2::log_info("MD5-Checksum                      Filename");
@@ -40,6 +40,9 @@ PakFileManager::loadPakFiles(const CaseInsensitiveFilesystemCache& cache, std::s
     std::vector<std::unique_ptr<Pakfile>> pakFiles;
     pakFiles.reserve(files.size());
 
+    std::vector<std::string> md5s;
+    md5s.reserve(files.size());
+
     for (const auto& filename : files) {
         auto filepath0 = cache.find(std::u8string{reinterpret_cast<const char8_t*>(filename.data()), filename.size()});
 
@@ -49,9 +52,11 @@ PakFileManager::loadPakFiles(const CaseInsensitiveFilesystemCache& cache, std::s
         auto& filepath = filepath0.value();
 
         try {
-            sdl2::log_info("%s  %s", md5FromFilename(filepath),
-                           reinterpret_cast<const char*>(filepath.u8string().c_str()));
+            auto md5 = md5FromFilename(filepath);
+
+            sdl2::log_info("%s  %s", md5, reinterpret_cast<const char*>(filepath.u8string().c_str()));
             pakFiles.emplace_back(std::make_unique<Pakfile>(filepath));
+            md5s.emplace_back(std::move(md5));
         } catch (std::exception& e) {
             THROW(io_error, "Error while opening '%s': %s!", reinterpret_cast<const char*>(filepath.u8string().c_str()),
                   e.what());
@@ -60,7 +65,7 @@ PakFileManager::loadPakFiles(const CaseInsensitiveFilesystemCache& cache, std::s
 
     sdl2::log_info("");
 
-    return pakFiles;
+    return {std::move(pakFiles), std::move(md5s)};
 }
 
 PakFileManager::pak_directory_type PakFileManager::createPakDirectory() const {
@@ -250,7 +255,11 @@ std::string PakFileManager::md5FromFilename(std::filesystem::path filename) {
 }
 
 PakFileManager::PakFileManager(const CaseInsensitiveFilesystemCache& cache, std::span<const std::string> files)
-    : pakFiles_{loadPakFiles(cache, files)}, pak_directory_(createPakDirectory()) { }
+    : PakFileManager{loadPakFiles(cache, files)} { }
+
+PakFileManager::PakFileManager(pak_files_type&& pak_files)
+    : pakFiles_{std::move(std::get<0>(pak_files))}, pakMD5s_{std::move(std::get<1>(pak_files))},
+      pak_directory_(createPakDirectory()) { }
 
 std::tuple<const Pakfile*, int> PakFileManager::find(const std::string& filename) const {
     const auto it = pak_directory_.find(filename);
@@ -92,8 +92,11 @@ zoomable_texture GFXManager::getObjPic(ObjPic_enum id, HOUSETYPE house) const {
         THROW(std::invalid_argument, "GFXManager::getObjPic(): Unit Picture with ID %u is not available!", id);
     }
 
-    return {&duneTextures.get_object_picture(id, house, 0), &duneTextures.get_object_picture(id, house, 1),
-            &duneTextures.get_object_picture(id, house, 2)};
+    // Only the current zoom level is created right away; the others are filled in by prepareObjPics()
+    duneTextures.prepare_object_pictures(dune::globals::currentZoomlevel, house);
+
+    return {&duneTextures.get_object_picture_slot(id, house, 0), &duneTextures.get_object_picture_slot(id, house, 1),
+            &duneTextures.get_object_picture_slot(id, house, 2)};
 }
 
 const DuneTexture* GFXManager::getSmallDetailPic(SmallDetailPics_Enum id) const {
@@ -20,18 +20,10 @@
 #include <misc/exceptions.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <string>
-
-#include "misc/BufferedReader.h"
-
 #include <utility>
 
-namespace {
-
-inline constexpr auto PAKFILE_RWOP_TYPE = 0x9a5f17ecU;
-
-}
-
 BasePakfile::BasePakfile(std::filesystem::path pakfilename) : filename_{std::move(pakfilename)} { }
 
 BasePakfile::~BasePakfile() = default;
@@ -51,255 +43,127 @@ const std::string& BasePakfile::getFilename(unsigned int index) const {
     return fileEntries[index].filename;
 }
 
-size_t BasePakfile::WriteFile([[maybe_unused]] SDL_RWops* pRWop, [[maybe_unused]] const void* ptr,
-                              [[maybe_unused]] size_t size, [[maybe_unused]] size_t n) {
-    return 0;
+bool BasePakfile::exists(const std::string& filename) const {
+    return fileIndex_.contains(filename);
 }
 
-int64_t BasePakfile::SizeFile(SDL_RWops* pRWop) {
-    if (pRWop == nullptr || pRWop->hidden.unknown.data1 == nullptr || pRWop->type != PAKFILE_RWOP_TYPE) {
-        return -1;
-    }
+int BasePakfile::findFile(const std::string& filename) const {
+    const auto it = fileIndex_.find(filename);
 
-    const auto* const pRWopData = static_cast<RWopData*>(pRWop->hidden.unknown.data1);
-    const auto* const pPakfile  = pRWopData->curPakfile;
-    if (pPakfile == nullptr) {
-        return -1;
-    }
-
-    if (pRWopData->fileIndex >= pPakfile->fileEntries.size()) {
-        return -1;
-    }
-
-    return pPakfile->fileEntries[pRWopData->fileIndex].endOffset
-         - pPakfile->fileEntries[pRWopData->fileIndex].startOffset + 1;
+    return it == fileIndex_.end() ? -1 : it->second;
 }
 
-int64_t BasePakfile::SeekFile(SDL_RWops* pRWop, int64_t offset, int whence) {
-    if (pRWop == nullptr || pRWop->hidden.unknown.data1 == nullptr || pRWop->type != PAKFILE_RWOP_TYPE) {
-        return -1;
-    }
-
-    auto* const pRWopData      = static_cast<RWopData*>(pRWop->hidden.unknown.data1);
-    const auto* const pPakfile = pRWopData->curPakfile;
-    if (pPakfile == nullptr) {
-        return -1;
-    }
-
-    if (pRWopData->fileIndex >= pPakfile->fileEntries.size()) {
-        return -1;
-    }
-
-    int64_t newOffset = 0;
-
-    switch (whence) {
-        case SEEK_SET: {
-            newOffset = offset;
-        } break;
-
-        case SEEK_CUR: {
-            newOffset = pRWopData->fileOffset + offset;
-        } break;
+void BasePakfile::addEntry(PakFileEntry entry) {
+    const auto index = static_cast<int>(fileEntries.size());
 
-        case SEEK_END: {
-            newOffset = pPakfile->fileEntries[pRWopData->fileIndex].endOffset
-                      - pPakfile->fileEntries[pRWopData->fileIndex].startOffset + 1 + offset;
-        } break;
+    // If a name appears twice the first entry wins, like the linear search used to do
+    fileIndex_.try_emplace(entry.filename, index);
 
-        default: {
-            return -1;
-        }
-    }
-
-    if (newOffset > pPakfile->fileEntries[pRWopData->fileIndex].endOffset
-                        - pPakfile->fileEntries[pRWopData->fileIndex].startOffset + 1) {
-        return -1;
-    }
-
-    pRWopData->fileOffset = static_cast<size_t>(newOffset);
-    return newOffset;
+    fileEntries.push_back(std::move(entry));
 }
 
-int BasePakfile::CloseFile(SDL_RWops* pRWop) {
-    if (pRWop == nullptr || pRWop->hidden.unknown.data1 == nullptr || pRWop->type != PAKFILE_RWOP_TYPE) {
-        return -1;
-    }
+void Pakfile::readIndex() {
+    const auto data = file_.data();
 
-    const auto* const pRWopData = static_cast<RWopData*>(pRWop->hidden.unknown.data1);
-    delete pRWopData;
-    pRWop->hidden.unknown.data1 = nullptr;
-    SDL_FreeRW(pRWop);
-    return 0;
-}
-
-void BasePakfile::readIndex() {
-    BufferedReader reader{fPakFile.get()};
+    size_t pos = 0;
 
     while (true) {
-        PakFileEntry newEntry;
+        uint32_t startOffset{};
 
-        if (!reader.read_one(&newEntry.startOffset, sizeof newEntry.startOffset)) {
-            THROW(std::runtime_error, "Pakfile::readIndex(): SDL_RWread() failed!");
-        }
+        if (pos + sizeof startOffset > data.size())
+            THROW(std::runtime_error, "Pakfile::readIndex(): Unexpected end of the index!");
+
+        std::memcpy(&startOffset, data.data() + pos, sizeof startOffset);
+        pos += sizeof startOffset;
 
         // pak-files are always little endian encoded
-        newEntry.startOffset = SDL_SwapLE32(newEntry.startOffset);
-        newEntry.endOffset   = 0;
+        startOffset = SDL_SwapLE32(startOffset);
 
-        if (newEntry.startOffset == 0) {
+        if (startOffset == 0)
             break;
-        }
 
-        for (;;) {
-            char tmp{};
-            if (!reader.read_type<char>(tmp))
-                THROW(std::runtime_error, "Pakfile::readIndex(): SDL_RWread() failed!");
+        const auto* const name = data.data() + pos;
+        const auto* const end  = static_cast<const uint8_t*>(std::memchr(name, '\0', data.size() - pos));
 
-            if (tmp == '\0')
-                break;
+        if (end == nullptr)
+            THROW(std::runtime_error, "Pakfile::readIndex(): Unexpected end of the index!");
 
-            newEntry.filename += tmp;
-        }
+        pos += end - name + 1;
 
-        if (!fileEntries.empty()) {
-            fileEntries.back().endOffset = newEntry.startOffset - 1;
-        }
+        if (startOffset > data.size() || (!fileEntries.empty() && startOffset < fileEntries.back().startOffset))
+            THROW(std::runtime_error, "Pakfile::readIndex(): Invalid offset %u!", startOffset);
 
-        fileEntries.push_back(newEntry);
-    }
+        if (!fileEntries.empty())
+            fileEntries.back().endOffset = startOffset - 1;
 
-    const auto filesize = SDL_RWsize(fPakFile.get());
-    if (filesize < 0) {
-        THROW(std::runtime_error, "Pakfile::readIndex(): SDL_RWsize() failed!");
+        addEntry({startOffset, 0, std::string{reinterpret_cast<const char*>(name), static_cast<size_t>(end - name)}});
     }
 
-    fileEntries.back().endOffset = static_cast<uint32_t>(filesize) - 1u;
+    if (!fileEntries.empty())
+        fileEntries.back().endOffset = static_cast<uint32_t>(data.size()) - 1u;
 }
 
 /// Constructor for Pakfile
 /**
-    The PAK-File to be read/write is specified by the pakfilename-parameter. If write==false the file is opened for
-    read-only and is closed in the destructor. If write==true the file is opened write-only and written out in the
-    destructor.
+    The PAK-File to be read is specified by the pakfilename-parameter. The file is memory mapped and the index of all
+    contained files is read.
     \param pakfilename  Filename of the *.pak-File.
 */
-Pakfile::Pakfile(const std::filesystem::path& pakfilename) : BasePakfile{pakfilename} {
-
-    // Open for reading
-    sdl2::RWops_ptr file{SDL_RWFromFile(filename_.u8string(), "rb")};
-
-    if (file == nullptr) {
-        THROW(std::invalid_argument, "Pakfile::Pakfile(): Cannot open " + pakfilename.string() + "!");
-    }
-
-    fPakFile = std::move(file);
-
+Pakfile::Pakfile(const std::filesystem::path& pakfilename) : BasePakfile{pakfilename}, file_{pakfilename} {
     readIndex();
 }
 
 /// Destructor
 /**
-    Closes the filehandle and releases all memory.
+    Unmaps the file and releases all memory.
 */
 Pakfile::~Pakfile() = default;
 
 /// Opens a file in this PAK-File.
 /**
-    This method opens the file specified by filename. It is only allowed if the Pakfile is opened for reading.
+    This method opens the file specified by filename. The name is compared case insensitive.
     The returned SDL_RWops-structure can be used readonly with SDL_RWread, SDL_RWsize, SDL_RWseek and SDL_RWclose. No
-   writing is supported.<br> NOTICE: The returned SDL_RWops-Structure is only valid as long as this Pakfile-Object
-   exists. It gets invalid as soon as Pakfile:~Pakfile() is executed.
-   \param  filename    The name of this file
-   \return SDL_RWops for this file
+    writing is supported.<br> NOTICE: The returned SDL_RWops-Structure is only valid as long as this Pakfile-Object
+    exists. It gets invalid as soon as Pakfile:~Pakfile() is executed.
+    \param  filename    The name of this file
+    \return SDL_RWops for this file
 */
 sdl2::RWops_ptr Pakfile::openFile(const std::string& filename) const {
-    // find file
-    for (auto i = 0U; i < fileEntries.size(); ++i) {
-        if (filename == fileEntries[i].filename)
-            return openFile(static_cast<int>(i));
-    }
+    const auto index = findFile(filename);
+
+    if (index < 0)
+        THROW(io_error, "Pakfile::openFile(): Cannot find file with name '%s' in this PAK file!", filename);
 
-    THROW(io_error, "Pakfile::openFile(): Cannot find file with name '%s' in this PAK file!", filename);
+    return openFile(index);
 }
 
 sdl2::RWops_ptr Pakfile::openFile(int index) const {
-    if (index < 0 || std::cmp_greater_equal(index, fileEntries.size()))
-        THROW(io_error, "Pakfile::openFile(): There is not file at index '%d' in this PAK file!", index);
-
-    // alloc RWop
+    const auto data = getFileData(index);
 
-    sdl2::RWops_ptr pRWop{SDL_AllocRW()};
+    sdl2::RWops_ptr pRWop{SDL_RWFromConstMem(data.data(), static_cast<int>(data.size()))};
 
-    if (!pRWop) {
+    if (!pRWop)
         THROW(io_error, "Pakfile::openFile(): Cannot open file at index '%d' in this PAK file!", index);
-    }
-
-    // alloc RWopData
-    auto pRWopData = std::make_unique<RWopData>();
-
-    pRWop->type           = PAKFILE_RWOP_TYPE;
-    pRWopData->curPakfile = this;
-    pRWopData->fileOffset = 0;
-    pRWopData->fileIndex  = index;
-
-    pRWop->read  = ReadFile;
-    pRWop->write = WriteFile;
-    pRWop->size  = SizeFile;
-    pRWop->seek  = SeekFile;
-    pRWop->close = CloseFile;
-
-    pRWop->hidden.unknown.data1 = static_cast<void*>(pRWopData.release());
 
     return pRWop;
 }
 
-bool BasePakfile::exists(const std::string& filename) const {
-    return std::ranges::any_of(fileEntries, [&](auto& fe) { return filename == fe.filename; });
-}
-
-size_t Pakfile::ReadFile(SDL_RWops* pRWop, void* ptr, size_t size, size_t n) {
-    if (pRWop == nullptr || ptr == nullptr || pRWop->hidden.unknown.data1 == nullptr
-        || pRWop->type != PAKFILE_RWOP_TYPE) {
-        return 0;
-    }
-
-    auto bytes2read = size * n;
-
-    auto* const pRWopData      = static_cast<RWopData*>(pRWop->hidden.unknown.data1);
-    const auto* const pPakfile = static_cast<const Pakfile*>(pRWopData->curPakfile);
-    if (pPakfile == nullptr) {
-        return 0;
-    }
-
-    if (pRWopData->fileIndex >= pPakfile->fileEntries.size()) {
-        return 0;
-    }
-
-    const auto readstartoffset = pPakfile->fileEntries[pRWopData->fileIndex].startOffset + pRWopData->fileOffset;
+std::span<const uint8_t> Pakfile::getFileData(int index) const {
+    if (index < 0 || std::cmp_greater_equal(index, fileEntries.size()))
+        THROW(io_error, "Pakfile::getFileData(): There is not file at index '%d' in this PAK file!", index);
 
-    if (readstartoffset > pPakfile->fileEntries[pRWopData->fileIndex].endOffset) {
-        return 0;
-    }
+    const auto& entry = fileEntries[index];
 
-    if (readstartoffset + bytes2read > pPakfile->fileEntries[pRWopData->fileIndex].endOffset) {
-        bytes2read = pPakfile->fileEntries[pRWopData->fileIndex].endOffset + 1 - readstartoffset;
-        // round to last full block
-        bytes2read = (bytes2read / size) * size;
-        if (bytes2read == 0) {
-            return 0;
-        }
-    }
+    return file_.data().subspan(entry.startOffset, entry.endOffset + 1 - entry.startOffset);
+}
 
-    if (SDL_RWseek(pPakfile->fPakFile.get(), static_cast<Sint64>(readstartoffset), SEEK_SET) < 0) {
-        return 0;
-    }
+std::span<const uint8_t> Pakfile::getFileData(const std::string& filename) const {
+    const auto index = findFile(filename);
 
-    if (SDL_RWread(pPakfile->fPakFile.get(), ptr, bytes2read, 1) != 1) {
-        return 0;
-    }
+    if (index < 0)
+        THROW(io_error, "Pakfile::getFileData(): Cannot find file with name '%s' in this PAK file!", filename);
 
-    pRWopData->fileOffset += bytes2read;
-    return bytes2read / size;
+    return getFileData(index);
 }
 
 /// Constructor for OutPakfile
@@ -387,7 +251,7 @@ void OutPakfile::addFile(SDL_RWops* rwop, const std::string& filename) {
     newPakFileEntry.endOffset   = numWriteOutData + filelength - 1;
     newPakFileEntry.filename    = filename;
 
-    fileEntries.push_back(newPakFileEntry);
+    addEntry(std::move(newPakFileEntry));
 
     numWriteOutData += filelength;
 
@@ -30,7 +30,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <string>
 #include <utility>
+#include <vector>
 
 // Not used:
 // - EXCANNON.VOC (same as EXSMALL.VOC)
@@ -89,173 +91,120 @@ SFXManager::loadMixFromADL(const std::string& adlFile, int index, [[maybe_unused
 }
 
 void SFXManager::loadEnglishVoice() {
-    lngVoice.clear();
-    lngVoice.resize(static_cast<size_t>(NUM_VOICE) * NUM_HOUSES);
+    voiceFiles_.clear();
+    voiceFiles_.resize(static_cast<size_t>(NUM_VOICE) * NUM_HOUSES);
+
+    const auto* const file_manager = dune::globals::pFileManager.get();
+
+    // Prefer the first file but fall back to the second one (e.g. if the Z*.VOC files are missing)
+    const auto either = [&](const std::string& filename, const std::string& alternativeFilename) {
+        return file_manager->exists(filename) ? filename : alternativeFilename;
+    };
 
-    // now we can load
     for (auto house = 0; house < NUM_HOUSES; house++) {
-        sdl2::mix_chunk_ptr HouseNameChunk;
+        const auto setVoice = [&](Voice_enum id, std::vector<std::string> files) {
+            voiceFiles_[static_cast<int>(id) * NUM_HOUSES + house] = std::move(files);
+        };
 
         std::string HouseString;
-        const int VoiceNum = house;
+        std::string HouseName;
         switch (static_cast<HOUSETYPE>(house)) {
             case HOUSETYPE::HOUSE_HARKONNEN:
-                HouseString    = "H";
-                HouseNameChunk = getChunkFromFile(HouseString + "HARK.VOC");
+                HouseString = "H";
+                HouseName   = HouseString + "HARK.VOC";
                 break;
             case HOUSETYPE::HOUSE_ATREIDES:
-                HouseString    = "A";
-                HouseNameChunk = getChunkFromFile(HouseString + "ATRE.VOC");
+                HouseString = "A";
+                HouseName   = HouseString + "ATRE.VOC";
                 break;
             case HOUSETYPE::HOUSE_ORDOS:
-                HouseString    = "O";
-                HouseNameChunk = getChunkFromFile(HouseString + "ORDOS.VOC");
+                HouseString = "O";
+                HouseName   = HouseString + "ORDOS.VOC";
                 break;
             case HOUSETYPE::HOUSE_FREMEN:
-                HouseString    = "A";
-                HouseNameChunk = getChunkFromFile(HouseString + "FREMEN.VOC");
+                HouseString = "A";
+                HouseName   = HouseString + "FREMEN.VOC";
                 break;
             case HOUSETYPE::HOUSE_SARDAUKAR:
-                HouseString    = "H";
-                HouseNameChunk = getChunkFromFile(HouseString + "SARD.VOC");
+                HouseString = "H";
+                HouseName   = HouseString + "SARD.VOC";
                 break;
             case HOUSETYPE::HOUSE_MERCENARY:
-                HouseString    = "O";
-                HouseNameChunk = getChunkFromFile(HouseString + "MERC.VOC");
+                HouseString = "O";
+                HouseName   = HouseString + "MERC.VOC";
                 break;
             default: break;
         }
 
-        { // Scope
-            // "... Harvester deployed", "... Unit deployed" and "... Unit launched"
-            auto Harvester = getChunkFromFile(HouseString + "HARVEST.VOC");
-            auto Unit      = getChunkFromFile(HouseString + "UNIT.VOC");
-            auto Deployed  = getChunkFromFile(HouseString + "DEPLOY.VOC");
-            auto Launched  = getChunkFromFile(HouseString + "LAUNCH.VOC");
-            lngVoice[static_cast<int>(Voice_enum::HarvesterDeployed) * NUM_HOUSES + VoiceNum] =
-                concat3Chunks(HouseNameChunk.get(), Harvester.get(), Deployed.get());
-            lngVoice[static_cast<int>(Voice_enum::UnitDeployed) * NUM_HOUSES + VoiceNum] =
-                concat3Chunks(HouseNameChunk.get(), Unit.get(), Deployed.get());
-            lngVoice[static_cast<int>(Voice_enum::UnitLaunched) * NUM_HOUSES + VoiceNum] =
-                concat3Chunks(HouseNameChunk.get(), Unit.get(), Launched.get());
-        }
+        // "... Harvester deployed", "... Unit deployed" and "... Unit launched"
+        setVoice(Voice_enum::HarvesterDeployed, {HouseName, HouseString + "HARVEST.VOC", HouseString + "DEPLOY.VOC"});
+        setVoice(Voice_enum::UnitDeployed, {HouseName, HouseString + "UNIT.VOC", HouseString + "DEPLOY.VOC"});
+        setVoice(Voice_enum::UnitLaunched, {HouseName, HouseString + "UNIT.VOC", HouseString + "LAUNCH.VOC"});
 
         // "Construction complete"
-        lngVoice[static_cast<int>(Voice_enum::ConstructionComplete) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile(HouseString + "CONST.VOC");
-
-        { // Scope
-          // "Vehicle repaired"
-            auto Vehicle  = getChunkFromFile(HouseString + "VEHICLE.VOC");
-            auto Repaired = getChunkFromFile(HouseString + "REPAIR.VOC");
-            lngVoice[static_cast<int>(Voice_enum::VehicleRepaired) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(Vehicle.get(), Repaired.get());
-        }
+        setVoice(Voice_enum::ConstructionComplete, {HouseString + "CONST.VOC"});
 
-        { // Scope
-          // "Frigate has arrived"
-            auto FrigateChunk    = getChunkFromFile(HouseString + "FRIGATE.VOC");
-            auto HasArrivedChunk = getChunkFromFile(HouseString + "ARRIVE.VOC");
-            lngVoice[static_cast<int>(Voice_enum::FrigateHasArrived) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(FrigateChunk.get(), HasArrivedChunk.get());
-        }
+        // "Vehicle repaired"
+        setVoice(Voice_enum::VehicleRepaired, {HouseString + "VEHICLE.VOC", HouseString + "REPAIR.VOC"});
+
+        // "Frigate has arrived"
+        setVoice(Voice_enum::FrigateHasArrived, {HouseString + "FRIGATE.VOC", HouseString + "ARRIVE.VOC"});
 
         // "Your mission is complete"
-        lngVoice[static_cast<int>(Voice_enum::YourMissionIsComplete) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile(HouseString + "WIN.VOC");
+        setVoice(Voice_enum::YourMissionIsComplete, {HouseString + "WIN.VOC"});
 
         // "You have failed your mission"
-        lngVoice[static_cast<int>(Voice_enum::YouHaveFailedYourMission) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile(HouseString + "LOSE.VOC");
-
-        { // Scope
-          // "Radar activated"/"Radar deactivated"
-            auto RadarChunk            = getChunkFromFile(HouseString + "RADAR.VOC");
-            auto RadarActivatedChunk   = getChunkFromFile(HouseString + "ON.VOC");
-            auto RadarDeactivatedChunk = getChunkFromFile(HouseString + "OFF.VOC");
-            lngVoice[static_cast<int>(Voice_enum::RadarActivated) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(RadarChunk.get(), RadarActivatedChunk.get());
-            lngVoice[static_cast<int>(Voice_enum::RadarDeactivated) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(RadarChunk.get(), RadarDeactivatedChunk.get());
-        }
+        setVoice(Voice_enum::YouHaveFailedYourMission, {HouseString + "LOSE.VOC"});
 
-        { // Scope
-          // "Bloom located"
-            auto Bloom   = getChunkFromFile(HouseString + "BLOOM.VOC");
-            auto Located = getChunkFromFile(HouseString + "LOCATED.VOC");
-            lngVoice[static_cast<int>(Voice_enum::BloomLocated) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(Bloom.get(), Located.get());
-        }
+        // "Radar activated"/"Radar deactivated"
+        setVoice(Voice_enum::RadarActivated, {HouseString + "RADAR.VOC", HouseString + "ON.VOC"});
+        setVoice(Voice_enum::RadarDeactivated, {HouseString + "RADAR.VOC", HouseString + "OFF.VOC"});
 
-        { // Scope
-          // "Warning Wormsign"
-            auto WarningChunk  = getChunkFromFile(HouseString + "WARNING.VOC");
-            auto WormSignChunk = getChunkFromFile(HouseString + "WORMY.VOC");
-            lngVoice[static_cast<int>(Voice_enum::WarningWormSign) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(WarningChunk.get(), WormSignChunk.get());
-        }
+        // "Bloom located"
+        setVoice(Voice_enum::BloomLocated, {HouseString + "BLOOM.VOC", HouseString + "LOCATED.VOC"});
+
+        // "Warning Wormsign"
+        setVoice(Voice_enum::WarningWormSign, {HouseString + "WARNING.VOC", HouseString + "WORMY.VOC"});
 
         // "Our base is under attack"
-        lngVoice[static_cast<int>(Voice_enum::BaseIsUnderAttack) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile(HouseString + "ATTACK.VOC");
-
-        { // Scope
-          // "Saboteur approaching" and "Missile approaching"
-            auto SabotChunk       = getChunkFromFile(HouseString + "SABOT.VOC");
-            auto MissileChunk     = getChunkFromFile(HouseString + "MISSILE.VOC");
-            auto ApproachingChunk = getChunkFromFile(HouseString + "APPRCH.VOC");
-            lngVoice[static_cast<int>(Voice_enum::SaboteurApproaching) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(SabotChunk.get(), ApproachingChunk.get());
-            lngVoice[static_cast<int>(Voice_enum::MissileApproaching) * NUM_HOUSES + VoiceNum] =
-                concat2Chunks(MissileChunk.get(), ApproachingChunk.get());
-        }
+        setVoice(Voice_enum::BaseIsUnderAttack, {HouseString + "ATTACK.VOC"});
 
-        HouseNameChunk.reset();
+        // "Saboteur approaching" and "Missile approaching"
+        setVoice(Voice_enum::SaboteurApproaching, {HouseString + "SABOT.VOC", HouseString + "APPRCH.VOC"});
+        setVoice(Voice_enum::MissileApproaching, {HouseString + "MISSILE.VOC", HouseString + "APPRCH.VOC"});
 
         // "Yes Sir"
-        lngVoice[static_cast<int>(Voice_enum::YesSir) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("ZREPORT1.VOC", "REPORT1.VOC");
+        setVoice(Voice_enum::YesSir, {either("ZREPORT1.VOC", "REPORT1.VOC")});
 
         // "Reporting"
-        lngVoice[static_cast<int>(Voice_enum::Reporting) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("ZREPORT2.VOC", "REPORT2.VOC");
+        setVoice(Voice_enum::Reporting, {either("ZREPORT2.VOC", "REPORT2.VOC")});
 
         // "Acknowledged"
-        lngVoice[static_cast<int>(Voice_enum::Acknowledged) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("ZREPORT3.VOC", "REPORT3.VOC");
+        setVoice(Voice_enum::Acknowledged, {either("ZREPORT3.VOC", "REPORT3.VOC")});
 
         // "Affirmative"
-        lngVoice[static_cast<int>(Voice_enum::Affirmative) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("ZAFFIRM.VOC", "AFFIRM.VOC");
+        setVoice(Voice_enum::Affirmative, {either("ZAFFIRM.VOC", "AFFIRM.VOC")});
 
         // "Moving out"
-        lngVoice[static_cast<int>(Voice_enum::MovingOut) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("ZMOVEOUT.VOC", "MOVEOUT.VOC");
+        setVoice(Voice_enum::MovingOut, {either("ZMOVEOUT.VOC", "MOVEOUT.VOC")});
 
         // "Infantry out"
-        lngVoice[static_cast<int>(Voice_enum::InfantryOut) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("ZOVEROUT.VOC", "OVEROUT.VOC");
+        setVoice(Voice_enum::InfantryOut, {either("ZOVEROUT.VOC", "OVEROUT.VOC")});
 
         // "Something's under the sand"
-        lngVoice[static_cast<int>(Voice_enum::SomethingUnderTheSand) * NUM_HOUSES + VoiceNum] =
-            getChunkFromFile("SANDBUG.VOC");
+        setVoice(Voice_enum::SomethingUnderTheSand, {"SANDBUG.VOC"});
 
         // "House Harkonnen"
-        lngVoice[static_cast<int>(Voice_enum::HouseHarkonnen) * NUM_HOUSES + VoiceNum] = getChunkFromFile("MHARK.VOC");
+        setVoice(Voice_enum::HouseHarkonnen, {"MHARK.VOC"});
 
         // "House Atreides"
-        lngVoice[static_cast<int>(Voice_enum::HouseAtreides) * NUM_HOUSES + VoiceNum] = getChunkFromFile("MATRE.VOC");
+        setVoice(Voice_enum::HouseAtreides, {"MATRE.VOC"});
 
         // "House Ordos"
-        lngVoice[static_cast<int>(Voice_enum::HouseOrdos) * NUM_HOUSES + VoiceNum] = getChunkFromFile("MORDOS.VOC");
+        setVoice(Voice_enum::HouseOrdos, {"MORDOS.VOC"});
     }
 
-    const auto bad_voice = std::find(lngVoice.cbegin(), lngVoice.cend(), nullptr);
-
-    if (bad_voice != lngVoice.cend()) {
-        THROW(std::runtime_error, "Not all voice sounds could be loaded: lngVoice[%d] == nullptr!",
-              static_cast<int>(bad_voice - lngVoice.cbegin()));
-    }
+    checkVoiceFiles();
 
     loadSounds();
 }
@@ -266,101 +215,139 @@ Mix_Chunk* SFXManager::getEnglishVoice(Voice_enum id, HOUSETYPE house) const {
     if (voice_index < 0 || std::cmp_greater_equal(voice_index, lngVoice.size()))
         return nullptr;
 
-    return lngVoice[voice_index].get();
+    return getVoiceChunk(voice_index);
 }
 
 void SFXManager::loadNonEnglishVoice(const std::string& languagePrefix) {
-    lngVoice.clear();
-    lngVoice.resize(static_cast<int>(Voice_enum::NUM_VOICE));
+    voiceFiles_.clear();
+    voiceFiles_.resize(static_cast<int>(Voice_enum::NUM_VOICE));
+
+    const auto setVoice = [&](Voice_enum id, std::vector<std::string> files) {
+        voiceFiles_[static_cast<int>(id)] = std::move(files);
+    };
 
     // "Harvester deployed"
-    lngVoice[static_cast<int>(Voice_enum::HarvesterDeployed)] = getChunkFromFile(languagePrefix + "HARVEST.VOC");
+    setVoice(Voice_enum::HarvesterDeployed, {languagePrefix + "HARVEST.VOC"});
 
     // "Unit deployed"
-    lngVoice[static_cast<int>(Voice_enum::UnitDeployed)] = getChunkFromFile(languagePrefix + "DEPLOY.VOC");
+    setVoice(Voice_enum::UnitDeployed, {languagePrefix + "DEPLOY.VOC"});
 
     // "Unit launched"
-    lngVoice[static_cast<int>(Voice_enum::UnitLaunched)] = getChunkFromFile(languagePrefix + "VEHICLE.VOC");
+    setVoice(Voice_enum::UnitLaunched, {languagePrefix + "VEHICLE.VOC"});
 
     // "Construction complete"
-    lngVoice[static_cast<int>(Voice_enum::ConstructionComplete)] = getChunkFromFile(languagePrefix + "CONST.VOC");
+    setVoice(Voice_enum::ConstructionComplete, {languagePrefix + "CONST.VOC"});
 
     // "Vehicle repaired"
-    lngVoice[static_cast<int>(Voice_enum::VehicleRepaired)] = getChunkFromFile(languagePrefix + "REPAIR.VOC");
+    setVoice(Voice_enum::VehicleRepaired, {languagePrefix + "REPAIR.VOC"});
 
     // "Frigate has arrived"
-    lngVoice[static_cast<int>(Voice_enum::FrigateHasArrived)] = getChunkFromFile(languagePrefix + "FRIGATE.VOC");
+    setVoice(Voice_enum::FrigateHasArrived, {languagePrefix + "FRIGATE.VOC"});
 
     // "Your mission is complete" (No non-english voc available)
-    lngVoice[static_cast<int>(Voice_enum::YourMissionIsComplete)] = createEmptyChunk();
+    setVoice(Voice_enum::YourMissionIsComplete, {});
 
     // "You have failed your mission" (No non-english voc available)
-    lngVoice[static_cast<int>(Voice_enum::YouHaveFailedYourMission)] = createEmptyChunk();
+    setVoice(Voice_enum::YouHaveFailedYourMission, {});
 
     // "Radar activated"/"Radar deactivated"
-    lngVoice[static_cast<int>(Voice_enum::RadarActivated)]   = getChunkFromFile(languagePrefix + "ON.VOC");
-    lngVoice[static_cast<int>(Voice_enum::RadarDeactivated)] = getChunkFromFile(languagePrefix + "OFF.VOC");
+    setVoice(Voice_enum::RadarActivated, {languagePrefix + "ON.VOC"});
+    setVoice(Voice_enum::RadarDeactivated, {languagePrefix + "OFF.VOC"});
 
     // "Bloom located"
-    lngVoice[static_cast<int>(Voice_enum::BloomLocated)] = getChunkFromFile(languagePrefix + "BLOOM.VOC");
+    setVoice(Voice_enum::BloomLocated, {languagePrefix + "BLOOM.VOC"});
 
     // "Warning Wormsign"
     if (dune::globals::pFileManager->exists(languagePrefix + "WORMY.VOC")) {
-        const auto WarningChunk  = getChunkFromFile(languagePrefix + "WARNING.VOC");
-        const auto WormSignChunk = getChunkFromFile(languagePrefix + "WORMY.VOC");
-        lngVoice[static_cast<int>(Voice_enum::WarningWormSign)] =
-            concat2Chunks(WarningChunk.get(), WormSignChunk.get());
+        setVoice(Voice_enum::WarningWormSign, {languagePrefix + "WARNING.VOC", languagePrefix + "WORMY.VOC"});
     } else {
-        lngVoice[static_cast<int>(Voice_enum::WarningWormSign)] = getChunkFromFile(languagePrefix + "WARNING.VOC");
+        setVoice(Voice_enum::WarningWormSign, {languagePrefix + "WARNING.VOC"});
     }
 
     // "Our base is under attack"
-    lngVoice[static_cast<int>(Voice_enum::BaseIsUnderAttack)] = getChunkFromFile(languagePrefix + "ATTACK.VOC");
+    setVoice(Voice_enum::BaseIsUnderAttack, {languagePrefix + "ATTACK.VOC"});
 
     // "Saboteur approaching"
-    lngVoice[static_cast<int>(Voice_enum::SaboteurApproaching)] = getChunkFromFile(languagePrefix + "SABOT.VOC");
+    setVoice(Voice_enum::SaboteurApproaching, {languagePrefix + "SABOT.VOC"});
 
     // "Missile approaching"
-    lngVoice[static_cast<int>(Voice_enum::MissileApproaching)] = getChunkFromFile(languagePrefix + "MISSILE.VOC");
+    setVoice(Voice_enum::MissileApproaching, {languagePrefix + "MISSILE.VOC"});
 
     // "Yes Sir"
-    lngVoice[static_cast<int>(Voice_enum::YesSir)] = getChunkFromFile(languagePrefix + "REPORT1.VOC");
+    setVoice(Voice_enum::YesSir, {languagePrefix + "REPORT1.VOC"});
 
     // "Reporting"
-    lngVoice[static_cast<int>(Voice_enum::Reporting)] = getChunkFromFile(languagePrefix + "REPORT2.VOC");
+    setVoice(Voice_enum::Reporting, {languagePrefix + "REPORT2.VOC"});
 
     // "Acknowledged"
-    lngVoice[static_cast<int>(Voice_enum::Acknowledged)] = getChunkFromFile(languagePrefix + "REPORT3.VOC");
+    setVoice(Voice_enum::Acknowledged, {languagePrefix + "REPORT3.VOC"});
 
     // "Affirmative"
-    lngVoice[static_cast<int>(Voice_enum::Affirmative)] = getChunkFromFile(languagePrefix + "AFFIRM.VOC");
+    setVoice(Voice_enum::Affirmative, {languagePrefix + "AFFIRM.VOC"});
 
     // "Moving out"
-    lngVoice[static_cast<int>(Voice_enum::MovingOut)] = getChunkFromFile(languagePrefix + "MOVEOUT.VOC");
+    setVoice(Voice_enum::MovingOut, {languagePrefix + "MOVEOUT.VOC"});
 
     // "Infantry out"
-    lngVoice[static_cast<int>(Voice_enum::InfantryOut)] = getChunkFromFile(languagePrefix + "OVEROUT.VOC");
+    setVoice(Voice_enum::InfantryOut, {languagePrefix + "OVEROUT.VOC"});
 
     // "Something's under the sand"
-    lngVoice[static_cast<int>(Voice_enum::SomethingUnderTheSand)] = getChunkFromFile("SANDBUG.VOC");
+    setVoice(Voice_enum::SomethingUnderTheSand, {"SANDBUG.VOC"});
 
     // "House Atreides"
-    lngVoice[static_cast<int>(Voice_enum::HouseAtreides)] = getChunkFromFile(languagePrefix + "ATRE.VOC");
+    setVoice(Voice_enum::HouseAtreides, {languagePrefix + "ATRE.VOC"});
 
     // "House Ordos"
-    lngVoice[static_cast<int>(Voice_enum::HouseOrdos)] = getChunkFromFile(languagePrefix + "ORDOS.VOC");
+    setVoice(Voice_enum::HouseOrdos, {languagePrefix + "ORDOS.VOC"});
 
     // "House Harkonnen"
-    lngVoice[static_cast<int>(Voice_enum::HouseHarkonnen)] = getChunkFromFile(languagePrefix + "HARK.VOC");
+    setVoice(Voice_enum::HouseHarkonnen, {languagePrefix + "HARK.VOC"});
 
-    const auto bad_voice = std::find(lngVoice.cbegin(), lngVoice.cend(), nullptr);
+    checkVoiceFiles();
 
-    if (bad_voice != lngVoice.cend()) {
-        THROW(std::runtime_error, "Not all voice sounds could be loaded: lngVoice[%d] == nullptr!",
-              static_cast<int>(bad_voice - lngVoice.cbegin()));
+    loadSounds();
+}
+
+void SFXManager::checkVoiceFiles() {
+    const auto* const file_manager = dune::globals::pFileManager.get();
+
+    // The voices are only loaded when they are played for the first time, so at least make sure they can be loaded
+    for (const auto& files : voiceFiles_) {
+        for (const auto& filename : files) {
+            if (!file_manager->exists(filename))
+                THROW(std::runtime_error, "Not all voice sounds could be loaded: '%s' is missing!", filename);
+        }
     }
 
-    loadSounds();
+    lngVoice.clear();
+    lngVoice.resize(voiceFiles_.size());
+}
+
+Mix_Chunk* SFXManager::getVoiceChunk(int voice_index) const {
+    const std::lock_guard lock{voiceMutex_};
+
+    auto& voice = lngVoice[voice_index];
+
+    if (voice)
+        return voice.get();
+
+    const auto& files = voiceFiles_[voice_index];
+
+    std::vector<sdl2::mix_chunk_ptr> parts;
+    parts.reserve(files.size());
+
+    for (const auto& filename : files)
+        parts.emplace_back(getChunkFromFile(filename));
+
+    switch (parts.size()) {
+        case 0: voice = createEmptyChunk(); break;
+        case 1: voice = std::move(parts[0]); break;
+        case 2: voice = concat2Chunks(parts[0].get(), parts[1].get()); break;
+        case 3: voice = concat3Chunks(parts[0].get(), parts[1].get(), parts[2].get()); break;
+        default: voice = concat4Chunks(parts[0].get(), parts[1].get(), parts[2].get(), parts[3].get()); break;
+    }
+
+    return voice.get();
 }
 
 void SFXManager::loadSounds() {
@@ -413,5 +400,5 @@ Mix_Chunk* SFXManager::getNonEnglishVoice(Voice_enum id, [[maybe_unused]] HOUSET
     if (voice_index < 0 || std::cmp_greater_equal(voice_index, lngVoice.size()))
         return nullptr;
 
-    return lngVoice[voice_index].get();
+    return getVoiceChunk(voice_index);
 }
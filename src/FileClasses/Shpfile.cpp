@@ -29,6 +29,21 @@
 
 #include "globals.h"
 
+namespace {
+
+/// The data from p up to the end of the file, which bounds the compressed image data starting at p
+std::span<const unsigned char> dataFrom(const unsigned char* file, size_t filesize, const unsigned char* p) {
+    const auto offset = static_cast<size_t>(p - file);
+
+    if (offset > filesize) {
+        THROW(std::runtime_error, "Shpfile: The image data starts after the end of this *.shp-File!");
+    }
+
+    return {p, filesize - offset};
+}
+
+} // namespace
+
 /// Constructor
 /**
     The constructor reads from the rwop all data and saves them internally. The SDL_RWops can be readonly but must
@@ -93,7 +108,8 @@ sdl2::surface_ptr Shpfile::getPicture(uint32_t indexOfFile) {
             DecodeDestination.clear();
             DecodeDestination.resize(size);
 
-            if (decode80(Fileheader + 10, DecodeDestination.data(), size) == -1) {
+            const auto data = dataFrom(pFiledata.get(), shpFilesize, Fileheader + 10);
+            if (decode80(data, DecodeDestination, size) == -1) {
                 sdl2::log_info("Warning: Checksum-Error in Shp-File!");
             }
 
@@ -104,7 +120,8 @@ sdl2::surface_ptr Shpfile::getPicture(uint32_t indexOfFile) {
             DecodeDestination.clear();
             DecodeDestination.resize(size);
 
-            if (decode80(Fileheader + 10 + 16, DecodeDestination.data(), size) == -1) {
+            const auto data = dataFrom(pFiledata.get(), shpFilesize, Fileheader + 10 + 16);
+            if (decode80(data, DecodeDestination, size) == -1) {
                 sdl2::log_info("Warning: Checksum-Error in Shp-File!");
             }
 
@@ -234,7 +251,8 @@ Shpfile::getPictureArrayImpl(unsigned int tilesX, unsigned int tilesY, std::span
                     DecodeDestination.clear();
                     DecodeDestination.resize(size);
 
-                    if (decode80(Fileheader + 10, DecodeDestination.data(), size) == -1) {
+                    const auto data = dataFrom(pFiledata.get(), shpFilesize, Fileheader + 10);
+                    if (decode80(data, DecodeDestination, size) == -1) {
                         sdl2::log_info("Warning: Checksum-Error in Shp-File!");
                     }
 
@@ -245,7 +263,8 @@ Shpfile::getPictureArrayImpl(unsigned int tilesX, unsigned int tilesY, std::span
                     DecodeDestination.clear();
                     DecodeDestination.resize(size);
 
-                    if (decode80(Fileheader + 10 + 16, DecodeDestination.data(), size) == -1) {
+                    const auto data = dataFrom(pFiledata.get(), shpFilesize, Fileheader + 10 + 16);
+                    if (decode80(data, DecodeDestination, size) == -1) {
                         sdl2::log_info("Warning: Checksum-Error in Shp-File!");
                     }
 
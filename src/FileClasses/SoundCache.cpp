@@ -0,0 +1,268 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FileClasses/SoundCache.h>
+
+#include <globals.h>
+
+#include <FileClasses/FileManager.h>
+#include <FileClasses/Vocfile.h>
+
+#include <misc/dune_endian.h>
+#include <misc/exceptions.h>
+#include <misc/fnkdat.h>
+#include <misc/md5.h>
+
+#include <SDL2/SDL_endian.h>
+#include <SDL2/SDL_mixer.h>
+#include <SDL2/SDL_rwops.h>
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <system_error>
+
+namespace {
+inline constexpr uint32_t CACHE_MAGIC = 0x43534C44; // "DLSC"
+// Bump this whenever LoadVOC_RW() changes the way the samples are converted
+inline constexpr uint32_t CACHE_VERSION = 1;
+
+inline constexpr auto MD5_SIZE = size_t{16};
+
+bool write_uint32(SDL_RWops* rw, uint32_t value) {
+    return 1 == SDL_WriteLE32(rw, value);
+}
+
+bool write_bytes(SDL_RWops* rw, std::span<const uint8_t> bytes) {
+    return bytes.empty() || 1 == SDL_RWwrite(rw, bytes.data(), bytes.size(), 1);
+}
+
+bool read_uint32(std::span<const uint8_t> data, size_t& pos, uint32_t& value) {
+    if (data.size() - pos < sizeof value)
+        return false;
+
+    value = static_cast<uint32_t>(dune::read_le_uint32(data.data() + pos));
+    pos += sizeof value;
+    return true;
+}
+
+bool read_bytes(std::span<const uint8_t> data, size_t& pos, size_t length, std::span<const uint8_t>& bytes) {
+    if (data.size() - pos < length)
+        return false;
+
+    bytes = data.subspan(pos, length);
+    pos += length;
+    return true;
+}
+
+sdl2::mix_chunk_ptr createChunk(std::span<const uint8_t> samples) {
+    if (samples.empty())
+        return createEmptyChunk();
+
+    auto chunk = create_chunk();
+    if (chunk == nullptr)
+        throw std::bad_alloc();
+
+    sdl2::sdl_ptr<uint8_t> buffer{static_cast<uint8_t*>(SDL_malloc(samples.size()))};
+    if (buffer == nullptr)
+        throw std::bad_alloc();
+
+    memcpy(buffer.get(), samples.data(), samples.size());
+
+    chunk->allocated = 1;
+    chunk->volume    = MIX_MAX_VOLUME;
+    chunk->alen      = static_cast<Uint32>(samples.size());
+    chunk->abuf      = buffer.release();
+
+    return chunk;
+}
+} // namespace
+
+SoundCache::SoundCache() {
+    int frequency   = 0;
+    int channels    = 0;
+    uint16_t format = 0;
+    if (Mix_QuerySpec(&frequency, &format, &channels) == 0)
+        return;
+
+    key_ = fmt::format("frequency={};format={:#x};channels={}", frequency, format, channels);
+
+    auto [ok, cache_path] = fnkdat("cache/", FNKDAT_USER | FNKDAT_CREAT);
+
+    if (!ok)
+        return;
+
+    path_ = (cache_path / "sounds.cache").lexically_normal().make_preferred();
+
+    load();
+}
+
+SoundCache::~SoundCache() {
+    try {
+        save();
+    } catch (const std::exception& e) {
+        sdl2::log_warn("Unable to write the sound cache: %s", e.what());
+    }
+}
+
+sdl2::mix_chunk_ptr SoundCache::loadVOC(std::string_view filename) {
+    const auto rwop = dune::globals::pFileManager->openFile(filename);
+
+    const auto size = SDL_RWsize(rwop.get());
+    if (size <= 0)
+        THROW(io_error, "Cannot determine the size of '%s'!", filename);
+
+    std::vector<uint8_t> voc(static_cast<size_t>(size));
+    if (1 != SDL_RWread(rwop.get(), voc.data(), voc.size(), 1))
+        THROW(io_error, "Cannot read '%s'!", filename);
+
+    std::string md5sum(MD5_SIZE, '\0');
+    md5(voc.data(), voc.size(), reinterpret_cast<uint8_t*>(md5sum.data()));
+
+    if (!path_.empty()) {
+        const std::lock_guard lock{mutex_};
+
+        if (const auto it = entries_.find(md5sum); it != entries_.end())
+            return createChunk(it->second);
+    }
+
+    const sdl2::RWops_ptr voc_rwop{SDL_RWFromConstMem(voc.data(), static_cast<int>(voc.size()))};
+
+    auto chunk = LoadVOC_RW(voc_rwop.get());
+    if (chunk == nullptr)
+        THROW(io_error, "Cannot load '%s'!", filename);
+
+    if (!path_.empty()) {
+        const std::lock_guard lock{mutex_};
+
+        auto& samples = added_[md5sum];
+        samples.assign(chunk->abuf, chunk->abuf + chunk->alen);
+
+        entries_[md5sum] = samples;
+    }
+
+    return chunk;
+}
+
+void SoundCache::load() {
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path_, ec))
+        return;
+
+    try {
+        file_ = std::make_unique<dune::MappedFile>(path_);
+    } catch (const std::exception& e) {
+        sdl2::log_warn("Unable to open the sound cache: %s", e.what());
+        return;
+    }
+
+    const auto data = file_->data();
+    size_t pos      = 0;
+
+    uint32_t magic = 0, version = 0;
+    if (!read_uint32(data, pos, magic) || !read_uint32(data, pos, version) || magic != CACHE_MAGIC
+        || version != CACHE_VERSION) {
+        sdl2::log_info("Sound cache has an unknown version, rebuilding...");
+        file_.reset();
+        return;
+    }
+
+    uint32_t key_length = 0;
+    std::span<const uint8_t> key;
+    if (!read_uint32(data, pos, key_length) || !read_bytes(data, pos, key_length, key)
+        || std::string_view{reinterpret_cast<const char*>(key.data()), key.size()} != key_) {
+        sdl2::log_info("Sound cache does not match the audio device, rebuilding...");
+        file_.reset();
+        return;
+    }
+
+    uint32_t count = 0;
+    if (!read_uint32(data, pos, count)) {
+        file_.reset();
+        return;
+    }
+
+    for (auto i = 0u; i < count; ++i) {
+        std::span<const uint8_t> md5sum;
+        std::span<const uint8_t> samples;
+        uint32_t length = 0;
+
+        if (!read_bytes(data, pos, MD5_SIZE, md5sum) || !read_uint32(data, pos, length)
+            || !read_bytes(data, pos, length, samples)) {
+            sdl2::log_warn("Sound cache is truncated or corrupt, rebuilding...");
+            entries_.clear();
+            file_.reset();
+            return;
+        }
+
+        entries_.emplace(std::string{reinterpret_cast<const char*>(md5sum.data()), md5sum.size()}, samples);
+    }
+
+    sdl2::log_info("Found %u sounds in the sound cache", count);
+}
+
+void SoundCache::save() {
+    const std::lock_guard lock{mutex_};
+
+    if (path_.empty() || added_.empty())
+        return;
+
+    auto temp_path = path_;
+    temp_path += ".tmp";
+
+    { // Scope
+        const sdl2::RWops_ptr rw{SDL_RWFromFile(temp_path.u8string(), "wb")};
+        if (!rw) {
+            sdl2::log_warn("Unable to create the sound cache: %s", SDL_GetError());
+            return;
+        }
+
+        auto ok = write_uint32(rw.get(), CACHE_MAGIC) && write_uint32(rw.get(), CACHE_VERSION)
+               && write_uint32(rw.get(), static_cast<uint32_t>(key_.size()))
+               && write_bytes(rw.get(), {reinterpret_cast<const uint8_t*>(key_.data()), key_.size()})
+               && write_uint32(rw.get(), static_cast<uint32_t>(entries_.size()));
+
+        for (const auto& [md5sum, samples] : entries_) {
+            if (!ok)
+                break;
+
+            ok = write_bytes(rw.get(), {reinterpret_cast<const uint8_t*>(md5sum.data()), md5sum.size()})
+              && write_uint32(rw.get(), static_cast<uint32_t>(samples.size())) && write_bytes(rw.get(), samples);
+        }
+
+        if (!ok) {
+            sdl2::log_warn("Unable to write the sound cache");
+
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            return;
+        }
+    }
+
+    // The old cache has to be unmapped before it can be replaced
+    entries_.clear();
+    added_.clear();
+    file_.reset();
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path_, ec);
+
+    if (ec) {
+        sdl2::log_warn("Unable to replace the sound cache: %s", ec.message());
+        std::filesystem::remove(temp_path, ec);
+    }
+}
@@ -32,6 +32,7 @@
 #include <FileClasses/Wsafile.h>
 
 #include <misc/Scaler.h>
+#include <misc/ThreadPool.h>
 #include <misc/draw_util.h>
 #include <misc/exceptions.h>
 
@@ -243,58 +244,163 @@ SurfaceLoader::SurfaceLoader() {
 
     auto* const file_manager = dune::globals::pFileManager.get();
 
+    // The files are independent of each other, so they are decoded on a thread pool. Every result is collected from
+    // its future at a fixed place below, so the outcome does not depend on the order in which the tasks finish.
+    dune::ThreadPool pool;
+
+    const auto load_shp = [&](std::string filename) {
+        return pool.submit([this, filename = std::move(filename)] { return loadShpfile(filename); });
+    };
+
     // open all shp files
-    auto units   = loadShpfile("UNITS.SHP");
-    auto units1  = loadShpfile("UNITS1.SHP");
-    auto units2  = loadShpfile("UNITS2.SHP");
-    auto mouse   = loadShpfile("MOUSE.SHP");
-    auto shapes  = loadShpfile("SHAPES.SHP");
-    auto menshpa = loadShpfile("MENSHPA.SHP");
-    auto menshph = loadShpfile("MENSHPH.SHP");
-    auto menshpo = loadShpfile("MENSHPO.SHP");
-    auto menshpm = loadShpfile("MENSHPM.SHP");
-
-    std::unique_ptr<Shpfile> choam;
+    auto unitsTask   = load_shp("UNITS.SHP");
+    auto units1Task  = load_shp("UNITS1.SHP");
+    auto units2Task  = load_shp("UNITS2.SHP");
+    auto mouseTask   = load_shp("MOUSE.SHP");
+    auto shapesTask  = load_shp("SHAPES.SHP");
+    auto menshpaTask = load_shp("MENSHPA.SHP");
+    auto menshphTask = load_shp("MENSHPH.SHP");
+    auto menshpoTask = load_shp("MENSHPO.SHP");
+    auto menshpmTask = load_shp("MENSHPM.SHP");
+
+    std::future<std::unique_ptr<Shpfile>> choamTask;
 
     if (file_manager->exists("CHOAM." + _("LanguageFileExtension"))) {
-        choam = loadShpfile("CHOAM." + _("LanguageFileExtension"));
+        choamTask = load_shp("CHOAM." + _("LanguageFileExtension"));
     } else if (file_manager->exists("CHOAMSHP.SHP")) {
-        choam = loadShpfile("CHOAMSHP.SHP");
+        choamTask = load_shp("CHOAMSHP.SHP");
     } else {
         THROW(std::runtime_error,
               "SurfaceLoader::SurfaceLoader(): Cannot open CHOAMSHP.SHP or CHOAM." + _("LanguageFileExtension") + "!");
     }
 
-    std::unique_ptr<Shpfile> bttn;
+    std::future<std::unique_ptr<Shpfile>> bttnTask;
     if (file_manager->exists("BTTN." + _("LanguageFileExtension"))) {
-        bttn = loadShpfile("BTTN." + _("LanguageFileExtension"));
+        bttnTask = load_shp("BTTN." + _("LanguageFileExtension"));
     } else {
         // The US-Version has the buttons in SHAPES.SHP
         // => bttn == nullptr
     }
 
-    std::unique_ptr<Shpfile> mentat;
+    std::future<std::unique_ptr<Shpfile>> mentatTask;
     if (file_manager->exists("MENTAT." + _("LanguageFileExtension"))) {
-        mentat = loadShpfile("MENTAT." + _("LanguageFileExtension"));
+        mentatTask = load_shp("MENTAT." + _("LanguageFileExtension"));
     } else {
-        mentat = loadShpfile("MENTAT.SHP");
+        mentatTask = load_shp("MENTAT.SHP");
     }
 
-    auto pieces = loadShpfile("PIECES.SHP");
-    auto arrows = loadShpfile("ARROWS.SHP");
+    auto piecesTask = load_shp("PIECES.SHP");
+    auto arrowsTask = load_shp("ARROWS.SHP");
 
     // Load icon file
-    auto icon =
-        std::make_unique<Icnfile>(file_manager->openFile("ICON.ICN").get(), file_manager->openFile("ICON.MAP").get());
+    auto iconTask = pool.submit([file_manager] {
+        return std::make_unique<Icnfile>(file_manager->openFile("ICON.ICN").get(),
+                                         file_manager->openFile("ICON.MAP").get());
+    });
 
     // Load radar static
-    auto radar = loadWsafile("STATIC.WSA");
+    auto radarTask = pool.submit([this] { return loadWsafile("STATIC.WSA"); });
 
     // open bene palette
-    Palette benePalette = LoadPalette_RW(file_manager->openFile("BENE.PAL").get());
+    auto benePaletteTask =
+        pool.submit([file_manager] { return LoadPalette_RW(file_manager->openFile("BENE.PAL").get()); });
+
+    // The small detail pics and the large CPS pictures do not depend on anything above, so queue them right away
+    const auto load_cps = [&](std::string filename, DoubleSurfaceFunction* scale) {
+        return pool.submit([file_manager, filename = std::move(filename), scale] {
+            return scale(LoadCPS_RW(file_manager->openFile(filename).get()).get());
+        });
+    };
+
+    auto mentatBackgroundHarkonnenTask = load_cps("MENTATH.CPS", Scaler::defaultDoubleSurface);
+    auto mentatBackgroundAtreidesTask  = load_cps("MENTATA.CPS", Scaler::defaultDoubleSurface);
+    auto mentatBackgroundOrdosTask     = load_cps("MENTATO.CPS", Scaler::defaultDoubleSurface);
+    auto mentatBackgroundBeneTask      = load_cps("MENTATM.CPS", Scaler::defaultDoubleSurface);
+    auto mapChoicePlanetTask           = load_cps("PLANET.CPS", Scaler::doubleSurfaceNN);
+    auto mapChoiceMapOnlyTask          = load_cps("DUNEMAP.CPS", Scaler::doubleSurfaceNN);
+    auto mapChoiceMapTask              = load_cps("DUNERGN.CPS", Scaler::doubleSurfaceNN);
+    auto mapChoiceClickMapTask         = load_cps("RGNCLK.CPS", Scaler::doubleSurfaceNN);
+
+    std::array<std::future<sdl2::surface_ptr>, NUM_SMALLDETAILPICS> smallDetailTasks;
+
+    const auto load_small_detail = [&](SmallDetailPics_Enum id, std::string filename) {
+        smallDetailTasks[id] =
+            pool.submit([this, filename = std::move(filename)] { return extractSmallDetailPic(filename); });
+    };
+
+    load_small_detail(Picture_Barracks, "BARRAC.WSA");
+    load_small_detail(Picture_ConstructionYard, "CONSTRUC.WSA");
+    load_small_detail(Picture_Carryall, "CARRYALL.WSA");
+    load_small_detail(Picture_Devastator, "HARKTANK.WSA");
+    load_small_detail(Picture_Deviator, "ORDRTANK.WSA");
+    load_small_detail(Picture_DeathHand, "GOLD-BB.WSA");
+    load_small_detail(Picture_Fremen, "FREMEN.WSA");
+    if (file_manager->exists("FRIGATE.WSA")) {
+        load_small_detail(Picture_Frigate, "FRIGATE.WSA");
+    } else {
+        // US-Version 1.07 does not contain FRIGATE.WSA
+        // We replace it with the starport
+        load_small_detail(Picture_Frigate, "STARPORT.WSA");
+    }
+    load_small_detail(Picture_GunTurret, "TURRET.WSA");
+    load_small_detail(Picture_Harvester, "HARVEST.WSA");
+    load_small_detail(Picture_HeavyFactory, "HVYFTRY.WSA");
+    load_small_detail(Picture_HighTechFactory, "HITCFTRY.WSA");
+    load_small_detail(Picture_Soldier, "INFANTRY.WSA");
+    load_small_detail(Picture_IX, "IX.WSA");
+    load_small_detail(Picture_Launcher, "RTANK.WSA");
+    load_small_detail(Picture_LightFactory, "LITEFTRY.WSA");
+    load_small_detail(Picture_MCV, "MCV.WSA");
+    load_small_detail(Picture_Ornithopter, "ORNI.WSA");
+    load_small_detail(Picture_Palace, "PALACE.WSA");
+    load_small_detail(Picture_Quad, "QUAD.WSA");
+    load_small_detail(Picture_Radar, "HEADQRTS.WSA");
+    load_small_detail(Picture_RaiderTrike, "OTRIKE.WSA");
+    load_small_detail(Picture_Refinery, "REFINERY.WSA");
+    load_small_detail(Picture_RepairYard, "REPAIR.WSA");
+    load_small_detail(Picture_RocketTurret, "RTURRET.WSA");
+    load_small_detail(Picture_Saboteur, "SABOTURE.WSA");
+    load_small_detail(Picture_Sandworm, "WORM.WSA");
+    load_small_detail(Picture_Sardaukar, "SARDUKAR.WSA");
+    load_small_detail(Picture_SiegeTank, "HTANK.WSA");
+    load_small_detail(Picture_Silo, "STORAGE.WSA");
+    load_small_detail(Picture_Slab1, "SLAB.WSA");
+    load_small_detail(Picture_Slab4, "4SLAB.WSA");
+    load_small_detail(Picture_SonicTank, "STANK.WSA");
+    load_small_detail(Picture_StarPort, "STARPORT.WSA");
+    load_small_detail(Picture_Tank, "LTANK.WSA");
+    load_small_detail(Picture_Trike, "TRIKE.WSA");
+    load_small_detail(Picture_Trooper, "HYINFY.WSA");
+    load_small_detail(Picture_Wall, "WALL.WSA");
+    load_small_detail(Picture_WindTrap, "WINDTRAP.WSA");
+    load_small_detail(Picture_WOR, "WOR.WSA");
+    // unused: FARTR.WSA, FHARK.WSA, FORDOS.WSA
+
+    auto units   = unitsTask.get();
+    auto units1  = units1Task.get();
+    auto units2  = units2Task.get();
+    auto mouse   = mouseTask.get();
+    auto shapes  = shapesTask.get();
+    auto menshpa = menshpaTask.get();
+    auto menshph = menshphTask.get();
+    auto menshpo = menshpoTask.get();
+    auto menshpm = menshpmTask.get();
+    auto choam   = choamTask.get();
+
+    std::unique_ptr<Shpfile> bttn;
+    if (bttnTask.valid())
+        bttn = bttnTask.get();
+
+    auto mentat      = mentatTask.get();
+    auto pieces      = piecesTask.get();
+    auto arrows      = arrowsTask.get();
+    auto icon        = iconTask.get();
+    auto radar       = radarTask.get();
+    auto benePalette = benePaletteTask.get();
 
     const auto elapsed = std::chrono::steady_clock::now() - start;
-    sdl2::log_info("SurfaceLoader load time: %f", std::chrono::duration<double>(elapsed).count());
+    sdl2::log_info("SurfaceLoader load time: %f (%u threads)", std::chrono::duration<double>(elapsed).count(),
+                   pool.size());
 
     constexpr auto harkIdx = static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN);
 
@@ -419,84 +525,20 @@ SurfaceLoader::SurfaceLoader() {
     SDL_SetPaletteColors(objPic[ObjPic_Terrain_HiddenFog][harkIdx][0]->format->palette, &fogTransparent, PALCOLOR_BLACK,
                          1);
 
-    // scale obj pics and apply color key
+    // apply color key; the scaled zoom levels are generated on first use (see generateZoomedObjPics())
     for (int id = 0; id < NUM_OBJPICS; id++) {
         for (int h = 0; h < NUM_HOUSES; h++) {
             if (objPic[id][h][0] != nullptr) {
-                if (objPic[id][h][1] == nullptr) {
-                    objPic[id][h][1] = generateDoubledObjPic(id, h);
-                }
-                SDL_SetColorKey(objPic[id][h][1].get(), SDL_TRUE, PALCOLOR_TRANSPARENT);
-
-                if (objPic[id][h][2] == nullptr) {
-                    objPic[id][h][2] = generateTripledObjPic(id, h);
-                }
-                SDL_SetColorKey(objPic[id][h][2].get(), SDL_TRUE, PALCOLOR_TRANSPARENT);
-
                 SDL_SetColorKey(objPic[id][h][0].get(), SDL_TRUE, PALCOLOR_TRANSPARENT);
             }
         }
     }
 
-    objPic[ObjPic_CarryallShadow][harkIdx][0]    = createShadowSurface(objPic[ObjPic_Carryall][harkIdx][0].get());
-    objPic[ObjPic_CarryallShadow][harkIdx][1]    = createShadowSurface(objPic[ObjPic_Carryall][harkIdx][1].get());
-    objPic[ObjPic_CarryallShadow][harkIdx][2]    = createShadowSurface(objPic[ObjPic_Carryall][harkIdx][2].get());
-    objPic[ObjPic_FrigateShadow][harkIdx][0]     = createShadowSurface(objPic[ObjPic_Frigate][harkIdx][0].get());
-    objPic[ObjPic_FrigateShadow][harkIdx][1]     = createShadowSurface(objPic[ObjPic_Frigate][harkIdx][1].get());
-    objPic[ObjPic_FrigateShadow][harkIdx][2]     = createShadowSurface(objPic[ObjPic_Frigate][harkIdx][2].get());
-    objPic[ObjPic_OrnithopterShadow][harkIdx][0] = createShadowSurface(objPic[ObjPic_Ornithopter][harkIdx][0].get());
-    objPic[ObjPic_OrnithopterShadow][harkIdx][1] = createShadowSurface(objPic[ObjPic_Ornithopter][harkIdx][1].get());
-    objPic[ObjPic_OrnithopterShadow][harkIdx][2] = createShadowSurface(objPic[ObjPic_Ornithopter][harkIdx][2].get());
-
-    // load small detail pics
-    smallDetailPic[Picture_Barracks]         = extractSmallDetailPic("BARRAC.WSA");
-    smallDetailPic[Picture_ConstructionYard] = extractSmallDetailPic("CONSTRUC.WSA");
-    smallDetailPic[Picture_Carryall]         = extractSmallDetailPic("CARRYALL.WSA");
-    smallDetailPic[Picture_Devastator]       = extractSmallDetailPic("HARKTANK.WSA");
-    smallDetailPic[Picture_Deviator]         = extractSmallDetailPic("ORDRTANK.WSA");
-    smallDetailPic[Picture_DeathHand]        = extractSmallDetailPic("GOLD-BB.WSA");
-    smallDetailPic[Picture_Fremen]           = extractSmallDetailPic("FREMEN.WSA");
-    if (file_manager->exists("FRIGATE.WSA")) {
-        smallDetailPic[Picture_Frigate] = extractSmallDetailPic("FRIGATE.WSA");
-    } else {
-        // US-Version 1.07 does not contain FRIGATE.WSA
-        // We replace it with the starport
-        smallDetailPic[Picture_Frigate] = extractSmallDetailPic("STARPORT.WSA");
+    // collect the small detail pics
+    for (auto i = 0; i < NUM_SMALLDETAILPICS; ++i) {
+        if (smallDetailTasks[i].valid())
+            smallDetailPic[i] = smallDetailTasks[i].get();
     }
-    smallDetailPic[Picture_GunTurret]       = extractSmallDetailPic("TURRET.WSA");
-    smallDetailPic[Picture_Harvester]       = extractSmallDetailPic("HARVEST.WSA");
-    smallDetailPic[Picture_HeavyFactory]    = extractSmallDetailPic("HVYFTRY.WSA");
-    smallDetailPic[Picture_HighTechFactory] = extractSmallDetailPic("HITCFTRY.WSA");
-    smallDetailPic[Picture_Soldier]         = extractSmallDetailPic("INFANTRY.WSA");
-    smallDetailPic[Picture_IX]              = extractSmallDetailPic("IX.WSA");
-    smallDetailPic[Picture_Launcher]        = extractSmallDetailPic("RTANK.WSA");
-    smallDetailPic[Picture_LightFactory]    = extractSmallDetailPic("LITEFTRY.WSA");
-    smallDetailPic[Picture_MCV]             = extractSmallDetailPic("MCV.WSA");
-    smallDetailPic[Picture_Ornithopter]     = extractSmallDetailPic("ORNI.WSA");
-    smallDetailPic[Picture_Palace]          = extractSmallDetailPic("PALACE.WSA");
-    smallDetailPic[Picture_Quad]            = extractSmallDetailPic("QUAD.WSA");
-    smallDetailPic[Picture_Radar]           = extractSmallDetailPic("HEADQRTS.WSA");
-    smallDetailPic[Picture_RaiderTrike]     = extractSmallDetailPic("OTRIKE.WSA");
-    smallDetailPic[Picture_Refinery]        = extractSmallDetailPic("REFINERY.WSA");
-    smallDetailPic[Picture_RepairYard]      = extractSmallDetailPic("REPAIR.WSA");
-    smallDetailPic[Picture_RocketTurret]    = extractSmallDetailPic("RTURRET.WSA");
-    smallDetailPic[Picture_Saboteur]        = extractSmallDetailPic("SABOTURE.WSA");
-    smallDetailPic[Picture_Sandworm]        = extractSmallDetailPic("WORM.WSA");
-    smallDetailPic[Picture_Sardaukar]       = extractSmallDetailPic("SARDUKAR.WSA");
-    smallDetailPic[Picture_SiegeTank]       = extractSmallDetailPic("HTANK.WSA");
-    smallDetailPic[Picture_Silo]            = extractSmallDetailPic("STORAGE.WSA");
-    smallDetailPic[Picture_Slab1]           = extractSmallDetailPic("SLAB.WSA");
-    smallDetailPic[Picture_Slab4]           = extractSmallDetailPic("4SLAB.WSA");
-    smallDetailPic[Picture_SonicTank]       = extractSmallDetailPic("STANK.WSA");
-    smallDetailPic[Picture_Special]         = nullptr;
-    smallDetailPic[Picture_StarPort]        = extractSmallDetailPic("STARPORT.WSA");
-    smallDetailPic[Picture_Tank]            = extractSmallDetailPic("LTANK.WSA");
-    smallDetailPic[Picture_Trike]           = extractSmallDetailPic("TRIKE.WSA");
-    smallDetailPic[Picture_Trooper]         = extractSmallDetailPic("HYINFY.WSA");
-    smallDetailPic[Picture_Wall]            = extractSmallDetailPic("WALL.WSA");
-    smallDetailPic[Picture_WindTrap]        = extractSmallDetailPic("WINDTRAP.WSA");
-    smallDetailPic[Picture_WOR]             = extractSmallDetailPic("WOR.WSA");
-    // unused: FARTR.WSA, FHARK.WSA, FORDOS.WSA
 
     tinyPicture[TinyPicture_Spice]            = shapes->getPicture(94);
     tinyPicture[TinyPicture_Barracks]         = shapes->getPicture(62);
@@ -710,13 +752,10 @@ SurfaceLoader::SurfaceLoader() {
 
     picFactory.drawFrame(uiGraphic[UI_DuneLegacy][harkIdx].get(), DecorationFrame::SimpleFrame);
 
-    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] =
-        Scaler::defaultDoubleSurface(LoadCPS_RW(file_manager->openFile("MENTATH.CPS").get()).get());
-    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_ATREIDES)] =
-        Scaler::defaultDoubleSurface(LoadCPS_RW(file_manager->openFile("MENTATA.CPS").get()).get());
-    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_ORDOS)] =
-        Scaler::defaultDoubleSurface(LoadCPS_RW(file_manager->openFile("MENTATO.CPS").get()).get());
-    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_FREMEN)] =
+    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] = mentatBackgroundHarkonnenTask.get();
+    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_ATREIDES)]  = mentatBackgroundAtreidesTask.get();
+    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_ORDOS)]     = mentatBackgroundOrdosTask.get();
+    uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_FREMEN)]    =
         PictureFactory::mapMentatSurfaceToFremen(
             uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_ATREIDES)].get());
     uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_SARDAUKAR)] =
@@ -726,8 +765,7 @@ SurfaceLoader::SurfaceLoader() {
         PictureFactory::mapMentatSurfaceToMercenary(
             uiGraphic[UI_MentatBackground][static_cast<int>(HOUSETYPE::HOUSE_ORDOS)].get());
 
-    uiGraphic[UI_MentatBackgroundBene][harkIdx] =
-        Scaler::defaultDoubleSurface(LoadCPS_RW(file_manager->openFile("MENTATM.CPS").get()).get());
+    uiGraphic[UI_MentatBackgroundBene][harkIdx] = mentatBackgroundBeneTask.get();
     if (uiGraphic[UI_MentatBackgroundBene][harkIdx] != nullptr) {
         benePalette.applyToSurface(uiGraphic[UI_MentatBackgroundBene][harkIdx].get());
     }
@@ -840,14 +878,11 @@ SurfaceLoader::SurfaceLoader() {
         picFactory.createMapChoiceScreen(HOUSETYPE::HOUSE_SARDAUKAR);
     uiGraphic[UI_MapChoiceScreen][static_cast<int>(HOUSETYPE::HOUSE_MERCENARY)] =
         picFactory.createMapChoiceScreen(HOUSETYPE::HOUSE_MERCENARY);
-    uiGraphic[UI_MapChoicePlanet][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] =
-        Scaler::doubleSurfaceNN(LoadCPS_RW(file_manager->openFile("PLANET.CPS").get()).get());
+    uiGraphic[UI_MapChoicePlanet][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] = mapChoicePlanetTask.get();
     SDL_SetColorKey(uiGraphic[UI_MapChoicePlanet][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)].get(), SDL_TRUE, 0);
-    uiGraphic[UI_MapChoiceMapOnly][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] =
-        Scaler::doubleSurfaceNN(LoadCPS_RW(file_manager->openFile("DUNEMAP.CPS").get()).get());
+    uiGraphic[UI_MapChoiceMapOnly][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] = mapChoiceMapOnlyTask.get();
     SDL_SetColorKey(uiGraphic[UI_MapChoiceMapOnly][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)].get(), SDL_TRUE, 0);
-    uiGraphic[UI_MapChoiceMap][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] =
-        Scaler::doubleSurfaceNN(LoadCPS_RW(file_manager->openFile("DUNERGN.CPS").get()).get());
+    uiGraphic[UI_MapChoiceMap][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] = mapChoiceMapTask.get();
     SDL_SetColorKey(uiGraphic[UI_MapChoiceMap][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)].get(), SDL_TRUE, 0);
 
     // make black lines inside the map non-transparent
@@ -865,8 +900,7 @@ SurfaceLoader::SurfaceLoader() {
         }
     }
 
-    uiGraphic[UI_MapChoiceClickMap][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] =
-        Scaler::doubleSurfaceNN(LoadCPS_RW(file_manager->openFile("RGNCLK.CPS").get()).get());
+    uiGraphic[UI_MapChoiceClickMap][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] = mapChoiceClickMapTask.get();
     uiGraphic[UI_MapChoiceArrow_None][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)] =
         Scaler::defaultDoubleSurface(arrows->getPicture(0).get());
     SDL_SetColorKey(uiGraphic[UI_MapChoiceArrow_None][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)].get(), SDL_TRUE, 0);
@@ -1196,50 +1230,6 @@ SurfaceLoader::SurfaceLoader() {
     // pBackgroundSurface is separate as we never draw it but use it to construct other sprites
     pBackgroundSurface = convertSurfaceToDisplayFormat(picFactory.createBackground().get());
 
-    { // Scope
-        auto replace_color = [&](ObjPic_enum id, HOUSETYPE house, int zoom, uint32_t oldColor, uint32_t newColor) {
-            auto display_surface = convertSurfaceToDisplayFormat(getZoomedObjSurface(id, house, zoom));
-
-            replaceColor(display_surface.get(), oldColor, newColor);
-
-            if (SDL_SetSurfaceBlendMode(display_surface.get(), SDL_BlendMode::SDL_BLENDMODE_BLEND))
-                THROW(std::runtime_error,
-                      std::string("SurfaceLoader(): SDL_SetSurfaceBlendMode() failed: ") + std::string(SDL_GetError()));
-
-            objPic[static_cast<int>(id)][static_cast<int>(house)][zoom] = std::move(display_surface);
-        };
-
-        for (auto zoom = 0; zoom < NUM_ZOOMLEVEL; ++zoom) {
-            for (auto h = 0; h < NUM_HOUSES; ++h) {
-                const auto house = static_cast<HOUSETYPE>(h);
-
-                // Create the per-house Windtrap surfaces
-                (void)getZoomedObjSurface(static_cast<unsigned int>(ObjPic_Windtrap), house, zoom);
-
-                replace_color(ObjPic_CarryallShadow, house, zoom, COLOR_BLACK, COLOR_SHADOW_TRANSPARENT);
-                replace_color(ObjPic_FrigateShadow, house, zoom, COLOR_BLACK, COLOR_SHADOW_TRANSPARENT);
-                replace_color(ObjPic_OrnithopterShadow, house, zoom, COLOR_BLACK, COLOR_SHADOW_TRANSPARENT);
-            }
-        }
-
-        for (auto zoom = 0; zoom < NUM_ZOOMLEVEL; ++zoom) {
-            for (auto h = 0; h < NUM_HOUSES; ++h) {
-                const auto house = static_cast<HOUSETYPE>(h);
-
-                auto& windtrap = objPic[ObjPic_Windtrap][h][zoom];
-
-                if (!windtrap)
-                    THROW(std::runtime_error,
-                          fmt::format("SurfaceLoader(): Windtrap for house {} and zoom {} does not exist!", h, zoom));
-
-                // Windtrap uses palette animation on PALCOLOR_WINDTRAP_COLORCYCLE; fake this
-                windtrap = generateWindtrapAnimationFrames(windtrap.get());
-
-                replace_color(ObjPic_Windtrap, house, zoom, COLOR_BLACK, COLOR_FOG_TRANSPARENT);
-            }
-        }
-    }
-
     // Create map choice arrows
     { // Scope
         for (auto id = UI_MapChoiceArrow_None; id <= UI_MapChoiceArrow_Left;
@@ -1267,16 +1257,27 @@ SurfaceLoader::SurfaceLoader() {
 
     for (auto i = 0; i < NUM_DECORATIONFRAMES; ++i)
         frame_[i] = picFactory.createBorderStyle(static_cast<DecorationFrame>(i));
+
+    for (auto id = 0u; id < NUM_OBJPICS; ++id) {
+        for (auto h = 0; h < NUM_HOUSES; ++h) {
+            if (objPic[id][h][0] != nullptr)
+                loadedObjPics_.emplace_back(id, h);
+        }
+    }
 }
 
 SurfaceLoader::~SurfaceLoader() = default;
 
 SDL_Surface* SurfaceLoader::getZoomedObjSurface(unsigned int id, HOUSETYPE house, unsigned int z) {
-    if (id >= NUM_OBJPICS) {
-        THROW(std::invalid_argument, "SurfaceLoader::getZoomedObjSurface(): Unit Picture with ID %u is not available!",
-              id);
+    if (id >= NUM_OBJPICS || z >= NUM_ZOOMLEVEL) {
+        THROW(std::invalid_argument,
+              "SurfaceLoader::getZoomedObjSurface(): Unit Picture with ID %u and zoom %u is not available!", id, z);
     }
 
+    std::lock_guard lock{objPicMutex_};
+
+    generateZoomedObjPics(z);
+
     const auto idx = static_cast<int>(house);
 
     auto& surface = objPic[id][idx][z];
@@ -1289,11 +1290,84 @@ SDL_Surface* SurfaceLoader::getZoomedObjSurface(unsigned int id, HOUSETYPE house
             THROW(std::runtime_error, "SurfaceLoader::getZoomedObjPic(): Unit Picture with ID %u is not loaded!", id);
         }
 
-        surface = mapSurfaceColorRange(objPic[id][harkonnen][z].get(), PALCOLOR_HARKONNEN,
-                                       dune::globals::houseToPaletteIndex[idx]);
+        // The house colored picture shares the pixels of the Harkonnen picture and only has a remapped palette
+        surface = mapSurfacePaletteColorRange(objPic[id][harkonnen][z].get(), PALCOLOR_HARKONNEN,
+                                              dune::globals::houseToPaletteIndex[idx]);
+    }
+
+    if (id != ObjPic_Windtrap && id != ObjPic_CarryallShadow && id != ObjPic_FrigateShadow
+        && id != ObjPic_OrnithopterShadow)
+        return surface.get();
+
+    auto& display_surface = displayObjPic_[id][idx][z];
+
+    if (display_surface == nullptr)
+        display_surface = createDisplayObjPic(id, surface.get());
+
+    return display_surface.get();
+}
+
+void SurfaceLoader::generateZoomedObjPics(unsigned int z) {
+    if (zoomedObjPicsGenerated_[z])
+        return;
+
+    zoomedObjPicsGenerated_[z] = true;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    constexpr auto harkIdx = static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN);
+
+    // scale obj pics and apply color key
+    if (z > 0) {
+        // Each task only reads its own source picture, so they can all run at once.
+        dune::ThreadPool pool;
+
+        std::vector<std::tuple<unsigned int, int, std::future<sdl2::surface_ptr>>> tasks;
+
+        for (const auto& [id, h] : loadedObjPics_) {
+            if (objPic[id][h][z] != nullptr)
+                continue;
+
+            tasks.emplace_back(id, h, pool.submit([this, id, h, z] {
+                return z == 1 ? generateDoubledObjPic(id, h) : generateTripledObjPic(id, h);
+            }));
+        }
+
+        for (auto& [id, h, task] : tasks)
+            objPic[id][h][z] = task.get();
+
+        for (const auto& [id, h] : loadedObjPics_)
+            SDL_SetColorKey(objPic[id][h][z].get(), SDL_TRUE, PALCOLOR_TRANSPARENT);
+    }
+
+    objPic[ObjPic_CarryallShadow][harkIdx][z]    = createShadowSurface(objPic[ObjPic_Carryall][harkIdx][z].get());
+    objPic[ObjPic_FrigateShadow][harkIdx][z]     = createShadowSurface(objPic[ObjPic_Frigate][harkIdx][z].get());
+    objPic[ObjPic_OrnithopterShadow][harkIdx][z] = createShadowSurface(objPic[ObjPic_Ornithopter][harkIdx][z].get());
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    sdl2::log_info("SurfaceLoader zoom level %u object pictures time: %f", z,
+                   std::chrono::duration<double>(elapsed).count());
+}
+
+sdl2::surface_ptr SurfaceLoader::createDisplayObjPic(unsigned int id, SDL_Surface* surface) const {
+    sdl2::surface_ptr display_surface;
+
+    if (id == ObjPic_Windtrap) {
+        // Windtrap uses palette animation on PALCOLOR_WINDTRAP_COLORCYCLE; fake this
+        display_surface = convertSurfaceToDisplayFormat(generateWindtrapAnimationFrames(surface).get());
+
+        replaceColor(display_surface.get(), COLOR_BLACK, COLOR_FOG_TRANSPARENT);
+    } else {
+        display_surface = convertSurfaceToDisplayFormat(surface);
+
+        replaceColor(display_surface.get(), COLOR_BLACK, COLOR_SHADOW_TRANSPARENT);
     }
 
-    return surface.get();
+    if (SDL_SetSurfaceBlendMode(display_surface.get(), SDL_BlendMode::SDL_BLENDMODE_BLEND))
+        THROW(std::runtime_error,
+              std::string("SurfaceLoader(): SDL_SetSurfaceBlendMode() failed: ") + std::string(SDL_GetError()));
+
+    return display_surface;
 }
 
 SDL_Surface* SurfaceLoader::getSmallDetailSurface(unsigned int id) {
@@ -1346,9 +1420,9 @@ SDL_Surface* SurfaceLoader::getMapChoicePieceSurface(unsigned int num, HOUSETYPE
                   "SurfaceLoader::getMapChoicePieceSurface(): Map Piece with number %u is not loaded!", num);
         }
 
-        mapChoicePieces[num][static_cast<int>(house)] =
-            mapSurfaceColorRange(mapChoicePieces[num][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)].get(),
-                                 PALCOLOR_HARKONNEN, dune::globals::houseToPaletteIndex[static_cast<int>(house)]);
+        mapChoicePieces[num][static_cast<int>(house)] = mapSurfacePaletteColorRange(
+            mapChoicePieces[num][static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN)].get(), PALCOLOR_HARKONNEN,
+            dune::globals::houseToPaletteIndex[static_cast<int>(house)]);
     }
 
     return mapChoicePieces[num][static_cast<int>(house)].get();
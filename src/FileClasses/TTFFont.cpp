@@ -69,3 +69,27 @@ int TTFFont::getTextWidth(std::string_view text) const {
 
     return width;
 }
+
+// The Uint16 glyph functions are available in every SDL2_ttf version we support, so the glyphs are limited to the
+// basic multilingual plane.
+bool TTFFont::hasGlyph(char32_t ch) const {
+    return ch <= 0xFFFF && TTF_GlyphIsProvided(pTTFFont.get(), static_cast<Uint16>(ch)) != 0;
+}
+
+Font::GlyphMetrics TTFFont::getGlyphMetrics(char32_t ch) const {
+    int minX    = 0;
+    int advance = 0;
+    if (TTF_GlyphMetrics(pTTFFont.get(), static_cast<Uint16>(ch), &minX, nullptr, nullptr, nullptr, &advance) < 0) {
+        THROW(std::invalid_argument, "TTFFont::getGlyphMetrics(): TTF_GlyphMetrics() failed: %s!", TTF_GetError());
+    }
+
+    return {minX, advance};
+}
+
+int TTFFont::getKerning(char32_t previous, char32_t ch) const {
+    return TTF_GetFontKerningSizeGlyphs(pTTFFont.get(), static_cast<Uint16>(previous), static_cast<Uint16>(ch));
+}
+
+sdl2::surface_ptr TTFFont::createGlyphSurface(char32_t ch) const {
+    return sdl2::surface_ptr{TTF_RenderGlyph_Blended(pTTFFont.get(), static_cast<Uint16>(ch), RGBA2SDL(COLOR_WHITE))};
+}
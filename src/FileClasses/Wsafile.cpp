@@ -138,26 +138,32 @@ Wsafile::getAnimation(unsigned int startindex, unsigned int endindex, bool bDoub
 /// Helper method to decode one frame
 /**
     This helper method decodes one frame.
-    \param  pFiledata       Pointer to the data of this wsa-File
+    \param  filedata        The data of this wsa-File
     \param  index           Array with startoffsets
     \param  numberOfFrames  Number of frames to decode
     \param  pDecodedFrames  memory to copy decoded frames to (must be x*y*NumberOfFrames bytes long)
     \param  x               x-dimension of one frame
     \param  y               y-dimension of one frame
 */
-void Wsafile::decodeFrames(const unsigned char* pFiledata, uint32_t* index, int numberOfFrames,
+void Wsafile::decodeFrames(std::span<const unsigned char> filedata, const uint32_t* index, int numberOfFrames,
                            unsigned char* pDecodedFrames, int x, int y) const {
-    for (auto i = ptrdiff_t{0}; i < ptrdiff_t{numberOfFrames}; ++i) {
-        auto dec80 = std::make_unique<unsigned char[]>(static_cast<size_t>(x) * y * 2);
+    const auto frameSize = static_cast<size_t>(x) * y;
+
+    std::vector<unsigned char> dec80(frameSize * 2);
 
-        decode80(pFiledata + SDL_SwapLE32(index[i]), dec80.get(), 0);
+    for (auto i = ptrdiff_t{0}; i < ptrdiff_t{numberOfFrames}; ++i) {
+        const auto offset = SDL_SwapLE32(index[i]);
+        if (offset > filedata.size()) {
+            THROW(std::runtime_error, "Wsafile::decodeFrames(): No valid WSA-File: Frame %d is outside of the file!",
+                  i);
+        }
 
-        decode40(dec80.get(), pDecodedFrames + i * x * y);
+        decode80(filedata.subspan(offset), dec80, 0);
 
-        dec80.reset();
+        decode40(dec80, {pDecodedFrames + i * frameSize, frameSize});
 
         if (i < numberOfFrames - 1) {
-            memcpy(pDecodedFrames + (i + 1) * x * y, pDecodedFrames + i * x * y, ptrdiff_t{x} * y);
+            memcpy(pDecodedFrames + (i + 1) * frameSize, pDecodedFrames + i * frameSize, frameSize);
         }
     }
 }
@@ -207,6 +213,7 @@ void Wsafile::readdata(const std::initializer_list<SDL_RWops*>& rwops) {
     const auto numFiles = rwops.size();
 
     std::vector<std::unique_ptr<unsigned char[]>> pFiledata(numFiles);
+    std::vector<int> filesizes(numFiles);
     std::vector<uint32_t*> index(numFiles);
     std::vector<uint16_t> numberOfFrames(numFiles);
     std::vector<bool> extended(numFiles);
@@ -217,6 +224,7 @@ void Wsafile::readdata(const std::initializer_list<SDL_RWops*>& rwops) {
     for (auto i = size_t{0}; auto rwop : rwops) {
         int wsaFilesize   = 0;
         pFiledata[i]      = readfile(rwop, &wsaFilesize);
+        filesizes[i]      = wsaFilesize;
         numberOfFrames[i] = SDL_SwapLE16(*reinterpret_cast<Uint16*>(pFiledata[i].get()));
 
         if (i == 0) {
@@ -274,7 +282,8 @@ void Wsafile::readdata(const std::initializer_list<SDL_RWops*>& rwops) {
     decodedFrames.resize(static_cast<size_t>(sizeX) * static_cast<size_t>(sizeY) * numFrames);
 
     assert(decodedFrames.size() >= static_cast<size_t>(sizeX) * sizeY);
-    decodeFrames(pFiledata[0].get(), index[0], numberOfFrames[0], decodedFrames.data(), sizeX, sizeY);
+    decodeFrames({pFiledata[0].get(), static_cast<size_t>(filesizes[0])}, index[0], numberOfFrames[0],
+                 decodedFrames.data(), sizeX, sizeY);
     pFiledata[0].reset();
 
     if (numFiles > 1) {
@@ -288,7 +297,8 @@ void Wsafile::readdata(const std::initializer_list<SDL_RWops*>& rwops) {
                        static_cast<size_t>(sizeX) * static_cast<size_t>(sizeY));
             }
             assert(nextFreeFrame + static_cast<ptrdiff_t>(sizeX) * sizeY <= &decodedFrames.back());
-            decodeFrames(pFiledata[i].get(), index[i], numberOfFrames[i], nextFreeFrame, sizeX, sizeY);
+            decodeFrames({pFiledata[i].get(), static_cast<size_t>(filesizes[i])}, index[i], numberOfFrames[i],
+                         nextFreeFrame, sizeX, sizeY);
             nextFreeFrame += static_cast<ptrdiff_t>(numberOfFrames[i]) * sizeX * sizeY;
             pFiledata[i].reset();
         }
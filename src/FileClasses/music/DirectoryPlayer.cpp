@@ -49,8 +49,6 @@ DirectoryPlayer::DirectoryPlayer()
         musicFileList[i] = getMusicFileNames(configfilepath / musicDirectoryNames[i]);
     }
 
-    music = nullptr;
-
 #if SDL_VERSIONNUM(SDL_MIXER_MAJOR_VERSION, SDL_MIXER_MINOR_VERSION, SDL_MIXER_PATCHLEVEL) >= SDL_VERSIONNUM(2, 0, 2)
     Mix_Init(MIX_INIT_MID | MIX_INIT_FLAC | MIX_INIT_MP3 | MIX_INIT_OGG);
 #else
@@ -59,63 +57,95 @@ DirectoryPlayer::DirectoryPlayer()
 }
 
 DirectoryPlayer::~DirectoryPlayer() {
-    if (music != nullptr) {
-        Mix_FreeMusic(music);
-        music = nullptr;
-    }
+    prefetcher_.clear();
+    music.reset();
 
     Mix_Quit();
 }
 
 void DirectoryPlayer::changeMusic(MUSICTYPE musicType) {
-    int musicNum                   = -1;
-    std::filesystem::path filename = "";
-
-    if (currentMusicType == musicType && Mix_PlayingMusic()) {
+    if (currentMusicType == musicType && (pending_ || Mix_PlayingMusic())) {
         return;
     }
 
-    if (musicType >= 0 && musicType < MUSIC_NUM_MUSIC_TYPES && !musicFileList[musicType].empty()) {
-        musicNum         = random().rand(0u, musicFileList[musicType].size() - 1u);
-        filename         = musicFileList[musicType][musicNum];
-        currentMusicType = musicType;
-    } else {
+    if (musicType < 0 || musicType >= MUSIC_NUM_MUSIC_TYPES || musicFileList[musicType].empty()) {
         // MUSIC_RANDOM
         const int maxnum = musicFileList[MUSIC_ATTACK].size() + musicFileList[MUSIC_PEACE].size();
 
-        if (maxnum > 0) {
-            const unsigned int randnum = random().rand(0, maxnum - 1);
-
-            if (randnum < musicFileList[MUSIC_ATTACK].size()) {
-                musicNum         = randnum;
-                filename         = musicFileList[MUSIC_ATTACK][musicNum];
-                currentMusicType = MUSIC_ATTACK;
-            } else {
-                musicNum         = randnum - musicFileList[MUSIC_ATTACK].size();
-                filename         = musicFileList[MUSIC_PEACE][musicNum];
-                currentMusicType = MUSIC_PEACE;
-            }
+        if (maxnum <= 0) {
+            return;
         }
+
+        const unsigned int randnum = random().rand(0, maxnum - 1);
+
+        musicType = randnum < musicFileList[MUSIC_ATTACK].size() ? MUSIC_ATTACK : MUSIC_PEACE;
     }
 
-    if (musicOn && !filename.empty()) {
+    currentMusicType = musicType;
 
-        Mix_HaltMusic();
+    // Keep the current music playing until the new one has been loaded in the background
+    pending_ = musicOn && prefetch(musicType);
 
-        if (music != nullptr) {
-            Mix_FreeMusic(music);
-            music = nullptr;
-        }
+    update();
+}
 
-        music = Mix_LoadMUS(reinterpret_cast<const char*>(filename.u8string().c_str()));
-        if (music != nullptr) {
-            sdl2::log_info("Now playing %s!", reinterpret_cast<const char*>(filename.u8string().c_str()));
-            Mix_PlayMusic(music, -1);
-            Mix_VolumeMusic(musicVolume);
-        } else {
-            sdl2::log_info("Unable to play %s: %s!", reinterpret_cast<const char*>(filename.u8string().c_str()),
-                           Mix_GetError());
-        }
+void DirectoryPlayer::update() {
+    if (!pending_)
+        return;
+
+    auto track = prefetcher_.take(currentMusicType);
+    if (!track)
+        return;
+
+    pending_ = false;
+
+    Mix_HaltMusic();
+    music = std::move(track->music);
+
+    if (music != nullptr) {
+        sdl2::log_info("Now playing %s!", track->name);
+        Mix_PlayMusic(music.get(), -1);
+        Mix_VolumeMusic(musicVolume);
+    } else {
+        sdl2::log_info("Unable to play %s!", track->name);
+    }
+
+    prefetchNext();
+}
+
+bool DirectoryPlayer::prefetch(MUSICTYPE musicType) {
+    if (prefetcher_.contains(musicType))
+        return true;
+
+    const auto& files = musicFileList[musicType];
+
+    if (files.empty())
+        return false;
+
+    const auto& filename = files[random().rand(0u, files.size() - 1u)];
+
+    prefetcher_.prefetch(musicType, reinterpret_cast<const char*>(filename.u8string().c_str()), [filename] {
+        sdl2::mix_music_ptr music{Mix_LoadMUS(reinterpret_cast<const char*>(filename.u8string().c_str()))};
+        if (music == nullptr)
+            sdl2::log_info("DirectoryPlayer: Loading %s failed: %s",
+                           reinterpret_cast<const char*>(filename.u8string().c_str()), Mix_GetError());
+
+        return music;
+    });
+
+    return true;
+}
+
+void DirectoryPlayer::prefetchNext() {
+    switch (currentMusicType) {
+        case MUSIC_ATTACK:
+        case MUSIC_PEACE: {
+            // During the game we either switch to the attack music or back to the peace music
+            prefetch(MUSIC_ATTACK);
+            prefetch(MUSIC_PEACE);
+        } break;
+
+        default: break;
     }
 }
 
@@ -124,11 +154,11 @@ void DirectoryPlayer::toggleSound() {
         musicOn = true;
         changeMusic(MUSIC_PEACE);
     } else {
-        musicOn = false;
+        musicOn  = false;
+        pending_ = false;
         if (music != nullptr) {
             Mix_HaltMusic();
-            Mix_FreeMusic(music);
-            music = nullptr;
+            music.reset();
         }
     }
 }
@@ -137,12 +167,21 @@ bool DirectoryPlayer::isMusicPlaying() {
     return Mix_PlayingMusic();
 }
 
+bool DirectoryPlayer::isMusicPending() {
+    return pending_;
+}
+
 void DirectoryPlayer::setMusic(bool value) {
     musicOn = value;
 
     if (musicOn) {
         changeMusic(MUSIC_RANDOM);
-    } else if (music != nullptr) {
+        return;
+    }
+
+    pending_ = false;
+
+    if (music != nullptr) {
         Mix_HaltMusic();
     }
 }
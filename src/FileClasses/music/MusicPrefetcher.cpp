@@ -0,0 +1,78 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FileClasses/music/MusicPrefetcher.h>
+
+#include <misc/SDL2pp.h>
+
+#include <chrono>
+
+MusicPrefetcher::MusicPrefetcher() = default;
+
+MusicPrefetcher::~MusicPrefetcher() {
+    clear();
+}
+
+void MusicPrefetcher::prefetch(MUSICTYPE musicType, std::string name, loader_type loader) {
+    if (contains(musicType))
+        return;
+
+    auto music = pool_.submit(std::move(loader));
+
+    entries_.emplace(musicType, Entry{std::move(name), std::move(music)});
+}
+
+bool MusicPrefetcher::contains(MUSICTYPE musicType) const {
+    return entries_.contains(musicType);
+}
+
+std::optional<MusicPrefetcher::Track> MusicPrefetcher::take(MUSICTYPE musicType) {
+    using namespace std::chrono_literals;
+
+    const auto it = entries_.find(musicType);
+    if (it == entries_.end())
+        return std::nullopt;
+
+    auto& entry = it->second;
+
+    if (entry.music.wait_for(0s) != std::future_status::ready)
+        return std::nullopt;
+
+    Track track{std::move(entry.name), nullptr};
+
+    try {
+        track.music = entry.music.get();
+    } catch (const std::exception& e) {
+        sdl2::log_info("MusicPrefetcher: Loading %s failed: %s", track.name, e.what());
+    }
+
+    entries_.erase(it);
+
+    return track;
+}
+
+void MusicPrefetcher::clear() {
+    for (auto& [musicType, entry] : entries_) {
+        try {
+            entry.music.get();
+        } catch (const std::exception& e) {
+            sdl2::log_info("MusicPrefetcher: Loading %s failed: %s", entry.name, e.what());
+        }
+    }
+
+    entries_.clear();
+}
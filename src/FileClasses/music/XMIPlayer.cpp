@@ -30,6 +30,46 @@
 
 #include <filesystem>
 
+namespace {
+
+sdl2::mix_music_ptr loadXMI(const std::string& filename, int musicNum) {
+    std::vector<uint8_t> midi_list;
+
+    { // Scope
+        auto input_path = std::filesystem::path(reinterpret_cast<const char8_t*>(filename.c_str()));
+        auto inputrwop  = dune::globals::pFileManager->openFile(input_path);
+        ISDLDataSource input(inputrwop.get(), 0);
+
+        XMidiFile myXMIDI(&input, XMIDIFILE_CONVERT_NOCONVERSION);
+
+        input.close();
+        inputrwop.reset();
+
+        const auto event_list = myXMIDI.GetEventList(musicNum);
+
+        if (nullptr == event_list) {
+            sdl2::log_info("XMIPlayer: Converting %s failed: %s", filename, SDL_GetError());
+            return nullptr;
+        }
+
+        OMemoryDataSource output;
+
+        event_list->write(&output);
+
+        midi_list = output.takeBuffer();
+    }
+
+    sdl2::RWops_ptr midi_rwops{SDL_RWFromConstMem(midi_list.data(), midi_list.size())};
+
+    sdl2::mix_music_ptr music{Mix_LoadMUSType_RW(midi_rwops.get(), MUS_MID, 0)};
+    if (music == nullptr)
+        sdl2::log_info("XMIPlayer: Loading %s failed: %s", filename, Mix_GetError());
+
+    return music;
+}
+
+} // namespace
+
 XMIPlayer::XMIPlayer()
     : MusicPlayer(dune::globals::settings.audio.playMusic, dune::globals::settings.audio.musicVolume, "XMIPlayer") {
 
@@ -45,18 +85,83 @@ XMIPlayer::XMIPlayer()
 }
 
 XMIPlayer::~XMIPlayer() {
+    prefetcher_.clear();
     music.reset();
 
     Mix_Quit();
 }
 
 void XMIPlayer::changeMusic(MUSICTYPE musicType) {
-    int musicNum = -1;
-    std::string filename;
+    if (currentMusicType == musicType && (pending_ || Mix_PlayingMusic())) {
+        return;
+    }
+
+    currentMusicType = musicType;
+
+    // Keep the current music playing until the new one has been loaded in the background
+    pending_ = musicOn && prefetch(musicType);
+
+    update();
+}
+
+void XMIPlayer::update() {
+    if (!pending_)
+        return;
 
-    if (currentMusicType == musicType && Mix_PlayingMusic()) {
+    auto track = prefetcher_.take(currentMusicType);
+    if (!track)
         return;
+
+    pending_ = false;
+
+    Mix_HaltMusic();
+    music = std::move(track->music);
+
+    if (music != nullptr) {
+        if (Mix_PlayMusic(music.get(), 1) == 1) {
+            sdl2::log_info("XMIPlayer: Playing music failed: %s", SDL_GetError());
+        } else {
+            Mix_VolumeMusic(musicVolume);
+            sdl2::log_info("Now playing %s!", track->name);
+        }
+    } else {
+        sdl2::log_info("Unable to play %s!", track->name);
+    }
+
+    prefetchNext();
+}
+
+bool XMIPlayer::prefetch(MUSICTYPE musicType) {
+    if (prefetcher_.contains(musicType))
+        return true;
+
+    auto track = chooseTrack(musicType);
+
+    if (track.filename.empty())
+        return false;
+
+    prefetcher_.prefetch(musicType, track.filename, [track] { return loadXMI(track.filename, track.musicNum); });
+
+    return true;
+}
+
+void XMIPlayer::prefetchNext() {
+    switch (currentMusicType) {
+        case MUSIC_ATTACK:
+        case MUSIC_PEACE:
+        case MUSIC_RANDOM: {
+            // During the game we either switch to the attack music or play the next peace track
+            prefetch(MUSIC_ATTACK);
+            prefetch(MUSIC_PEACE);
+        } break;
+
+        default: break;
     }
+}
+
+XMIPlayer::Track XMIPlayer::chooseTrack(MUSICTYPE musicType) {
+    int musicNum = -1;
+    std::string filename;
 
     /* currently unused:
         DUNE0.XMI/4
@@ -295,54 +400,7 @@ void XMIPlayer::changeMusic(MUSICTYPE musicType) {
         } break;
     }
 
-    currentMusicType = musicType;
-
-    if (musicOn && !filename.empty()) {
-        std::vector<uint8_t> midi_list;
-
-        { // Scope
-            auto input_path = std::filesystem::path(reinterpret_cast<const char8_t*>(filename.c_str()));
-            auto inputrwop  = dune::globals::pFileManager->openFile(input_path);
-            ISDLDataSource input(inputrwop.get(), 0);
-
-            XMidiFile myXMIDI(&input, XMIDIFILE_CONVERT_NOCONVERSION);
-
-            input.close();
-            inputrwop.reset();
-
-            const auto event_list = myXMIDI.GetEventList(musicNum);
-
-            if (nullptr == event_list) {
-                sdl2::log_info("XMIPlayer: Playing music failed: %s", SDL_GetError());
-                return;
-            }
-
-            OMemoryDataSource output;
-
-            event_list->write(&output);
-
-            midi_list = output.takeBuffer();
-        }
-
-        Mix_HaltMusic();
-        music.reset();
-
-        { // Scope
-            sdl2::RWops_ptr midi_rwops{SDL_RWFromConstMem(midi_list.data(), midi_list.size())};
-
-            music = sdl2::mix_music_ptr{Mix_LoadMUSType_RW(midi_rwops.get(), MUS_MID, 0)};
-            if (music != nullptr) {
-                if (Mix_PlayMusic(music.get(), 1) == 1) {
-                    sdl2::log_info("XMIPlayer: Playing music failed: %s", SDL_GetError());
-                } else {
-                    Mix_VolumeMusic(musicVolume);
-                    sdl2::log_info("Now playing %s!", filename);
-                }
-            } else {
-                sdl2::log_info("Unable to play %s: %s!", filename, Mix_GetError());
-            }
-        }
-    }
+    return {filename, musicNum};
 }
 
 void XMIPlayer::toggleSound() {
@@ -350,7 +408,8 @@ void XMIPlayer::toggleSound() {
         musicOn = true;
         changeMusic(MUSIC_PEACE);
     } else {
-        musicOn = false;
+        musicOn  = false;
+        pending_ = false;
         if (music != nullptr) {
             Mix_HaltMusic();
             music.reset();
@@ -362,12 +421,21 @@ bool XMIPlayer::isMusicPlaying() {
     return Mix_PlayingMusic();
 }
 
+bool XMIPlayer::isMusicPending() {
+    return pending_;
+}
+
 void XMIPlayer::setMusic(bool value) {
     musicOn = value;
 
     if (musicOn) {
         changeMusic(MUSIC_RANDOM);
-    } else if (music != nullptr) {
+        return;
+    }
+
+    pending_ = false;
+
+    if (music != nullptr) {
         Mix_HaltMusic();
         music.reset();
     }
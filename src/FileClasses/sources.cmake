@@ -19,6 +19,7 @@ add_sources(FILE_CLASSES_SOURCES
 	SaveTextureAsBmp.cpp
 	SFXManager.cpp
 	Shpfile.cpp
+	SoundCache.cpp
 	SurfaceLoader.cpp
 	TextManager.cpp
 	TTFFont.cpp
@@ -27,6 +28,7 @@ add_sources(FILE_CLASSES_SOURCES
 	adl/sound_adlib.cpp
 	music/ADLPlayer.cpp
 	music/DirectoryPlayer.cpp
+	music/MusicPrefetcher.cpp
 	music/XMIPlayer.cpp
 )
 
@@ -0,0 +1,116 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FogMask.h>
+
+#include <Definitions.h>
+#include <Map.h>
+#include <Tile.h>
+
+#include <Renderer/DuneRenderer.h>
+#include <misc/exceptions.h>
+
+#include <algorithm>
+
+FogMask::FogMask(SDL_Renderer* renderer, int mapSizeX, int mapSizeY)
+    : sizeX_(mapSizeX), sizeY_(mapSizeY), pixels_(static_cast<size_t>(mapSizeX) * mapSizeY, 0) {
+
+    texture_ = sdl2::texture_ptr{
+        SDL_CreateTexture(renderer, SCREEN_FORMAT, SDL_TEXTUREACCESS_STREAMING, mapSizeX, mapSizeY)};
+    if (texture_ == nullptr) {
+        THROW(std::runtime_error, "FogMask::FogMask(): Cannot create mask texture: %s", SDL_GetError());
+    }
+
+    SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_BLEND);
+
+    // The software renderer would stretch and blend the whole viewport per pixel with linear filtering
+    SDL_RendererInfo info;
+    const auto software = SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_SOFTWARE) != 0;
+
+    SDL_SetTextureScaleMode(texture_.get(), software ? SDL_ScaleModeNearest : SDL_ScaleModeLinear);
+
+    SDL_UpdateTexture(texture_.get(), nullptr, pixels_.data(), sizeX_ * static_cast<int>(sizeof(uint32_t)));
+}
+
+FogMask::~FogMask() = default;
+
+void FogMask::draw(SDL_Renderer* renderer, const Game* game, const Map* map, int teamID, bool fogOfWar, int x1,
+                   int y1, int x2, int y2, const SDL_FRect& dest) {
+    x1 = std::max(x1, 0);
+    y1 = std::max(y1, 0);
+    x2 = std::min(x2, sizeX_);
+    y2 = std::min(y2, sizeY_);
+
+    if (x1 >= x2 || y1 >= y2)
+        return;
+
+    update(game, map, teamID, fogOfWar, x1, y1, x2, y2);
+
+    const SDL_Rect source{x1, y1, x2 - x1, y2 - y1};
+    Dune_RenderCopyF(renderer, texture_.get(), &source, &dest);
+}
+
+void FogMask::update(const Game* game, const Map* map, int teamID, bool fogOfWar, int x1, int y1, int x2, int y2) {
+    if (teamID != teamID_ || fogOfWar != fogOfWar_) {
+        // Everything outside the visible area is stale now; clear the whole mask and recompute it on demand
+        teamID_   = teamID;
+        fogOfWar_ = fogOfWar;
+
+        std::fill(pixels_.begin(), pixels_.end(), 0u);
+        SDL_UpdateTexture(texture_.get(), nullptr, pixels_.data(), sizeX_ * static_cast<int>(sizeof(uint32_t)));
+    }
+
+    // Bounding box of the changed texels
+    auto dirtyX1 = x2;
+    auto dirtyY1 = y2;
+    auto dirtyX2 = x1;
+    auto dirtyY2 = y1;
+
+    for (auto y = y1; y < y2; ++y) {
+        auto* const row = &pixels_[static_cast<size_t>(y) * sizeX_];
+
+        for (auto x = x1; x < x2; ++x) {
+            const auto* const pTile = map->getTile(x, y);
+
+            uint8_t alpha = 0;
+            if (!pTile->isExploredByTeam(game, teamID))
+                alpha = unexploredAlpha;
+            else if (fogOfWar && pTile->isFoggedByTeam(game, teamID))
+                alpha = foggedAlpha;
+
+            // Black with the given alpha in SCREEN_FORMAT (ARGB8888)
+            const auto texel = static_cast<uint32_t>(alpha) << 24;
+
+            if (row[x] == texel)
+                continue;
+
+            row[x] = texel;
+
+            dirtyX1 = std::min(dirtyX1, x);
+            dirtyY1 = std::min(dirtyY1, y);
+            dirtyX2 = std::max(dirtyX2, x + 1);
+            dirtyY2 = std::max(dirtyY2, y + 1);
+        }
+    }
+
+    if (dirtyX1 >= dirtyX2)
+        return;
+
+    const SDL_Rect dirty{dirtyX1, dirtyY1, dirtyX2 - dirtyX1, dirtyY2 - dirtyY1};
+    SDL_UpdateTexture(texture_.get(), &dirty, &pixels_[static_cast<size_t>(dirtyY1) * sizeX_ + dirtyX1],
+                      sizeX_ * static_cast<int>(sizeof(uint32_t)));
+}
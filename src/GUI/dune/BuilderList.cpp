@@ -269,12 +269,11 @@ void BuilderList::draw(Point position) {
 
                 // draw price
                 {
-                    auto pPriceTexture =
-                        gui.createText(renderer, fmt::sprintf("%d", buildItem.price_), COLOR_WHITE, 12);
+                    const auto price     = fmt::sprintf("%d", buildItem.price_);
+                    const auto priceSize = gui.getTextSize(price, 12);
 
-                    pPriceTexture.draw(renderer, dest.x + 2.f, dest.y + BUILDERBTN_HEIGHT - pPriceTexture.height_ - 3);
-
-                    dune::defer_destroy_texture(std::move(pPriceTexture));
+                    gui.drawText(renderer, price, COLOR_WHITE, 12, dest.x + 2.f,
+                                 dest.y + BUILDERBTN_HEIGHT - priceSize.y - 3);
                 }
 
                 if (pStarport != nullptr) {
@@ -339,14 +338,13 @@ void BuilderList::draw(Point position) {
 
                 if (buildItem.num_ > 0) {
                     // draw number of this in build list
-                    auto pNumberTexture = gui.createText(renderer, std::to_string(buildItem.num_), COLOR_RED, 12);
-
-                    const auto x = dest.x + BUILDERBTN_WIDTH - 3 - pNumberTexture.width_;
-                    const auto y = dest.y + BUILDERBTN_HEIGHT - 2 - pNumberTexture.height_;
+                    const auto number     = std::to_string(buildItem.num_);
+                    const auto numberSize = gui.getTextSize(number, 12);
 
-                    pNumberTexture.draw(renderer, x, y);
+                    const auto x = dest.x + BUILDERBTN_WIDTH - 3 - numberSize.x;
+                    const auto y = dest.y + BUILDERBTN_HEIGHT - 2 - numberSize.y;
 
-                    dune::defer_destroy_texture(std::move(pNumberTexture));
+                    gui.drawText(renderer, number, COLOR_RED, 12, x, y);
                 }
             }
 
@@ -19,6 +19,7 @@
 #include <GUI/dune/DuneStyle.h>
 #include <misc/draw_util.h>
 
+#include "Renderer/DuneGlyphAtlas.h"
 #include "Renderer/DuneSurface.h"
 #include "dune_version.h"
 #include <FileClasses/Font.h>
@@ -91,6 +92,37 @@ DuneTextureOwned DuneStyle::createMultilineText(SDL_Renderer* renderer, std::str
     return surface.createTexture(renderer);
 }
 
+SDL_FPoint DuneStyle::getTextSize(std::string_view text, unsigned int fontSize) const {
+    const auto size  = getGlyphAtlas(fontSize).getTextSize(text);
+    const auto scale = 1.f / getActualScale();
+
+    return {static_cast<float>(size.x) * scale, static_cast<float>(size.y) * scale};
+}
+
+void DuneStyle::drawText(SDL_Renderer* renderer, std::string_view text, uint32_t color, unsigned int fontSize, float x,
+                         float y) const {
+    if (getGlyphAtlas(fontSize).draw(renderer, text, color, x, y, getActualScale()))
+        return;
+
+    auto texture = createText(renderer, text, color, fontSize);
+    if (!texture)
+        return;
+
+    texture.draw(renderer, x, y);
+
+    dune::defer_destroy_texture(std::move(texture));
+}
+
+DuneGlyphAtlas& DuneStyle::getGlyphAtlas(unsigned int fontSize) const {
+    const auto size = scaledFontSize(fontSize);
+
+    auto& atlas = glyphAtlases_[size];
+    if (!atlas)
+        atlas = std::make_unique<DuneGlyphAtlas>(fontManager_->getFont(size));
+
+    return *atlas;
+}
+
 DuneStyle::DuneStyle(FontManager* fontManager) : fontManager_{fontManager} {
     assert(fontManager_);
 }
@@ -52,29 +52,18 @@ void MessageTicker::draw(Point position) {
         // delete first message
         messages.pop();
 
-        texture_.reset();
-
         // if no more messages leave
         if (messages.empty()) {
             return;
         }
     }
 
-    auto* const renderer = dune::globals::renderer.get();
-
-    if (!texture_) {
-        const auto& message = messages.front();
+    const auto& message = messages.front();
 
-        if (trim(message).empty())
-            return;
-
-        const auto& gui = GUIStyle::getInstance();
-
-        texture_ = gui.createText(renderer, messages.front(), COLOR_BLACK, 14);
+    if (trim(message).empty())
+        return;
 
-        if (!texture_)
-            return;
-    }
+    auto* const renderer = dune::globals::renderer.get();
 
     const auto size = getSize();
 
@@ -92,11 +81,5 @@ void MessageTicker::draw(Point position) {
 
     dune::RenderClip clipping{renderer, clip};
 
-    texture_.draw(renderer, x, y);
-}
-
-void MessageTicker::invalidateTextures() {
-    parent::invalidateTextures();
-
-    texture_.reset();
+    GUIStyle::getInstance().drawText(renderer, message, COLOR_BLACK, 14, x, y);
 }
@@ -26,8 +26,7 @@ inline constexpr auto MESSAGESCROLLTIME  = (16 * MESSAGESCROLLSPEED);
 inline constexpr auto MESSAGETIME        = (16 * MESSAGESCROLLSPEED);
 
 NewsTicker::NewsTicker()
-    : pBackground(dune::globals::pGFXManager->getUIGraphic(UI_MessageBox)), pCurrentMessageTexture(nullptr),
-      timer(-MESSAGETIME) {
+    : pBackground(dune::globals::pGFXManager->getUIGraphic(UI_MessageBox)), timer(-MESSAGETIME) {
     parent::enableResizing(false, false);
 
     parent::resize(getTextureSize(pBackground));
@@ -75,16 +74,6 @@ void NewsTicker::draw(Point position) {
 
     // draw text
 
-    if (const auto& message = messages.front(); currentMessage != message) {
-        const auto& gui = GUIStyle::getInstance();
-
-        currentMessage         = message;
-        pCurrentMessageTexture = gui.createText(renderer, currentMessage, COLOR_BLACK, 12);
-    }
-
-    if (!pCurrentMessageTexture)
-        return;
-
     const auto x = static_cast<float>(position.x) + 10.f;
     auto y       = static_cast<float>(position.y) + 5.f;
 
@@ -99,5 +88,5 @@ void NewsTicker::draw(Point position) {
 
     dune::RenderClip clipping{renderer, clip};
 
-    pCurrentMessageTexture.draw(renderer, x, y);
+    GUIStyle::getInstance().drawText(renderer, messages.front(), COLOR_BLACK, 12, x, y);
 }
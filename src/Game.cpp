@@ -29,10 +29,14 @@
 #include <FileClasses/music/MusicPlayer.h>
 #include <SoundPlayer.h>
 #include <misc/FileSystem.h>
+#include <misc/ICompressedStream.h>
 #include <misc/IFileStream.h>
 #include <misc/IMemoryStream.h>
+#include <misc/OCompressedStream.h>
 #include <misc/OFileStream.h>
+#include <misc/OMemoryStream.h>
 #include <misc/SDL2pp.h>
+#include <misc/ThreadPool.h>
 #include <misc/draw_util.h>
 #include <misc/dune_events.h>
 #include <misc/dune_timer_resolution.h>
@@ -53,6 +57,7 @@
 
 #include <Bullet.h>
 #include <Explosion.h>
+#include <FogMask.h>
 #include <GameInitSettings.h>
 #include <House.h>
 #include <Map.h>
@@ -193,12 +198,14 @@ void Game::initGame(const GameInitSettings& newGameInitSettings) {
 void Game::initReplay(const std::filesystem::path& filename) {
     bReplay_ = true;
 
-    IFileStream fs;
+    IFileStream file;
 
-    if (!fs.open(filename)) {
+    if (!file.open(filename)) {
         THROW(io_error, "Error while opening '%s'!", filename.string());
     }
 
+    ICompressedStream fs{file};
+
     // override local player name as it was when the replay was created
     localPlayerName_ = fs.readString();
 
@@ -258,10 +265,28 @@ void Game::processObjects() {
     std::erase_if(explosionList_, [](auto& e) { return e->update(); });
 }
 
+void Game::thinkPlayers() {
+    if (!thinkPool_)
+        thinkPool_ = std::make_unique<dune::ThreadPool>();
+
+    std::vector<std::future<void>> thinking;
+    for_each_house([&](House& house) { thinking.push_back(thinkPool_->submit([&house] { house.think(); })); });
+
+    // Wait for all houses before rethrowing an exception; the tasks reference the houses
+    for (auto& f : thinking)
+        f.wait();
+
+    for (auto& f : thinking)
+        f.get();
+}
+
 void Game::drawScreen() {
     auto* const screenborder = dune::globals::screenborder.get();
     auto* const renderer     = dune::globals::renderer.get();
 
+    // The object pictures of a zoom level are only created once it is shown, e.g. after zooming in or out
+    dune::globals::pGFXManager->prepareObjPics(dune::globals::currentZoomlevel);
+
     const auto top_left     = screenborder->getTopLeftTile();
     const auto bottom_right = screenborder->getBottomRightTile();
 
@@ -346,7 +371,23 @@ void Game::drawScreen() {
 
     auto* const gfx = dune::globals::pGFXManager.get();
 
-    if (!dune::globals::debug) {
+    if (!dune::globals::debug && dune::globals::settings.video.fogMaskOverlay) {
+        if (!fogMask_)
+            fogMask_ = std::make_unique<FogMask>(renderer, map_->getSizeX(), map_->getSizeY());
+
+        const auto mask_x1 = std::max(0, top_left.x - 1);
+        const auto mask_y1 = std::max(0, top_left.y - 1);
+        const auto mask_x2 = std::min(map_->getSizeX(), bottom_right.x + 2);
+        const auto mask_y2 = std::min(map_->getSizeY(), bottom_right.y + 2);
+
+        const SDL_FRect maskLocation{screenborder->world2screenX(mask_x1 * TILESIZE),
+                                     screenborder->world2screenY(mask_y1 * TILESIZE),
+                                     static_cast<float>((mask_x2 - mask_x1) * zoomedTileSize),
+                                     static_cast<float>((mask_y2 - mask_y1) * zoomedTileSize)};
+
+        fogMask_->draw(renderer, this, map_.get(), dune::globals::pLocalHouse->getTeamID(),
+                       gameInitSettings_.getGameOptions().fogOfWar, mask_x1, mask_y1, mask_x2, mask_y2, maskLocation);
+    } else if (!dune::globals::debug) {
         auto* const hiddenTexZoomed    = gfx->getZoomedObjPic(ObjPic_Terrain_Hidden, zoom);
         auto* const hiddenFogTexZoomed = gfx->getZoomedObjPic(ObjPic_Terrain_HiddenFog, zoom);
 
@@ -504,13 +545,11 @@ void Game::drawScreen() {
 
     // draw chat message currently typed
     if (chatMode_) {
-        const auto pChatTexture = gui.createText(
+        gui.drawText(
             renderer,
             "Chat: " + typingChatMessage_
                 + (((dune::as_milliseconds(dune::dune_clock::now().time_since_epoch()) / 150) % 2 == 0) ? "_" : ""),
-            COLOR_WHITE, 14);
-
-        pChatTexture.draw(renderer, 20.f, renderer_height - 40.f);
+            COLOR_WHITE, 14, 20.f, renderer_height - 40.f);
     }
 
     if (bShowFPS_) {
@@ -524,15 +563,28 @@ void Game::drawScreen() {
         dune::defer_destroy_texture(std::move(pTexture));
     }
 
+    if (bShowProfiler_) {
+        const auto& profile     = frameProfile_;
+        const auto& renderStats = Dune_GetRenderStats();
+
+        const auto str = fmt::sprintf("drawScreen: %4.1fms\npresent: %4.1fms\nnetwork: %4.1fms\nupdateGame: %4.1fms\n"
+                                      "steps: %d (capped %d)\ncopies: %d\ntexture changes: %d",
+                                      profile.drawScreen, profile.renderPresent, profile.serviceNetwork,
+                                      profile.updateGame, profile.updateSteps, profile.cappedFrames,
+                                      renderStats.copies, renderStats.texture_changes);
+
+        auto pTexture = gui.createMultilineText(renderer, str, COLOR_WHITE, 14);
+
+        pTexture.draw(renderer, sideBarPos_.x - pTexture.width_ - 8.f, bShowFPS_ ? 120.f : 60.f);
+
+        dune::defer_destroy_texture(std::move(pTexture));
+    }
+
     if (bShowTime_) {
         const int seconds  = static_cast<int>(getGameTime()) / 1000;
         const auto strTime = fmt::sprintf(" %.2d:%.2d:%.2d", seconds / 3600, (seconds % 3600) / 60, (seconds % 60));
 
-        auto pTimeTexture = gui.createText(renderer, strTime, COLOR_WHITE, 14);
-
-        pTimeTexture.draw(renderer, 0.f, renderer_height - pTimeTexture.height_);
-
-        dune::defer_destroy_texture(std::move(pTimeTexture));
+        gui.drawText(renderer, strTime, COLOR_WHITE, 14, 0.f, renderer_height - gui.getTextSize(strTime, 14).y);
     }
 
     if (bPause_) {
@@ -543,10 +595,8 @@ void Game::drawScreen() {
 
         SDL_RenderFillRectsF(renderer, rects.data(), rects.size());
     } else if (gameCycleCount_ < skipToGameCycle_) {
-        // Cache this texture...
-        const auto pTexture = gui.createText(renderer, ">>", COLOR_RGBA(0, 242, 0, 128), 48);
-
-        pTexture.draw(renderer, 10.f, renderer_height - pTexture.height_ - 12);
+        gui.drawText(renderer, ">>", COLOR_RGBA(0, 242, 0, 128), 48, 10.f,
+                     renderer_height - gui.getTextSize(">>", 48).y - 12);
     }
 
     if (finished_) {
@@ -558,12 +608,12 @@ void Game::drawScreen() {
             message = _("You Have Failed Your Mission.");
         }
 
-        const auto pFinishMessageTexture = gui.createText(renderer, message, COLOR_WHITE, 28);
+        const auto size = gui.getTextSize(message, 28);
 
-        const auto x = (sideBarPos_.x - pFinishMessageTexture.width_) / 2;
-        const auto y = topBarPos_.h + (renderer_height - topBarPos_.h - pFinishMessageTexture.height_) / 2;
+        const auto x = (sideBarPos_.x - size.x) / 2;
+        const auto y = topBarPos_.h + (renderer_height - topBarPos_.h - size.y) / 2;
 
-        pFinishMessageTexture.draw(renderer, x, y);
+        gui.drawText(renderer, message, COLOR_WHITE, 28, x, y);
     }
 
     if (pWaitingForOtherPlayers_ != nullptr) {
@@ -1130,6 +1180,8 @@ void Game::updateGame(const GameContext& context) {
     }
 #endif
 
+    thinkPlayers();
+
     std::ranges::for_each(house_, [](auto& h) {
         if (h)
             h->update();
@@ -1178,14 +1230,7 @@ void Game::doEventsUntil(const GameContext& context, const dune::dune_clock::tim
     }
 }
 
-void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type handler) {
-    using namespace std::chrono_literals;
-
-    sdl2::log_info("Starting game...");
-
-    sdl_handler_         = handler;
-    auto cleanup_handler = gsl::finally([&] { sdl_handler_ = {}; });
-
+void Game::startRunning(const GameContext& context) {
     // add interface
     if (pInterface_ == nullptr) {
         pInterface_ = std::make_unique<GameInterface>(context);
@@ -1217,6 +1262,34 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
         if (h && !h->isAlive())
             h->lose(true);
     });
+}
+
+void Game::runWithoutDrawing(const GameContext& context, uint32_t maxGameCycles) {
+    sdl2::log_info("Starting game without drawing...");
+
+    startRunning(context);
+
+    while (!bQuitGame_ && !finished_ && gameCycleCount_ < maxGameCycles) {
+        updateGame(context);
+
+        // Nothing is drawn, but the window should still not be reported as unresponsive
+        if (gameCycleCount_ % 1000 == 0)
+            SDL_PumpEvents();
+    }
+
+    gameState = GameState::Deinitialize;
+    sdl2::log_info("Game finished after %d game cycles!", gameCycleCount_);
+}
+
+void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type handler) {
+    using namespace std::chrono_literals;
+
+    sdl2::log_info("Starting game...");
+
+    sdl_handler_         = handler;
+    auto cleanup_handler = gsl::finally([&] { sdl_handler_ = {}; });
+
+    startRunning(context);
 
     if (bReplay_) {
         cmdManager_.setReadOnly(true);
@@ -1305,6 +1378,10 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
 
     auto targetGameCycle = gameCycleCount_;
 
+    const auto autosaveInterval = dune::globals::settings.general.autosaveInterval;
+    const auto autosaveCycles =
+        (bReplay_ || autosaveInterval <= 0) ? 0u : MILLI2CYCLES(static_cast<uint32_t>(autosaveInterval) * 60 * 1000);
+
     lastTargetGameCycleTime_ = gameStart;
 
     auto previousFrameStart = gameStart;
@@ -1346,13 +1423,19 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
 
         drawScreen();
 
+        const auto drawElapsed = dune::dune_clock::now() - renderStart;
+
         // Apparently this must be done after drawing, but before render present.
         // https://discourse.libsdl.org/t/sdl-renderreadpixels-always-returns-black-rectangle/20371/6
         if (pendingScreenshot_)
             saveScreenshot();
 
+        const auto presentStart = dune::dune_clock::now();
+
         Dune_RenderPresent(renderer);
 
+        const auto presentElapsed = dune::dune_clock::now() - presentStart;
+
         updateFullscreen();
 
         const auto renderElapsed = dune::dune_clock::now() - renderStart;
@@ -1361,6 +1444,13 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
             averageRenderTime_ = 0.97f * (averageRenderTime_) + 0.03f * dune::as_milliseconds<float>(renderElapsed);
         }
 
+        if (bShowProfiler_) {
+            frameProfile_.drawScreen =
+                0.97f * frameProfile_.drawScreen + 0.03f * dune::as_milliseconds<float>(drawElapsed);
+            frameProfile_.renderPresent =
+                0.97f * frameProfile_.renderPresent + 0.03f * dune::as_milliseconds<float>(presentElapsed);
+        }
+
         numFrames++;
 
         const auto gameSpeed = getGameSpeed();
@@ -1368,7 +1458,16 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
         bool bWaitForNetwork = false;
 
         if (network_manager != nullptr) {
+            const auto networkStart = dune::dune_clock::now();
+
             serviceNetwork(bWaitForNetwork);
+
+            if (bShowProfiler_) {
+                const auto networkElapsed = dune::dune_clock::now() - networkStart;
+
+                frameProfile_.serviceNetwork =
+                    0.97f * frameProfile_.serviceNetwork + 0.03f * dune::as_milliseconds<float>(networkElapsed);
+            }
         }
 
         while (SDL_PollEvent(&event))
@@ -1394,6 +1493,9 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
 
         cmdManager_.update();
 
+        auto frameUpdateSteps   = 0;
+        auto frameUpdateElapsed = dune::dune_clock::duration::zero();
+
         while (!bWaitForNetwork && !bPause_) {
             now = dune::dune_clock::now();
 
@@ -1429,6 +1531,9 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
 
             const auto updateElapsed = dune::dune_clock::now() - updateStart;
 
+            ++frameUpdateSteps;
+            frameUpdateElapsed += updateElapsed;
+
             if (bShowFPS_) {
                 averageUpdateTime_ = 0.97f * averageUpdateTime_ + 0.03f * dune::as_milliseconds<float>(updateElapsed);
             }
@@ -1437,10 +1542,23 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
                 takeScreenshot();
             }
 
+            if (autosaveCycles != 0 && !finished_ && (gameCycleCount_ % autosaveCycles) == 0) {
+                autoSave();
+            }
+
             now = dune::dune_clock::now();
             // Don't block the UI for more than 75ms, even if we are behind.
-            if (now - frameStart > 75ms)
+            if (now - frameStart > 75ms) {
+                if (bShowProfiler_)
+                    ++frameProfile_.cappedFrames;
                 break;
+            }
+        }
+
+        if (bShowProfiler_) {
+            frameProfile_.updateGame =
+                0.97f * frameProfile_.updateGame + 0.03f * dune::as_milliseconds<float>(frameUpdateElapsed);
+            frameProfile_.updateSteps = frameUpdateSteps;
         }
 
         while (SDL_PollEvent(&event))
@@ -1472,11 +1590,20 @@ void Game::runMainLoop(const GameContext& context, MenuBase::event_handler_type
         const auto rplName    = std::filesystem::path{"replay"} / mapnameBase;
         auto [ok, replayname] = fnkdat(rplName, FNKDAT_USER | FNKDAT_CREAT);
 
-        OFileStream replystream;
-        replystream.open(replayname);
-        replystream.writeString(getLocalPlayerName());
-        gameInitSettings_.save(replystream);
-        cmdManager_.save(replystream);
+        OFileStream replayfile;
+        replayfile.open(replayname);
+
+        if (dune::globals::settings.general.compressSaveGames) {
+            OCompressedStream replystream{replayfile};
+            replystream.writeString(getLocalPlayerName());
+            gameInitSettings_.save(replystream);
+            cmdManager_.save(replystream);
+            replystream.finish();
+        } else {
+            replayfile.writeString(getLocalPlayerName());
+            gameInitSettings_.save(replayfile);
+            cmdManager_.save(replayfile);
+        }
     }
 
     if (network_manager != nullptr) {
@@ -1639,23 +1766,26 @@ bool Game::loadSaveGame(const std::filesystem::path& filename) {
     return ret;
 }
 
-bool Game::loadSaveGame(InputStream& stream) {
+bool Game::loadSaveGame(InputStream& source) {
     gameState = GameState::Loading;
 
-    uint32_t magicNum = stream.readUint32();
+    uint32_t magicNum = source.readUint32();
     if (magicNum != SAVEMAGIC) {
         sdl2::log_info("Game::loadSaveGame(): No valid savegame! Expected magic number %.8X, but got %.8X!", SAVEMAGIC,
                        magicNum);
         return false;
     }
 
-    uint32_t savegameVersion = stream.readUint32();
-    if (savegameVersion != SAVEGAMEVERSION) {
+    uint32_t savegameVersion = source.readUint32();
+    if (savegameVersion != SAVEGAMEVERSION && savegameVersion != SAVEGAMEVERSION_UNCOMPRESSED) {
         sdl2::log_info("Game::loadSaveGame(): No valid savegame! Expected savegame version %d, but got %d!",
                        SAVEGAMEVERSION, savegameVersion);
         return false;
     }
 
+    // the rest of the savegame might be compressed unless it predates compression
+    ICompressedStream stream{source, savegameVersion != SAVEGAMEVERSION_UNCOMPRESSED};
+
     std::string duneVersion = stream.readString();
 
     // if this is a multiplayer load we need to save some information before we overwrite gameInitSettings with
@@ -1817,89 +1947,100 @@ bool Game::saveGame(const std::filesystem::path& filename) {
         return false;
     }
 
-    fs.writeUint32(SAVEMAGIC);
+    if (dune::globals::settings.general.compressSaveGames) {
+        // SAVEMAGIC and SAVEGAMEVERSION stay uncompressed
+        OCompressedStream compressed{fs, 2 * sizeof(uint32_t)};
+        saveGame(compressed);
+        compressed.finish();
+    } else {
+        saveGame(fs);
+    }
 
-    fs.writeUint32(SAVEGAMEVERSION);
+    fs.close();
+
+    return true;
+}
 
-    fs.writeString(VERSIONSTRING);
+void Game::saveGame(OutputStream& stream) {
+    stream.writeUint32(SAVEMAGIC);
+
+    stream.writeUint32(SAVEGAMEVERSION);
+
+    stream.writeString(VERSIONSTRING);
 
     // write gameInitSettings
-    gameInitSettings_.save(fs);
+    gameInitSettings_.save(stream);
 
-    fs.writeUint32(houseInfoListSetup_.size());
+    stream.writeUint32(houseInfoListSetup_.size());
     for (const GameInitSettings::HouseInfo& houseInfo : houseInfoListSetup_) {
-        houseInfo.save(fs);
+        houseInfo.save(stream);
     }
 
     // write the map size
-    fs.writeUint32(map_->getSizeX());
-    fs.writeUint32(map_->getSizeY());
+    stream.writeUint32(map_->getSizeX());
+    stream.writeUint32(map_->getSizeY());
 
     // write GameCycleCount
-    fs.writeUint32(gameCycleCount_);
+    stream.writeUint32(gameCycleCount_);
 
     // write some settings
-    fs.writeSint8(static_cast<int8_t>(gameType));
-    fs.writeUint8(static_cast<uint8_t>(techLevel));
-    fs.writeUint8Vector(randomFactory.getSeed());
-    fs.writeUint8Vector(randomGen.getState());
+    stream.writeSint8(static_cast<int8_t>(gameType));
+    stream.writeUint8(static_cast<uint8_t>(techLevel));
+    stream.writeUint8Vector(randomFactory.getSeed());
+    stream.writeUint8Vector(randomGen.getState());
 
     // write out the unit/structure data
-    objectData.save(fs);
+    objectData.save(stream);
 
     // write the house(s) info
     for (int i = 0; i < NUM_HOUSES; i++) {
-        fs.writeBool(house_[i] != nullptr);
+        stream.writeBool(house_[i] != nullptr);
 
         if (house_[i] != nullptr) {
-            house_[i]->save(fs);
+            house_[i]->save(stream);
         }
     }
 
     if (gameInitSettings_.getGameType() != GameType::CustomMultiplayer) {
-        fs.writeUint8(dune::globals::pLocalPlayer->getPlayerID());
+        stream.writeUint8(dune::globals::pLocalPlayer->getPlayerID());
     }
 
-    fs.writeBool(dune::globals::debug);
-    fs.writeBool(bCheatsEnabled_);
+    stream.writeBool(dune::globals::debug);
+    stream.writeBool(bCheatsEnabled_);
 
-    fs.writeUint32(winFlags);
-    fs.writeUint32(loseFlags);
+    stream.writeUint32(winFlags);
+    stream.writeUint32(loseFlags);
 
-    map_->save(fs, getGameCycleCount());
+    map_->save(stream, getGameCycleCount());
 
     // save the structures and units
-    objectManager_.save(fs);
+    objectManager_.save(stream);
 
-    fs.writeUint32(dune::globals::bulletList.size());
+    stream.writeUint32(dune::globals::bulletList.size());
     for (const auto& pBullet : dune::globals::bulletList) {
-        pBullet->save(fs);
+        pBullet->save(stream);
     }
 
-    fs.writeUint32(explosionList_.size());
+    stream.writeUint32(explosionList_.size());
     for (const auto& pExplosion : explosionList_) {
-        pExplosion->save(fs);
+        pExplosion->save(stream);
     }
 
     if (gameInitSettings_.getGameType() != GameType::CustomMultiplayer) {
         // save selection lists
 
         // write out selected units list
-        fs.writeUint32Set(selectedList_);
+        stream.writeUint32Set(selectedList_);
 
         // write the screenborder info
-        dune::globals::screenborder->save(fs);
+        dune::globals::screenborder->save(stream);
     }
 
     // save triggers
-    triggerManager_.save(fs);
+    triggerManager_.save(stream);
 
     // CommandManager is at the very end of the file. DO NOT CHANGE THIS!
-    cmdManager_.save(fs);
-
-    fs.close();
-
-    return true;
+    cmdManager_.save(stream);
 }
 
 void Game::saveObject(OutputStream& stream, ObjectBase* obj) {
@@ -2355,7 +2496,12 @@ void Game::handleKeyInput(const GameContext& context, SDL_KeyboardEvent& keyboar
         } break;
 
         case SDLK_F12: {
-            bShowFPS_ = !bShowFPS_;
+            if (SDL_GetModState() & KMOD_SHIFT) {
+                bShowProfiler_ = !bShowProfiler_;
+                frameProfile_  = {};
+            } else {
+                bShowFPS_ = !bShowFPS_;
+            }
         } break;
 
         case SDLK_m: {
@@ -2760,6 +2906,78 @@ void Game::saveScreenshot() {
     }
 }
 
+namespace {
+bool writeAutosave(const std::filesystem::path& filename, std::span<const uint8_t> data, bool compress) {
+    // Write to a temporary file first so that a crash while writing does not destroy the previous autosave
+    auto tmpname = filename;
+    tmpname += ".tmp";
+
+    try {
+        OFileStream fs;
+
+        if (!fs.open(tmpname)) {
+            sdl2::log_warn("Autosave failed: Cannot open '%s': %s",
+                           reinterpret_cast<const char*>(tmpname.u8string().c_str()), dune::string_error(errno));
+            return false;
+        }
+
+        if (compress) {
+            // SAVEMAGIC and SAVEGAMEVERSION stay uncompressed
+            OCompressedStream compressed{fs, 2 * sizeof(uint32_t)};
+            compressed.writeBytes(data);
+            compressed.finish();
+        } else {
+            fs.writeBytes(data);
+        }
+
+        fs.close();
+
+        std::filesystem::rename(tmpname, filename);
+    } catch (const std::exception& e) {
+        sdl2::log_warn("Autosave to '%s' failed: %s", reinterpret_cast<const char*>(filename.u8string().c_str()),
+                       e.what());
+        return false;
+    }
+
+    return true;
+}
+} // namespace
+
+void Game::autoSave() {
+    using namespace std::chrono_literals;
+
+    if (pendingAutosave_.valid() && pendingAutosave_.wait_for(0s) != std::future_status::ready) {
+        sdl2::log_warn("Skipping autosave: the previous autosave is still being written.");
+        return;
+    }
+
+    const auto bMultiplayer = gameInitSettings_.getGameType() == GameType::CustomMultiplayer;
+
+    const auto [ok, savepath] = fnkdat(bMultiplayer ? "mpsave/" : "save/", FNKDAT_USER | FNKDAT_CREAT);
+    if (!ok) {
+        return;
+    }
+
+    const auto slots = std::max(1, dune::globals::settings.general.autosaveSlots);
+    auto filename    = savepath / fmt::format("autosave{}.dls", autosaveCount_++ % slots + 1);
+
+    // Serializing is fast and has to happen between two game cycles; the file I/O is left to the worker
+    OMemoryStream stream;
+    stream.open(lastAutosaveSize_);
+    saveGame(stream);
+    lastAutosaveSize_ = stream.getDataLength();
+
+    if (!autosaveIO_)
+        autosaveIO_ = std::make_unique<dune::ThreadPool>(1);
+
+    // Compression is done by the worker as well
+    pendingAutosave_ =
+        autosaveIO_->submit([filename = std::move(filename), data = stream.release(),
+                             compress = dune::globals::settings.general.compressSaveGames] {
+            return writeAutosave(filename, data, compress);
+        });
+}
+
 void Game::selectNextStructureOfType(const Dune::selected_set_type& itemIDs) {
     bool bSelectNext = true;
 
@@ -18,6 +18,7 @@
 #include <GameInitSettings.h>
 
 #include <misc/IFileStream.h>
+#include <misc/ICompressedStream.h>
 #include <misc/IMemoryStream.h>
 #include <misc/exceptions.h>
 
@@ -248,7 +249,9 @@ void GameInitSettings::checkSaveGame(InputStream& stream) {
     try {
         magicNum        = stream.readUint32();
         savegameVersion = stream.readUint32();
-        duneVersion     = stream.readString();
+
+        ICompressedStream body{stream, savegameVersion != SAVEGAMEVERSION_UNCOMPRESSED};
+        duneVersion = body.readString();
     } catch (std::exception&) {
         THROW(std::runtime_error, "Cannot load this savegame,\n because it seems to be truncated!");
     }
@@ -257,7 +260,7 @@ void GameInitSettings::checkSaveGame(InputStream& stream) {
         THROW(std::runtime_error, "Cannot load this savegame,\n because it has a wrong magic number!");
     }
 
-    if (savegameVersion < SAVEGAMEVERSION) {
+    if (savegameVersion < SAVEGAMEVERSION_UNCOMPRESSED) {
         THROW(std::runtime_error,
               "Cannot load this savegame,\n because it was created with an older version:\n" + duneVersion);
     }
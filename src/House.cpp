@@ -47,6 +47,40 @@
 #include <algorithm>
 #include <numeric>
 #include <stdexcept>
+#include <utility>
+
+namespace {
+/// Inserts value before next, or at the end if next is nullptr or not in the list
+template<typename T>
+void insertBefore(RobustList<T>& list, T next, T value) {
+    if (next == nullptr) {
+        list.push_back(value);
+        return;
+    }
+
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        if (*it == next) {
+            list.insert(it, value);
+            return;
+        }
+    }
+
+    list.push_back(value);
+}
+
+inline constexpr auto SANDWORM_CONTACT_RADIUS = 5; ///< how close a sandworm has to come to be noticed by a harvester
+
+bool isSandwormContact(const Coord& sandwormLocation, const Coord& harvesterLocation) {
+    return sandwormLocation.isValid() && harvesterLocation.isValid()
+        && blockDistance(sandwormLocation, harvesterLocation) <= SANDWORM_CONTACT_RADIUS;
+}
+
+/// Orders the contacts by the object IDs of the sandworm and then of the harvester
+bool isBeforeSandwormContact(const SandwormContact& a, const SandwormContact& b) {
+    return std::pair{a.pSandworm->getObjectID(), a.pHarvester->getObjectID()}
+         < std::pair{b.pSandworm->getObjectID(), b.pHarvester->getObjectID()};
+}
+} // namespace
 
 House::House(const GameContext& context) : ai_{true}, choam_(this), context_(context) { }
 
@@ -286,13 +320,133 @@ void House::printStat() const {
     sdl2::log_info("Ornithopters: %d\t\tRocket Launchers: %d", numItem_[Unit_Ornithopter], numItem_[Unit_Launcher]);
 }
 
-void House::updateBuildLists() {
-    for (auto* pStructure : dune::globals::structureList) {
-        auto* builder = dune_cast<BuilderBase>(pStructure);
-        if (!builder || builder->getOwner() != this)
-            continue;
+/**
+    Updates the build lists of the builders that offer an item requiring a structure of type structureID. Must be
+    called whenever this house gets its first or loses its last structure of that type.
+    \param structureID    the type of the structure
+*/
+void House::updateBuildListsDependingOn(ItemID_enum structureID) {
+    for (auto* pBuilder : builderList_) {
+        if (pBuilder->dependsOnStructure(structureID))
+            pBuilder->updateBuildList();
+    }
+}
+
+void House::addToUnitList(UnitBase* pUnit) {
+    // A new unit is the last one in the global list. A unit that changes over from another house is inserted where
+    // the global list has it, so walking the units of this house still visits them in the global order.
+    UnitBase* pNextUnit = nullptr;
+    UnitBase* pNextItem = nullptr;
+
+    const auto& globalList = dune::globals::unitList;
+    if (!globalList.empty() && globalList.back() != pUnit) {
+        auto found = false;
+        for (auto* pOther : globalList) {
+            if (!found) {
+                found = pOther == pUnit;
+                continue;
+            }
+
+            if (pOther->getOwner() != this)
+                continue;
+
+            if (pNextUnit == nullptr)
+                pNextUnit = pOther;
+
+            if (pOther->getItemID() == pUnit->getItemID()) {
+                pNextItem = pOther;
+                break;
+            }
+        }
+    }
+
+    insertBefore(unitList_, pNextUnit, pUnit);
+    insertBefore<ObjectBase*>(itemLists_.at(pUnit->getItemID()), pNextItem, pUnit);
+    influence_.add(pUnit->getItemID(), pUnit->getLocation());
+    updateSandwormContacts(pUnit, pUnit->getLocation());
+}
+
+void House::removeFromUnitList(UnitBase* pUnit) {
+    unitList_.remove(pUnit);
+    itemLists_.at(pUnit->getItemID()).remove(pUnit);
+    influence_.remove(pUnit->getItemID(), pUnit->getLocation());
+    removeSandwormContacts(pUnit);
+}
+
+void House::addToStructureList(StructureBase* pStructure) {
+    structureList_.push_back(pStructure);
+    itemLists_.at(pStructure->getItemID()).push_back(pStructure);
+    if (auto* pBuilder = dune_cast<BuilderBase>(pStructure))
+        builderList_.push_back(pBuilder);
+    influence_.add(pStructure->getItemID(), pStructure->getLocation());
+}
+
+void House::removeFromStructureList(StructureBase* pStructure) {
+    structureList_.remove(pStructure);
+    itemLists_.at(pStructure->getItemID()).remove(pStructure);
+    if (auto* pBuilder = dune_cast<BuilderBase>(pStructure))
+        builderList_.remove(pBuilder);
+    influence_.remove(pStructure->getItemID(), pStructure->getLocation());
+}
+
+void House::informHasMoved(const ObjectBase* pObject, const Coord& from, const Coord& to) {
+    influence_.move(pObject->getItemID(), from, to);
+
+    if (!pObject->isAStructure())
+        updateSandwormContacts(static_cast<const UnitBase*>(pObject), to);
+}
+
+/**
+    Updates the sandworm contacts of pUnit if it is a sandworm or a harvester. Only the sandworms are compared with
+    the harvesters, so this is linear in the number of sandworms or harvesters.
+    \param pUnit       the unit to check
+    \param location    the location to use for pUnit (pUnit might still be at its old location)
+*/
+void House::updateSandwormContacts(const UnitBase* pUnit, const Coord& location) {
+    if (pUnit->getItemID() == Unit_Harvester) {
+        context_.game.for_each_house([&](const auto& house) {
+            for (const auto* pSandworm : house.getItemList(Unit_Sandworm)) {
+                updateSandwormContact(static_cast<const UnitBase*>(pSandworm), pSandworm->getLocation(), pUnit,
+                                      location);
+            }
+        });
+    } else if (pUnit->getItemID() == Unit_Sandworm) {
+        context_.game.for_each_house([&](auto& house) {
+            for (const auto* pHarvester : house.getItemList(Unit_Harvester)) {
+                house.updateSandwormContact(pUnit, location, static_cast<const UnitBase*>(pHarvester),
+                                            pHarvester->getLocation());
+            }
+        });
+    }
+}
+
+void House::updateSandwormContact(const UnitBase* pSandworm, const Coord& sandwormLocation,
+                                  const UnitBase* pHarvester, const Coord& harvesterLocation) {
+    const SandwormContact contact{pSandworm, pHarvester};
 
-        builder->updateBuildList();
+    const auto it    = std::ranges::lower_bound(sandwormContacts_, contact, isBeforeSandwormContact);
+    const auto known = it != sandwormContacts_.end() && *it == contact;
+    if (isSandwormContact(sandwormLocation, harvesterLocation)) {
+        if (!known)
+            sandwormContacts_.insert(it, contact);
+    } else if (known) {
+        sandwormContacts_.erase(it);
+    }
+}
+
+void House::removeSandwormContacts(const UnitBase* pUnit) {
+    if (pUnit->getItemID() == Unit_Harvester) {
+        std::erase_if(sandwormContacts_, [&](const auto& contact) { return contact.pHarvester == pUnit; });
+    } else if (pUnit->getItemID() == Unit_Sandworm) {
+        context_.game.for_each_house([&](auto& house) {
+            std::erase_if(house.sandwormContacts_, [&](const auto& contact) { return contact.pSandworm == pUnit; });
+        });
+    }
+}
+
+void House::think() {
+    for (const auto& pPlayer : players_) {
+        pPlayer->think();
     }
 }
 
@@ -330,7 +484,7 @@ void House::update() {
     choam_.update(context_);
 
     for (const auto& pPlayer : players_) {
-        pPlayer->update();
+        pPlayer->applyActions();
     }
 }
 
@@ -389,9 +543,9 @@ void House::incrementStructures(ItemID_enum itemID) {
     // change spice capacity
     capacity_ += context_.game.objectData.data[itemID][static_cast<int>(houseID_)].capacity;
 
-    if (context_.game.gameState != GameState::Loading) {
-        // do not check selection lists if we are loading
-        updateBuildLists();
+    if (context_.game.gameState != GameState::Loading && numItem_[itemID] == 1) {
+        // do not check selection lists if we are loading; only our first structure of a type can change them
+        updateBuildListsDependingOn(itemID);
     }
 }
 
@@ -414,9 +568,9 @@ void House::decrementStructures(ItemID_enum itemID, const Coord& location) {
     // change spice capacity
     capacity_ -= context_.game.objectData.data[itemID][static_cast<int>(houseID_)].capacity;
 
-    if (context_.game.gameState != GameState::Loading) {
-        // do not check selection lists if we are loading
-        updateBuildLists();
+    if (context_.game.gameState != GameState::Loading && numItem_[itemID] == 0) {
+        // do not check selection lists if we are loading; only our last structure of a type can change them
+        updateBuildListsDependingOn(itemID);
     }
 
     if (!isAlive())
@@ -713,12 +867,9 @@ House::placeStructure(uint32_t builderID, ItemID_enum itemID, int xPos, int yPos
 
                 if (itemID == Structure_Palace) {
                     // cancel all other palaces
-                    for (auto* pStructure : dune::globals::structureList) {
-                        if (pStructure->getOwner() != this)
-                            continue;
-
-                        auto* pConstructionYard = dune_cast<ConstructionYard>(pStructure);
-                        if (pConstructionYard && pBuilder != pConstructionYard) {
+                    for (auto* pStructure : itemLists_[Structure_ConstructionYard]) {
+                        auto* pConstructionYard = static_cast<ConstructionYard*>(pStructure);
+                        if (pBuilder != pConstructionYard) {
                             pConstructionYard->doCancelItem(Structure_Palace, false);
                         }
                     }
@@ -791,11 +942,9 @@ UnitBase* House::placeUnit(ItemID_enum itemID, int xPos, int yPos, bool byScenar
 Coord House::getCenterOfMainBase() const {
     Coord center;
     int numStructures = 0;
-    for (const StructureBase* pStructure : dune::globals::structureList) {
-        if (pStructure->getOwner() == this) {
-            center += pStructure->getLocation();
-            numStructures++;
-        }
+    for (const StructureBase* pStructure : structureList_) {
+        center += pStructure->getLocation();
+        numStructures++;
     }
 
     if (numStructures == 0) {
@@ -811,15 +960,12 @@ Coord House::getCenterOfMainBase() const {
 Coord House::getStrongestUnitPosition() const {
     Coord strongestUnitPosition = Coord::Invalid();
     int32_t strongestUnitCost   = 0;
-    for (const UnitBase* pUnit : dune::globals::unitList) {
-        if (pUnit->getOwner() == this) {
-            const int32_t currentCost =
-                context_.game.objectData.data[pUnit->getItemID()][static_cast<int>(houseID_)].price;
-
-            if (currentCost > strongestUnitCost) {
-                strongestUnitPosition = pUnit->getLocation();
-                strongestUnitCost     = currentCost;
-            }
+    for (const UnitBase* pUnit : unitList_) {
+        const int32_t currentCost = context_.game.objectData.data[pUnit->getItemID()][static_cast<int>(houseID_)].price;
+
+        if (currentCost > strongestUnitCost) {
+            strongestUnitPosition = pUnit->getLocation();
+            strongestUnitCost     = currentCost;
         }
     }
 
@@ -837,9 +983,9 @@ void House::decrementHarvesters() {
             FixPoint closestDistance              = FixPt_MAX;
             const StructureBase* pClosestRefinery = nullptr;
 
-            for (const auto* pStructure : dune::globals::structureList) {
-                if ((pStructure->getItemID() == Structure_Refinery) && (pStructure->getOwner() == this)
-                    && (pStructure->getHealth() > 0)) {
+            for (const auto* pObject : itemLists_[Structure_Refinery]) {
+                const auto* pStructure = static_cast<const StructureBase*>(pObject);
+                if (pStructure->getHealth() > 0) {
                     Coord pos = pStructure->getLocation();
 
                     Coord closestPoint        = pStructure->getClosestPoint(pos);
@@ -0,0 +1,48 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <HouseInfluence.h>
+
+#include <sand.h>
+
+void HouseInfluence::update(ItemID_enum itemID, const Coord& location, int weight) noexcept {
+    const auto apply = [&](Centroid& centroid) {
+        centroid.count += weight;
+        centroid.sumX += weight * location.x;
+        centroid.sumY += weight * location.y;
+    };
+
+    if (isStructure(itemID)) {
+        apply(structures_);
+        if (getStructureSize(itemID).x != 1)
+            apply(baseStructures_);
+        return;
+    }
+
+    switch (itemID) {
+        case Unit_Carryall:
+        case Unit_Frigate:
+        case Unit_Harvester:
+        case Unit_MCV:
+        case Unit_Saboteur:
+        case Unit_Sandworm: break;
+
+        case Unit_Trooper: apply(troopers_); break;
+
+        default: apply(squad_); break;
+    }
+}
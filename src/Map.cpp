@@ -29,10 +29,12 @@
 #include <units/InfantryBase.h>
 #include <units/UnitBase.h>
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <set>
 #include <stack>
+#include <utility>
 
 Map::Map(Game& game, int xSize, int ySize)
     : sizeX(xSize), sizeY(ySize), lastSinglySelectedObject(nullptr),
@@ -49,6 +51,7 @@ Map::Map(Game& game, int xSize, int ySize)
 
     init_tile_location();
     init_box_sets();
+    init_spice_index();
 }
 
 Map::~Map() = default;
@@ -69,6 +72,7 @@ void Map::load(InputStream& stream) {
     random_.setState(state);
 
     init_tile_location();
+    init_spice_index();
 }
 
 void Map::save(OutputStream& stream, uint32_t gameCycleCount) const {
@@ -586,14 +590,111 @@ void Map::selectObjects(const House* pHouse, int x1, int y1, int x2, int y2, int
     }
 }
 
-bool Map::findSpice(Coord& destination, const Coord& origin) {
-    return search_all_by_box_edge(origin.x, origin.y, random_, [&](const Tile& t) {
+bool Map::findSpice(Coord& destination, const Coord& origin, Random& randomGen) const {
+    if (numSpiceTiles_ == 0)
+        return false;
+
+    const auto predicate = [&](const Tile& t) {
         if (t.hasAGroundObject() || !t.hasSpice())
             return SearchResult::NotDone;
 
         destination = t.location_;
         return SearchResult::Done;
-    });
+    };
+
+    // The AI players search for spice while they think in parallel. So the shared box edges must not be shuffled in
+    // place; each thread shuffles its own copy instead.
+    thread_local std::vector<std::pair<int, int>> edge;
+
+    const auto maxDepth = static_cast<int>(offsets_->max_depth());
+
+    for (auto depth = spice_search_depth(origin.x, origin.y); depth <= maxDepth; ++depth) {
+        // Skip box edges that do not touch a cell of the spice index with spice in it
+        if (!may_have_spice(origin.x - depth, origin.y - depth, origin.x + depth, origin.y - depth)
+            && !may_have_spice(origin.x - depth, origin.y + depth, origin.x + depth, origin.y + depth)
+            && !may_have_spice(origin.x - depth, origin.y - depth, origin.x - depth, origin.y + depth)
+            && !may_have_spice(origin.x + depth, origin.y - depth, origin.x + depth, origin.y + depth))
+            continue;
+
+        if (depth == 0) {
+            const auto* const tile = tryGetTile(origin.x, origin.y);
+            if (tile && SearchResult::Done == predicate(*tile))
+                return true;
+
+            continue;
+        }
+
+        const auto& offsets = std::as_const(*offsets_).search_set(depth);
+        edge.assign(offsets.begin(), offsets.end());
+
+        if (SearchResult::NotDone != search_random_offsets(origin.x, origin.y, edge, randomGen, predicate))
+            return true;
+    }
+
+    return false;
+}
+
+void Map::informSpiceChanged(const Coord& location, bool hasSpice) {
+    auto& count = spiceCells_[spice_cell_index(location.x / SPICE_CELL_SIZE, location.y / SPICE_CELL_SIZE)];
+
+    if (hasSpice) {
+        ++count;
+        ++numSpiceTiles_;
+    } else {
+        assert(count > 0);
+
+        --count;
+        --numSpiceTiles_;
+    }
+}
+
+void Map::init_spice_index() {
+    spiceCellsX_ = (sizeX + SPICE_CELL_SIZE - 1) / SPICE_CELL_SIZE;
+    spiceCellsY_ = (sizeY + SPICE_CELL_SIZE - 1) / SPICE_CELL_SIZE;
+
+    spiceCells_.assign(static_cast<size_t>(spiceCellsX_) * spiceCellsY_, 0);
+    numSpiceTiles_ = 0;
+
+    for (const auto& tile : tiles) {
+        if (tile.hasSpice())
+            informSpiceChanged(tile.location_, true);
+    }
+}
+
+int Map::spice_search_depth(int x, int y) const {
+    auto depth = INT_MAX;
+
+    for (auto cellX = 0; cellX < spiceCellsX_; ++cellX) {
+        for (auto cellY = 0; cellY < spiceCellsY_; ++cellY) {
+            if (spiceCells_[spice_cell_index(cellX, cellY)] == 0)
+                continue;
+
+            const auto x1 = cellX * SPICE_CELL_SIZE;
+            const auto y1 = cellY * SPICE_CELL_SIZE;
+            const auto dx = std::max({0, x1 - x, x - (x1 + SPICE_CELL_SIZE - 1)});
+            const auto dy = std::max({0, y1 - y, y - (y1 + SPICE_CELL_SIZE - 1)});
+
+            depth = std::min(depth, std::max(dx, dy));
+        }
+    }
+
+    return depth;
+}
+
+bool Map::may_have_spice(int x1, int y1, int x2, int y2) const {
+    x1 = std::max(x1, 0);
+    y1 = std::max(y1, 0);
+    x2 = std::min(x2, sizeX - 1);
+    y2 = std::min(y2, sizeY - 1);
+
+    for (auto cellX = x1 / SPICE_CELL_SIZE; x1 <= x2 && cellX <= x2 / SPICE_CELL_SIZE; ++cellX) {
+        for (auto cellY = y1 / SPICE_CELL_SIZE; y1 <= y2 && cellY <= y2 / SPICE_CELL_SIZE; ++cellY) {
+            if (spiceCells_[spice_cell_index(cellX, cellY)] != 0)
+                return true;
+        }
+    }
+
+    return false;
 }
 
 /**
@@ -31,6 +31,7 @@
 #include <players/PlayerFactory.h>
 
 #include <misc/FileSystem.h>
+#include <misc/ICompressedStream.h>
 #include <misc/IMemoryStream.h>
 #include <misc/draw_util.h>
 #include <misc/string_util.h>
@@ -100,19 +101,21 @@ CustomGamePlayers::CustomGamePlayers(GameInitSettings newGameInitSettings, bool
         }
 
         uint32_t savegameVersion = memStream.readUint32();
-        if (savegameVersion != SAVEGAMEVERSION) {
+        if (savegameVersion != SAVEGAMEVERSION && savegameVersion != SAVEGAMEVERSION_UNCOMPRESSED) {
             sdl2::log_info("CustomGamePlayers: No valid savegame! Expected savegame version %d, but got %d!",
                            SAVEGAMEVERSION, savegameVersion);
         }
 
-        memStream.readString(); // dune legacy version
+        ICompressedStream body{memStream, savegameVersion != SAVEGAMEVERSION_UNCOMPRESSED};
+
+        body.readString(); // dune legacy version
 
         // read gameInitSettings
-        GameInitSettings tmpGameInitSettings(memStream);
+        GameInitSettings tmpGameInitSettings(body);
 
-        uint32_t numHouseInfo = memStream.readUint32();
+        uint32_t numHouseInfo = body.readUint32();
         for (uint32_t i = 0; i < numHouseInfo; i++) {
-            houseInfoListSetup.push_back(GameInitSettings::HouseInfo(memStream));
+            houseInfoListSetup.push_back(GameInitSettings::HouseInfo(body));
         }
 
         auto RWops = sdl2::RWops_ptr{
@@ -20,6 +20,7 @@
 #include <Network/NetworkManager.h>
 
 #include "FileClasses/LoadSavePNG.h"
+#include "FileClasses/music/MusicPlayer.h"
 #include "GUI/GUIStyle.h"
 #include "misc/DrawingRectHelper.h"
 #include "misc/draw_util.h"
@@ -91,6 +92,10 @@ int MenuBase::showMenuImpl() {
             dune::globals::pNetworkManager->update();
         }
 
+        if (dune::globals::musicPlayer != nullptr) {
+            dune::globals::musicPlayer->update();
+        }
+
         if (quitting) {
             return retVal;
         }
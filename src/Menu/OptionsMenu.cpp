@@ -373,6 +373,7 @@ void OptionsMenu::saveConfiguration2File() {
     myINIFile.setIntValue("Video", "Preferred Zoom Level", settings.video.preferredZoomLevel);
     myINIFile.setStringValue("Video", "Scaler", settings.video.scaler);
     myINIFile.setBoolValue("Video", "RotateUnitGraphics", settings.video.rotateUnitGraphics);
+    myINIFile.setBoolValue("Video", "FogMaskOverlay", settings.video.fogMaskOverlay);
 
     myINIFile.setStringValue("General", "Player Name", settings.general.playerName);
     myINIFile.setStringValue("General", "Language", settings.general.language);
@@ -267,17 +267,24 @@ void ObjectBase::setHealth(FixPoint newHealth) {
 
 void ObjectBase::setLocation(const GameContext& context, int xPos, int yPos) {
     if (xPos == INVALID_POS && yPos == INVALID_POS) {
-        location_.invalidate();
+        updateLocation(Coord::Invalid());
     } else if (context.map.tileExists(xPos, yPos)) {
-        location_.x = xPos;
-        location_.y = yPos;
-        realX_      = location_.x * TILESIZE;
-        realY_      = location_.y * TILESIZE;
+        updateLocation(Coord(xPos, yPos));
+        realX_ = location_.x * TILESIZE;
+        realY_ = location_.y * TILESIZE;
 
         assignToMap(context, location_);
     }
 }
 
+void ObjectBase::updateLocation(const Coord& newLocation) {
+    if (newLocation == location_)
+        return;
+
+    owner_->informHasMoved(this, location_, newLocation);
+    location_ = newLocation;
+}
+
 void ObjectBase::setVisible(int teamID, bool status) {
     if (teamID == VIS_ALL) {
         if (status) {
@@ -0,0 +1,219 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Renderer/DuneGlyphAtlas.h"
+
+#include "Renderer/DuneRenderer.h"
+
+#include <Colors.h>
+#include <Definitions.h>
+#include <FileClasses/Font.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+inline constexpr auto ATLAS_WIDTH      = 512;
+inline constexpr auto MAX_ATLAS_HEIGHT = 2048;
+
+// Timers and counters create a new text every time they change, so the cache is simply emptied when it gets full.
+inline constexpr auto MAX_LAYOUTS = 256u;
+} // namespace
+
+DuneGlyphAtlas::DuneGlyphAtlas(const Font* font) : font_{font} { }
+
+DuneGlyphAtlas::~DuneGlyphAtlas() = default;
+
+SDL_Point DuneGlyphAtlas::getTextSize(std::string_view text) {
+    if (text.empty())
+        return {};
+
+    return getLayout(text).size;
+}
+
+bool DuneGlyphAtlas::draw(SDL_Renderer* renderer, std::string_view text, uint32_t color, float x, float y,
+                          float scale) {
+    if (text.empty())
+        return true;
+
+    const auto& layout = getLayout(text);
+    if (!layout.complete)
+        return false;
+
+    if (layout.quads.empty())
+        return true;
+
+    if (!updateTexture(renderer))
+        return false;
+
+    const auto sdl_color = RGBA2SDL(color);
+    SDL_SetTextureColorMod(texture_.get(), sdl_color.r, sdl_color.g, sdl_color.b);
+    SDL_SetTextureAlphaMod(texture_.get(), sdl_color.a);
+
+    const auto inverse_scale = 1.f / scale;
+
+    for (const auto& quad : layout.quads) {
+        const auto source = quad.source.as_sdl();
+        const SDL_FRect dest{x + static_cast<float>(quad.x) * inverse_scale, y,
+                             static_cast<float>(source.w) * inverse_scale, static_cast<float>(source.h) * inverse_scale};
+
+        Dune_RenderCopyF(renderer, texture_.get(), &source, &dest);
+    }
+
+    return true;
+}
+
+const DuneGlyphAtlas::Layout& DuneGlyphAtlas::getLayout(std::string_view text) {
+    if (const auto it = layouts_.find(text); it != layouts_.end())
+        return it->second;
+
+    if (layouts_.size() >= MAX_LAYOUTS)
+        layouts_.clear();
+
+    Layout layout;
+    layout.complete = true;
+
+    // Place the glyphs the way SDL2_ttf places them when rendering the whole text: the pen advances by the advance
+    // and kerning of each glyph, and everything is shifted right if a glyph reaches left of the start.
+    auto pen      = 0;
+    auto min_x    = 0;
+    auto previous = char32_t{};
+    for (const auto ch : utf8Decode(text)) {
+        const auto* const glyph = getGlyph(ch);
+        if (!glyph) {
+            layout.complete = false;
+            break;
+        }
+
+        if (previous)
+            pen += font_->getKerning(previous, ch);
+
+        min_x = std::min(min_x, pen + glyph->metrics.minX);
+
+        if (glyph->source.w > 0)
+            layout.quads.push_back({glyph->source, pen + std::min(0, glyph->metrics.minX)});
+
+        layout.size.y = std::max(layout.size.y, static_cast<int>(glyph->source.h));
+
+        pen += glyph->metrics.advance;
+        previous = ch;
+    }
+
+    for (auto& quad : layout.quads)
+        quad.x -= min_x;
+
+    layout.size.x = font_->getTextWidth(text);
+    if (layout.size.y == 0)
+        layout.size.y = font_->getTextHeight();
+
+    return layouts_.emplace(text, std::move(layout)).first->second;
+}
+
+const DuneGlyphAtlas::Glyph* DuneGlyphAtlas::getGlyph(char32_t ch) {
+    auto it = glyphs_.find(ch);
+    if (it == glyphs_.end())
+        it = glyphs_.emplace(ch, addGlyph(ch)).first;
+
+    return it->second ? &*it->second : nullptr;
+}
+
+std::optional<DuneGlyphAtlas::Glyph> DuneGlyphAtlas::addGlyph(char32_t ch) {
+    if (!font_->hasGlyph(ch))
+        return std::nullopt;
+
+    const auto surface = font_->createGlyphSurface(ch);
+    if (!surface || surface->w >= ATLAS_WIDTH)
+        return std::nullopt;
+
+    Glyph glyph;
+    glyph.metrics = font_->getGlyphMetrics(ch);
+
+    // Glyphs without any pixels (e.g. space) only move the pen
+    if (surface->w <= 0 || surface->h <= 0)
+        return glyph;
+
+    if (pen_x_ + surface->w > ATLAS_WIDTH) {
+        pen_x_ = 0;
+        pen_y_ += row_height_ + 1;
+        row_height_ = 0;
+    }
+
+    while (!surface_ || pen_y_ + surface->h > surface_->h) {
+        if (!grow())
+            return std::nullopt;
+    }
+
+    SDL_Rect dest{pen_x_, pen_y_, surface->w, surface->h};
+
+    SDL_SetSurfaceBlendMode(surface.get(), SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(surface.get(), nullptr, surface_.get(), &dest);
+
+    // Leave a transparent pixel between the glyphs, so they do not bleed into each other when scaled
+    pen_x_ += surface->w + 1;
+    row_height_ = std::max(row_height_, surface->h);
+    dirty_      = true;
+
+    glyph.source = DuneTextureRect{dest};
+
+    return glyph;
+}
+
+bool DuneGlyphAtlas::grow() {
+    const auto height = surface_ ? 2 * surface_->h
+                                 : static_cast<int>(std::bit_ceil(static_cast<unsigned>(4 * font_->getTextHeight())));
+    if (height > MAX_ATLAS_HEIGHT)
+        return false;
+
+    sdl2::surface_ptr surface{SDL_CreateRGBSurfaceWithFormat(0, ATLAS_WIDTH, height, SCREEN_BPP, SCREEN_FORMAT)};
+    if (!surface)
+        return false;
+
+    SDL_FillRect(surface.get(), nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 0));
+
+    if (surface_) {
+        SDL_SetSurfaceBlendMode(surface_.get(), SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(surface_.get(), nullptr, surface.get(), nullptr);
+    }
+
+    surface_ = std::move(surface);
+    texture_.reset();
+
+    return true;
+}
+
+bool DuneGlyphAtlas::updateTexture(SDL_Renderer* renderer) {
+    if (!texture_ || texture_renderer_ != renderer) {
+        texture_ = sdl2::texture_ptr{
+            SDL_CreateTexture(renderer, SCREEN_FORMAT, SDL_TEXTUREACCESS_STATIC, surface_->w, surface_->h)};
+        if (!texture_)
+            return false;
+
+        SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_BLEND);
+
+        texture_renderer_ = renderer;
+        dirty_            = true;
+    }
+
+    if (dirty_) {
+        if (SDL_UpdateTexture(texture_.get(), nullptr, surface_->pixels, surface_->pitch) < 0)
+            return false;
+
+        dirty_ = false;
+    }
+
+    return true;
+}
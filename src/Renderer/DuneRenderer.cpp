@@ -170,16 +170,14 @@ void Dune_RenderCopy(SDL_Renderer* renderer, SDL_Texture* texture, int x, int y)
     SDL_RenderCopyF(renderer, texture, nullptr, &dest);
 }
 
-#if _DEBUG
+namespace DuneRendererImplementation {
+int render_copies;
+int render_texture_changes;
+SDL_Texture* render_texture;
+DuneRenderStats render_last_frame;
+} // namespace DuneRendererImplementation
 
-void DuneRendererImplementation::countRenderCopy(SDL_Texture* texture) {
-    if (render_texture != texture) {
-        render_texture = texture;
-        ++render_texture_changes;
-    }
-    ++render_copies;
-    ++render_textures[texture];
-}
+#if _DEBUG
 
 void Dune_RenderDump() {
     using namespace DuneRendererImplementation;
@@ -214,13 +212,9 @@ void Dune_RenderDump() {
 }
 
 namespace DuneRendererImplementation {
-int render_copies;
 int render_presents;
 bool render_dump;
 
-SDL_Texture* render_texture;
-int render_texture_changes;
-
 std::map<SDL_Texture*, int> render_textures;
 } // namespace DuneRendererImplementation
 
@@ -0,0 +1,269 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <Renderer/DuneTextureAtlasCache.h>
+
+#include <globals.h>
+
+#include <FileClasses/FileManager.h>
+
+#include <misc/fnkdat.h>
+
+#include <SDL2/SDL_endian.h>
+#include <SDL2/SDL_rwops.h>
+
+#include <system_error>
+
+namespace {
+// Bump this whenever the atlas layout or the way the object pictures are generated changes
+inline constexpr uint32_t CACHE_MAGIC   = 0x43544C44; // "DLTC"
+inline constexpr uint32_t CACHE_VERSION = 2;
+
+bool write_uint16(SDL_RWops* rw, uint16_t value) {
+    return 1 == SDL_WriteLE16(rw, value);
+}
+
+bool write_uint32(SDL_RWops* rw, uint32_t value) {
+    return 1 == SDL_WriteLE32(rw, value);
+}
+
+bool read_uint16(SDL_RWops* rw, uint16_t& value) {
+    uint16_t tmp{};
+    if (1 != SDL_RWread(rw, &tmp, sizeof(tmp), 1))
+        return false;
+
+    value = SDL_SwapLE16(tmp);
+    return true;
+}
+
+bool read_uint32(SDL_RWops* rw, uint32_t& value) {
+    uint32_t tmp{};
+    if (1 != SDL_RWread(rw, &tmp, sizeof(tmp), 1))
+        return false;
+
+    value = SDL_SwapLE32(tmp);
+    return true;
+}
+
+bool write_string(SDL_RWops* rw, std::string_view str) {
+    if (!write_uint32(rw, static_cast<uint32_t>(str.size())))
+        return false;
+
+    return str.empty() || 1 == SDL_RWwrite(rw, str.data(), str.size(), 1);
+}
+
+bool read_string(SDL_RWops* rw, std::string& str, size_t max_length) {
+    uint32_t length = 0;
+    if (!read_uint32(rw, length) || length > max_length)
+        return false;
+
+    str.resize(length);
+
+    return str.empty() || 1 == SDL_RWread(rw, str.data(), str.size(), 1);
+}
+
+bool write_surface(SDL_RWops* rw, SDL_Surface* surface) {
+    if (!write_uint32(rw, surface->w) || !write_uint32(rw, surface->h))
+        return false;
+
+    const sdl2::surface_lock lock{surface};
+
+    const auto* const pixels = static_cast<const char*>(lock.pixels());
+    const auto row_bytes     = static_cast<size_t>(surface->w) * surface->format->BytesPerPixel;
+
+    for (auto y = 0; y < surface->h; ++y) {
+        if (1 != SDL_RWwrite(rw, pixels + static_cast<ptrdiff_t>(y) * lock.pitch(), row_bytes, 1))
+            return false;
+    }
+
+    return true;
+}
+
+sdl2::surface_ptr read_surface(SDL_RWops* rw, uint32_t format, int max_side) {
+    uint32_t w = 0, h = 0;
+    if (!read_uint32(rw, w) || !read_uint32(rw, h))
+        return nullptr;
+
+    if (w == 0 || h == 0 || w > static_cast<uint32_t>(max_side) || h > static_cast<uint32_t>(max_side))
+        return nullptr;
+
+    sdl2::surface_ptr surface{SDL_CreateRGBSurfaceWithFormat(0, static_cast<int>(w), static_cast<int>(h),
+                                                             SDL_BITSPERPIXEL(format), format)};
+    if (!surface)
+        return nullptr;
+
+    const sdl2::surface_lock lock{surface.get()};
+
+    auto* const pixels   = static_cast<char*>(lock.pixels());
+    const auto row_bytes = static_cast<size_t>(w) * surface->format->BytesPerPixel;
+
+    for (auto y = 0; y < surface->h; ++y) {
+        if (1 != SDL_RWread(rw, pixels + static_cast<ptrdiff_t>(y) * lock.pitch(), row_bytes, 1))
+            return nullptr;
+    }
+
+    return surface;
+}
+} // namespace
+
+DuneTextureAtlasCache::DuneTextureAtlasCache(uint32_t format, int max_side)
+    : format_{format}, max_side_{max_side}, key_{createKey(format, max_side)} {
+    auto [ok, cache_path] = fnkdat("cache/", FNKDAT_USER | FNKDAT_CREAT);
+
+    if (ok)
+        directory_ = cache_path.lexically_normal().make_preferred();
+}
+
+std::string DuneTextureAtlasCache::createKey(uint32_t format, int max_side) {
+    auto key = fmt::format("scaler={};format={};max_side={}", dune::globals::settings.video.scaler,
+                           SDL_GetPixelFormatName(format), max_side);
+
+    for (const auto& md5 : dune::globals::pFileManager->getPakFileMD5s()) {
+        key += ';';
+        key += md5;
+    }
+
+    return key;
+}
+
+std::filesystem::path DuneTextureAtlasCache::getPath(int zoom, HOUSETYPE house) const {
+    if (directory_.empty())
+        return {};
+
+    return directory_ / fmt::format("textures_{}_{}.cache", zoom, static_cast<int>(house));
+}
+
+bool DuneTextureAtlasCache::load(int zoom, HOUSETYPE house, sdl2::surface_ptr& atlas, page_rects_type& rects) const {
+    const auto path = getPath(zoom, house);
+    if (path.empty())
+        return false;
+
+    const sdl2::RWops_ptr rw{SDL_RWFromFile(path.u8string(), "rb")};
+    if (!rw)
+        return false;
+
+    uint32_t magic = 0, version = 0;
+    if (!read_uint32(rw.get(), magic) || !read_uint32(rw.get(), version) || magic != CACHE_MAGIC
+        || version != CACHE_VERSION) {
+        sdl2::log_info("Texture cache has an unknown version, rebuilding...");
+        return false;
+    }
+
+    std::string key;
+    if (!read_string(rw.get(), key, 64 * 1024) || key != key_) {
+        sdl2::log_info("Texture cache does not match the game data or settings, rebuilding...");
+        return false;
+    }
+
+    auto surface = read_surface(rw.get(), format_, max_side_);
+    if (!surface) {
+        sdl2::log_warn("Texture cache is truncated or corrupt, rebuilding...");
+        return false;
+    }
+
+    page_rects_type result;
+
+    for (auto& entry : result) {
+        uint16_t location = 0, x = 0, y = 0, w = 0, h = 0;
+        if (!read_uint16(rw.get(), location) || !read_uint16(rw.get(), x) || !read_uint16(rw.get(), y)
+            || !read_uint16(rw.get(), w) || !read_uint16(rw.get(), h)) {
+            sdl2::log_warn("Texture cache is truncated or corrupt, rebuilding...");
+            return false;
+        }
+
+        entry.location = static_cast<Location>(location);
+
+        switch (entry.location) {
+            case Location::None: break;
+
+            case Location::Harkonnen: {
+                if (house == HOUSETYPE::HOUSE_HARKONNEN) {
+                    sdl2::log_warn("Texture cache contains invalid rectangles, rebuilding...");
+                    return false;
+                }
+            } break;
+
+            case Location::Atlas: {
+                if (w == 0 || h == 0 || x + w > surface->w || y + h > surface->h) {
+                    sdl2::log_warn("Texture cache contains invalid rectangles, rebuilding...");
+                    return false;
+                }
+
+                entry.rect = DuneTextureRect::create(x, y, w, h);
+            } break;
+
+            default: {
+                sdl2::log_warn("Texture cache is truncated or corrupt, rebuilding...");
+                return false;
+            }
+        }
+    }
+
+    atlas = std::move(surface);
+    rects = result;
+
+    sdl2::log_info("Loaded the texture atlas for zoom level %d and house %d from the cache", zoom,
+                   static_cast<int>(house));
+
+    return true;
+}
+
+void DuneTextureAtlasCache::save(int zoom, HOUSETYPE house, SDL_Surface* atlas, const page_rects_type& rects) const {
+    const auto path = getPath(zoom, house);
+    if (path.empty() || atlas == nullptr)
+        return;
+
+    auto temp_path = path;
+    temp_path += ".tmp";
+
+    { // Scope
+        const sdl2::RWops_ptr rw{SDL_RWFromFile(temp_path.u8string(), "wb")};
+        if (!rw) {
+            sdl2::log_warn("Unable to create the texture cache: %s", SDL_GetError());
+            return;
+        }
+
+        auto ok = write_uint32(rw.get(), CACHE_MAGIC) && write_uint32(rw.get(), CACHE_VERSION)
+               && write_string(rw.get(), key_) && atlas->format->format == format_
+               && write_surface(rw.get(), atlas);
+
+        for (const auto& entry : rects) {
+            if (!ok)
+                break;
+
+            ok = write_uint16(rw.get(), static_cast<uint16_t>(entry.location)) && write_uint16(rw.get(), entry.rect.x)
+              && write_uint16(rw.get(), entry.rect.y) && write_uint16(rw.get(), entry.rect.w)
+              && write_uint16(rw.get(), entry.rect.h);
+        }
+
+        if (!ok) {
+            sdl2::log_warn("Unable to write the texture cache");
+
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+
+    if (ec) {
+        sdl2::log_warn("Unable to replace the texture cache: %s", ec.message());
+        std::filesystem::remove(temp_path, ec);
+    }
+}
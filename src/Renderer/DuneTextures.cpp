@@ -18,32 +18,22 @@
 #include <Renderer/DuneTextures.h>
 
 #include <FileClasses/SurfaceLoader.h>
+#include <Renderer/DuneTextureAtlasCache.h>
 #include <GUI/ObjectInterfaces/PalaceInterface.h>
+#include <misc/ThreadPool.h>
 #include <rectpack2D/finders_interface.h>
 
+#include <globals.h>
+
 //#include "FileClasses/SaveTextureAsBmp.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <future>
+#include <mutex>
 #include <set>
 
-DuneTextures::DuneTextures() = default;
-
-// clang-format off
-
-DuneTextures::DuneTextures(std::vector<sdl2::texture_ptr>&& textures, object_pictures_type&& object_pictures,
-                           small_details_type&& small_details, tiny_pictures_type&& tiny_pictures,
-                           ui_graphics_type&& ui_graphics, map_choice_type&& map_choice,
-                           generated_type&& generated_pictures,
-                 decoration_border_type&& decoration_border, border_style_type&& border_style)
-    : object_pictures_{object_pictures}, small_details_{small_details}, tiny_pictures_{tiny_pictures},
-      ui_graphics_{ui_graphics}, map_choice_{map_choice}, generated_pictures_{generated_pictures},
-      decoration_border_{decoration_border}, border_style_{border_style},
-      textures_{std::move(textures)} { }
-
-// clang-format on
-
-DuneTextures::~DuneTextures() = default;
-
 namespace {
 inline constexpr bool allow_flip            = false;
 inline constexpr auto runtime_flipping_mode = rectpack2D::flipping_option::DISABLED;
@@ -120,22 +110,69 @@ bool compare_surfaces(SDL_Surface* a, SDL_Surface* b) {
     const sdl2::surface_lock lock_a{a};
     const sdl2::surface_lock lock_b{b};
 
-    const auto* RESTRICT pa = static_cast<const char*>(lock_a.pixels());
-    const auto* RESTRICT pb = static_cast<const char*>(lock_b.pixels());
-
     if (lock_a.pitch() != lock_b.pitch())
         return false;
 
     const auto pitch = lock_a.pitch();
 
-    for (auto i = 0; i < a->h; ++i, pa += pitch, pb += pitch) {
-        if (0 != memcmp(pa, pb, lock_a.pitch()))
+    // The remapped house pictures share their pixels with the Harkonnen picture
+    if (lock_a.pixels() != lock_b.pixels()) {
+        const auto* RESTRICT pa = static_cast<const char*>(lock_a.pixels());
+        const auto* RESTRICT pb = static_cast<const char*>(lock_b.pixels());
+
+        for (auto i = 0; i < a->h; ++i, pa += pitch, pb += pitch) {
+            if (0 != memcmp(pa, pb, pitch))
+                return false;
+        }
+    }
+
+    const auto* const palette_a = a->format->palette;
+    const auto* const palette_b = b->format->palette;
+
+    if (palette_a == palette_b)
+        return true;
+
+    if (!palette_a || !palette_b)
+        return false;
+
+    // The same palette indices only look the same if the palettes have the same colors for them
+    std::array<bool, 256> used{};
+
+    const auto* const pixels = static_cast<const uint8_t*>(lock_a.pixels());
+    for (auto y = 0; y < a->h; ++y) {
+        const auto* const row = pixels + static_cast<ptrdiff_t>(y) * pitch;
+
+        for (auto x = 0; x < a->w; ++x)
+            used[row[x]] = true;
+    }
+
+    for (auto i = 0; i < 256; ++i) {
+        if (!used[i])
+            continue;
+
+        if (i >= palette_a->ncolors || i >= palette_b->ncolors)
+            return false;
+
+        const auto& color_a = palette_a->colors[i];
+        const auto& color_b = palette_b->colors[i];
+
+        if (color_a.r != color_b.r || color_a.g != color_b.g || color_a.b != color_b.b || color_a.a != color_b.a)
             return false;
     }
 
     return true;
 }
 
+sdl2::texture_ptr create_atlas_texture(SDL_Renderer* renderer, SDL_Surface* atlas_surface) {
+    auto texture = sdl2::texture_ptr{SDL_CreateTextureFromSurface(renderer, atlas_surface)};
+
+    if (texture && SDL_SetTextureBlendMode(texture.get(), SDL_BlendMode::SDL_BLENDMODE_BLEND)) {
+        sdl2::log_warn("Unable to set texture atlas blend mode");
+    }
+
+    return texture;
+}
+
 class Packer final {
     std::vector<rect_type> rectangles_;
 
@@ -289,6 +326,8 @@ public:
     }
 
     Identifier operator[](int key) const { return surfaces_.at(key).identifier; }
+
+    [[nodiscard]] bool empty() const noexcept { return surfaces_.empty(); }
 };
 
 class AtlasFactory23 final {
@@ -314,10 +353,19 @@ public:
     }
 
     sdl2::texture_ptr pack(SDL_Renderer* renderer, uint32_t format, int max_side) {
+        const auto atlas_surface = pack_surface(format, max_side);
+
+        if (!atlas_surface)
+            return nullptr;
+
+        return create_atlas_texture(renderer, atlas_surface.get());
+    }
+
+    sdl2::surface_ptr pack_surface(uint32_t format, int max_side) {
         if (!packer_.pack(max_side))
             return nullptr;
 
-        const sdl2::surface_ptr atlas_surface{
+        sdl2::surface_ptr atlas_surface{
             SDL_CreateRGBSurfaceWithFormat(0, packer_.width(), packer_.height(), SDL_BITSPERPIXEL(format), format)};
 
         const auto draw = [&](const auto& r, [[maybe_unused]] int s_idx, SDL_Surface* surface) {
@@ -384,25 +432,24 @@ public:
 
         // SDL_SaveBMP(atlas_surface.get(), path.u8string().c_str());
 
-        auto texture = sdl2::texture_ptr{SDL_CreateTextureFromSurface(renderer, atlas_surface.get())};
-
-        if (texture && SDL_SetTextureBlendMode(texture.get(), SDL_BlendMode::SDL_BLENDMODE_BLEND)) {
-            sdl2::log_warn("Unable to set texture atlas blend mode");
-        }
-
-        return texture;
+        return atlas_surface;
     }
 
     template<typename Identifier, typename Lookup>
     void update(int key, SDL_Texture* texture, Lookup&& lookup) {
         static_assert(std::is_invocable_r<const DuneTexture&, Lookup, int>::value);
 
+        for_each_rect(key, [&](auto s_idx, const SDL_Rect& rect) { lookup(s_idx) = DuneTexture{texture, rect}; });
+    }
+
+    template<typename F>
+    void for_each_rect(int key, F&& f) const {
         const auto& set = surface_sets_.at(key);
 
         set.for_each(packer_, [&](const auto& r, auto s_idx, [[maybe_unused]] auto* surface) {
             const SDL_Rect rect{r.x + guard, r.y + guard, r.w - 2 * guard, r.h - 2 * guard};
 
-            lookup(s_idx) = DuneTexture{texture, rect};
+            f(s_idx, rect);
         });
     }
 
@@ -421,77 +468,59 @@ private:
 
 class ObjectPicturePacker final {
 public:
-    using identifier_type = std::tuple<uint32_t, HOUSETYPE, int>;
-    using textures_type   = DuneTextures::object_pictures_type;
+    using identifier_type = uint32_t;
+    using rects_type      = DuneTextureAtlasCache::page_rects_type;
+    using Location        = DuneTextureAtlasCache::Location;
 
-    void initialize(SurfaceLoader* surfaceLoader) {
+    /// Collects the pictures of one zoom level and house. Pictures identical to the Harkonnen ones are left out.
+    void initialize(SurfaceLoader* surfaceLoader, int zoom, HOUSETYPE house) {
+        const auto is_harkonnen = house == HOUSETYPE::HOUSE_HARKONNEN;
 
         for (auto id = 0u; id < NUM_OBJPICS; ++id) {
             if (id == ObjPic_Bullet_SonicTemp || id == ObjPic_SandwormShimmerTemp)
                 continue;
 
-            const auto harkonnen_only = harkonnen_only_.contains(id);
-
-            for (auto zoom = 0; zoom < NUM_ZOOMLEVEL; ++zoom) {
-                SDL_Surface* harkonnen = nullptr;
-                auto harkonnen_key     = 0;
-
-                for_each_housetype([&](auto house) {
-                    const auto is_harkonnen = house == HOUSETYPE::HOUSE_HARKONNEN;
+            if (!is_harkonnen && harkonnen_only_.contains(id))
+                continue;
 
-                    if (harkonnen_only && !is_harkonnen)
-                        return;
+            auto* const surface = surfaceLoader->getZoomedObjSurface(id, house, zoom);
 
-                    auto* const surface = surfaceLoader->getZoomedObjSurface(id, house, zoom);
+            if (!surface)
+                continue;
 
-                    if (!surface)
-                        return;
+            if (!is_harkonnen) {
+                auto* const harkonnen = surfaceLoader->getZoomedObjSurface(id, HOUSETYPE::HOUSE_HARKONNEN, zoom);
 
-                    if (is_harkonnen) {
-                        harkonnen     = surface;
-                        harkonnen_key = surfaces_.add({id, house, zoom}, surface);
-                    } else if (harkonnen && compare_surfaces(harkonnen, surface)) {
-                        // We are identical to the Harkonnen image, so let it find the Harkonnen version.
-                        surfaces_.add_duplicate(harkonnen_key, {id, house, zoom});
-                    } else {
-                        surfaces_.add({id, house, zoom}, surface);
-                    }
-                });
+                if (harkonnen && compare_surfaces(harkonnen, surface)) {
+                    // We are identical to the Harkonnen image, so let it find the Harkonnen version.
+                    rects_[id].location = Location::Harkonnen;
+                    continue;
+                }
             }
-        }
-    }
 
-    template<typename Predicate>
-    int add(AtlasFactory23& factory23, Predicate&& predicate) {
-        return factory23.add(surfaces_, predicate);
+            surfaces_.add(id, surface);
+        }
     }
 
-    void update(AtlasFactory23& factory23, int key, SDL_Texture* texture) {
-        factory23.update<identifier_type>(key, texture, [&](auto n) -> DuneTexture& { return lookup_dune_texture(n); });
-    }
+    int add(AtlasFactory23& factory23) { return factory23.add(surfaces_); }
 
-    void update_duplicates() {
-        surfaces_.update_duplicates([&](const auto& identifier) -> DuneTexture& {
-            const auto& [id, house, zoom] = identifier;
+    void update(const AtlasFactory23& factory23, int key) {
+        factory23.for_each_rect(key, [&](auto s_idx, const SDL_Rect& rect) {
+            auto& entry = rects_.at(surfaces_[s_idx]);
 
-            return dune_textures_.at(zoom).at(id).at(static_cast<int>(house));
+            entry.location = Location::Atlas;
+            entry.rect     = rect;
         });
     }
 
-    [[nodiscard]] DuneTextures::object_pictures_type object_pictures2() const { return dune_textures_; }
-
-private:
-    [[nodiscard]] DuneTexture& lookup_dune_texture(int n) {
-        const auto identifier = surfaces_[n];
-
-        const auto& [id, house, zoom] = identifier;
+    [[nodiscard]] bool empty() const noexcept { return surfaces_.empty(); }
 
-        return dune_textures_.at(zoom).at(id).at(static_cast<int>(house));
-    }
+    [[nodiscard]] const rects_type& rects() const noexcept { return rects_; }
 
+private:
     PackableSurfaces<identifier_type> surfaces_;
 
-    textures_type dune_textures_;
+    rects_type rects_{};
 
     // There is only one kind of these items, stored in the Harkonnen slot.
     static const std::set<uint32_t> harkonnen_only_;
@@ -867,6 +896,201 @@ private:
 
 } // namespace
 
+/// Creates the object picture atlases one zoom level and house at a time when they are first needed.
+/**
+    Most sessions only ever show one or two zoom levels and a few houses, so building all of them up front would
+    waste startup time and texture memory. The atlas surfaces are built (or loaded from the cache) by build_page(),
+    which may run on the background thread. The textures are always created on the main thread.
+*/
+class DuneTextures::ObjectPictures final {
+public:
+    ObjectPictures(SDL_Renderer* renderer, SurfaceLoader* surfaceLoader, uint32_t format, int max_side)
+        : renderer_{renderer}, surfaceLoader_{surfaceLoader}, format_{format}, max_side_{max_side},
+          atlas_cache_{format, max_side} { }
+
+    ObjectPictures(const ObjectPictures&)            = delete;
+    ObjectPictures(ObjectPictures&&)                 = delete;
+    ObjectPictures& operator=(const ObjectPictures&) = delete;
+    ObjectPictures& operator=(ObjectPictures&&)      = delete;
+
+    [[nodiscard]] const DuneTexture& slot(unsigned int id, HOUSETYPE house, int zoom) const {
+        return pictures_.at(zoom).at(id).at(static_cast<int>(house));
+    }
+
+    void prepare(int zoom, HOUSETYPE house) {
+        const auto h = static_cast<int>(house);
+
+        if (ready_.at(zoom).at(h))
+            return;
+
+        used_[h] = true;
+
+        // The pictures that are identical for all houses are taken from the Harkonnen atlas
+        if (house != HOUSETYPE::HOUSE_HARKONNEN)
+            prepare(zoom, HOUSETYPE::HOUSE_HARKONNEN);
+
+        auto& pending = pending_[zoom][h];
+
+        install_page(zoom, house, pending.valid() ? pending.get() : build_page(zoom, house));
+
+        ready_[zoom][h] = true;
+    }
+
+    void prepare(int zoom) {
+        for_each_housetype([&](auto house) {
+            if (used_[static_cast<int>(house)])
+                prepare(zoom, house);
+        });
+    }
+
+    /// Starts building the atlas of this zoom level and house on the background thread
+    void warm_up(int zoom, HOUSETYPE house) {
+        const auto h = static_cast<int>(house);
+
+        auto& pending = pending_.at(zoom).at(h);
+
+        if (ready_[zoom][h] || pending.valid())
+            return;
+
+        pending = pool_.submit([this, zoom, house] { return build_page(zoom, house); });
+    }
+
+private:
+    struct Page {
+        sdl2::surface_ptr atlas;
+        DuneTextureAtlasCache::page_rects_type rects{};
+    };
+
+    Page build_page(int zoom, HOUSETYPE house) {
+        // The surfaces are shared between the pages, so only build one at a time
+        std::lock_guard lock{build_mutex_};
+
+        Page page;
+
+        if (atlas_cache_.load(zoom, house, page.atlas, page.rects))
+            return page;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        ObjectPicturePacker object_picture_packer;
+        object_picture_packer.initialize(surfaceLoader_, zoom, house);
+
+        if (!object_picture_packer.empty()) {
+            AtlasFactory23 factory23;
+
+            const auto opp_key = object_picture_packer.add(factory23);
+
+            page.atlas = factory23.pack_surface(format_, max_side_);
+
+            if (!page.atlas)
+                THROW(std::runtime_error, "Unable to create object pictures atlas");
+
+            object_picture_packer.update(factory23, opp_key);
+        }
+
+        page.rects = object_picture_packer.rects();
+
+        atlas_cache_.save(zoom, house, page.atlas.get(), page.rects);
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        sdl2::log_info("Object pictures for zoom level %d and house %d time: %f", zoom, static_cast<int>(house),
+                       std::chrono::duration<double>(elapsed).count());
+
+        return page;
+    }
+
+    void install_page(int zoom, HOUSETYPE house, Page page) {
+        using Location = DuneTextureAtlasCache::Location;
+
+        SDL_Texture* texture = nullptr;
+
+        if (page.atlas) {
+            auto atlas_texture = create_atlas_texture(renderer_, page.atlas.get());
+
+            if (!atlas_texture)
+                THROW(std::runtime_error, "Unable to create object pictures texture");
+
+            texture = textures_.emplace_back(std::move(atlas_texture)).get();
+        }
+
+        constexpr auto harkonnen = static_cast<int>(HOUSETYPE::HOUSE_HARKONNEN);
+
+        const auto h = static_cast<int>(house);
+
+        for (auto id = 0; id < NUM_OBJPICS; ++id) {
+            const auto& entry = page.rects[id];
+
+            switch (entry.location) {
+                case Location::Atlas: {
+                    if (!texture)
+                        THROW(std::runtime_error, "Object picture %d has no atlas", id);
+
+                    pictures_[zoom][id][h] = DuneTexture{texture, entry.rect.as_sdl()};
+                } break;
+
+                case Location::Harkonnen: pictures_[zoom][id][h] = pictures_[zoom][id][harkonnen]; break;
+
+                case Location::None:
+                default: break;
+            }
+        }
+    }
+
+    SDL_Renderer* const renderer_;
+    SurfaceLoader* const surfaceLoader_;
+    const uint32_t format_;
+    const int max_side_;
+
+    const DuneTextureAtlasCache atlas_cache_;
+
+    object_pictures_type pictures_{};
+    std::array<std::array<bool, NUM_HOUSES>, NUM_ZOOMLEVEL> ready_{};
+    std::array<std::array<std::future<Page>, NUM_HOUSES>, NUM_ZOOMLEVEL> pending_;
+    std::array<bool, NUM_HOUSES> used_{};
+
+    std::vector<sdl2::texture_ptr> textures_;
+
+    std::mutex build_mutex_;
+
+    dune::ThreadPool pool_{1};
+};
+
+DuneTextures::DuneTextures() = default;
+
+// clang-format off
+
+DuneTextures::DuneTextures(std::vector<sdl2::texture_ptr>&& textures, std::unique_ptr<ObjectPictures>&& object_pictures,
+                           small_details_type&& small_details, tiny_pictures_type&& tiny_pictures,
+                           ui_graphics_type&& ui_graphics, map_choice_type&& map_choice,
+                           generated_type&& generated_pictures,
+                 decoration_border_type&& decoration_border, border_style_type&& border_style)
+    : object_pictures_{std::move(object_pictures)}, small_details_{small_details}, tiny_pictures_{tiny_pictures},
+      ui_graphics_{ui_graphics}, map_choice_{map_choice}, generated_pictures_{generated_pictures},
+      decoration_border_{decoration_border}, border_style_{border_style},
+      textures_{std::move(textures)} { }
+
+// clang-format on
+
+DuneTextures::~DuneTextures() = default;
+
+const DuneTexture& DuneTextures::get_object_picture(unsigned int id, HOUSETYPE house, int zoom) const {
+    object_pictures_->prepare(zoom, house);
+
+    return object_pictures_->slot(id, house, zoom);
+}
+
+const DuneTexture& DuneTextures::get_object_picture_slot(unsigned int id, HOUSETYPE house, int zoom) const {
+    return object_pictures_->slot(id, house, zoom);
+}
+
+void DuneTextures::prepare_object_pictures(int zoom, HOUSETYPE house) const {
+    object_pictures_->prepare(zoom, house);
+}
+
+void DuneTextures::prepare_object_pictures(int zoom) const {
+    object_pictures_->prepare(zoom);
+}
+
 DuneTextures DuneTextures::create(SDL_Renderer* renderer, SurfaceLoader* surfaceLoader) {
     SDL_RendererInfo info;
     SDL_GetRendererInfo(renderer, &info);
@@ -891,7 +1115,13 @@ DuneTextures DuneTextures::create(SDL_Renderer* renderer, SurfaceLoader* surface
         return longest_side;
     }();
 
-    ObjectPicturePacker object_picture_packer;
+    auto object_pictures = std::make_unique<ObjectPictures>(renderer, surfaceLoader, format, max_side);
+
+    // Build the Harkonnen pictures of the preferred zoom level in the background while the rest is set up. Everything
+    // else is created when it is first used.
+    object_pictures->warm_up(std::clamp(dune::globals::settings.video.preferredZoomLevel, 0, NUM_ZOOMLEVEL - 1),
+                             HOUSETYPE::HOUSE_HARKONNEN);
+
     UiGraphicPacker ui_graphic_packer;
     MapChoicePacker map_choice_packer;
     TinyPicturePacker tiny_picture_packer;
@@ -900,7 +1130,6 @@ DuneTextures DuneTextures::create(SDL_Renderer* renderer, SurfaceLoader* surface
     DecorationBorderPicturesPacker decoration_border_packer;
     BorderStylePicturesPacker border_style_pictures_packer;
 
-    object_picture_packer.initialize(surfaceLoader);
     ui_graphic_packer.initialize(surfaceLoader);
     map_choice_packer.initialize(surfaceLoader);
     tiny_picture_packer.initialize(surfaceLoader);
@@ -914,27 +1143,6 @@ DuneTextures DuneTextures::create(SDL_Renderer* renderer, SurfaceLoader* surface
     { // Scope
         AtlasFactory23 factory23;
 
-        for (auto zoom = 0; zoom < NUM_ZOOMLEVEL; ++zoom) {
-
-            const auto opp_key = object_picture_packer.add(
-                factory23, [&](const auto& identifier, [[maybe_unused]] SDL_Surface* surface) {
-                    const auto& [id, h, z] = identifier;
-
-                    return zoom == z;
-                });
-
-            auto texture = factory23.pack(renderer, format, max_side);
-
-            if (!texture)
-                THROW(std::runtime_error, "Unable to create object pictures texture");
-
-            object_picture_packer.update(factory23, opp_key, texture.get());
-
-            textures.emplace_back(std::move(texture));
-
-            factory23.clear();
-        }
-
         assert(factory23.empty());
 
         static const std::set<uint32_t> force_combine_ui_graphic = {
@@ -1027,7 +1235,6 @@ DuneTextures DuneTextures::create(SDL_Renderer* renderer, SurfaceLoader* surface
         }
 
         // Now, fill in duplicates
-        object_picture_packer.update_duplicates();
         ui_graphic_packer.update_duplicates();
         map_choice_packer.update_duplicates();
         tiny_picture_packer.update_duplicates();
@@ -1047,7 +1254,7 @@ DuneTextures DuneTextures::create(SDL_Renderer* renderer, SurfaceLoader* surface
     //}
 
     return DuneTextures{std::move(textures),
-                        object_picture_packer.object_pictures2(),
+                        std::move(object_pictures),
                         small_detail_pics_packer.dune_textures(),
                         tiny_picture_packer.dune_textures(),
                         ui_graphic_packer.dune_textures(),
@@ -1,8 +1,10 @@
 add_sources(RENDERER_SOURCES
+	DuneGlyphAtlas.cpp
 	DuneRenderer.cpp
 	DuneRotateTexture.cpp
 	DuneSurface.cpp
 	DuneTexture.cpp
+	DuneTextureAtlasCache.cpp
 	DuneTextures.cpp
 	DuneTileTexture.cpp
 )
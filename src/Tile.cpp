@@ -619,6 +619,8 @@ void Tile::unassignObject(uint32_t objectID) {
 void Tile::setType(const GameContext& context, TERRAINTYPE newType) {
     const auto& [game, map, objectManager] = context;
 
+    const auto hadSpice = hasSpice();
+
     type_                   = newType;
     destroyedStructureTile_ = DestroyedStructure_None;
 
@@ -677,6 +679,9 @@ void Tile::setType(const GameContext& context, TERRAINTYPE newType) {
         }
     }
 
+    if (hadSpice != hasSpice())
+        map.informSpiceChanged(location_, hasSpice());
+
     map.for_each(location_.x, location_.y, location_.x + 4, location_.y + 4, [](Tile& t) { t.clearTerrain(); });
 }
 
@@ -714,6 +719,9 @@ FixPoint Tile::harvestSpice(const GameContext& context) {
         spice_ = 0;
     }
 
+    if (oldSpice > 0 && spice_ == 0)
+        context.map.informSpiceChanged(location_, false);
+
     if (oldSpice >= RANDOMTHICKSPICEMIN && spice_ < RANDOMTHICKSPICEMIN) {
         setType(context, Terrain_Spice);
     }
@@ -725,7 +733,9 @@ FixPoint Tile::harvestSpice(const GameContext& context) {
     return (oldSpice - spice_);
 }
 
-void Tile::setSpice(FixPoint newSpice) {
+void Tile::setSpice(const GameContext& context, FixPoint newSpice) {
+    const auto hadSpice = hasSpice();
+
     if (newSpice <= 0) {
         type_ = Terrain_Sand;
     } else if (newSpice >= RANDOMTHICKSPICEMIN) {
@@ -734,6 +744,9 @@ void Tile::setSpice(FixPoint newSpice) {
         type_ = Terrain_Spice;
     }
     spice_ = newSpice;
+
+    if (hadSpice != hasSpice())
+        context.map.informSpiceChanged(location_, hasSpice());
 }
 
 AirUnit* Tile::getAirUnit(const ObjectManager& objectManager) const {
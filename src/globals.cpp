@@ -24,6 +24,7 @@
 #include <FileClasses/FontManager.h>
 #include <FileClasses/GFXManager.h>
 #include <FileClasses/SFXManager.h>
+#include <FileClasses/SoundCache.h>
 #include <FileClasses/TextManager.h>
 #include <Network/NetworkManager.h>
 
@@ -51,6 +52,7 @@ std::unique_ptr<MusicPlayer> musicPlayer; ///< manager for playing background mu
 std::unique_ptr<FileManager> pFileManager;       ///< manager for loading files from PAKs
 std::unique_ptr<GFXManager> pGFXManager;         ///< manager for loading and managing graphics
 std::unique_ptr<SFXManager> pSFXManager;         ///< manager for loading and managing sounds
+std::unique_ptr<SoundCache> pSoundCache;         ///< cache of the sounds converted to the audio device format
 std::unique_ptr<FontManager> pFontManager;       ///< manager for loading and managing fonts
 std::unique_ptr<TextManager> pTextManager;       ///< manager for loading and managing texts and providing localization
 std::unique_ptr<NetworkManager> pNetworkManager; ///< manager for all network events (nullptr if not in multiplayer game)
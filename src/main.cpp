@@ -27,6 +27,7 @@
 #include <FileClasses/INIFile.h>
 #include <FileClasses/Palfile.h>
 #include <FileClasses/SFXManager.h>
+#include <FileClasses/SoundCache.h>
 #include <FileClasses/TextManager.h>
 #include <FileClasses/music/ADLPlayer.h>
 #include <FileClasses/music/DirectoryPlayer.h>
@@ -37,6 +38,7 @@
 
 #include <Menu/MainMenu.h>
 
+#include "AITournament.h"
 #include "Game.h"
 #include "ScreenBorder.h"
 #include "misc/dune_events.h"
@@ -121,7 +123,8 @@ void setVideoMode(int displayIndex);
 void realign_buttons();
 
 static void printUsage() {
-    fprintf(stderr, "Usage:\n\tdunelegacy [--showlog] [--fullscreen|--window] [--PlayerName=X] [--ServerPort=X]\n");
+    fprintf(stderr, "Usage:\n\tdunelegacy [--showlog] [--fullscreen|--window] [--PlayerName=X] [--ServerPort=X] "
+                    "[--Tournament=X]\n");
 }
 
 int getLogicalToPhysicalResolutionFactor(int physicalWidth, int physicalHeight) {
@@ -337,6 +340,9 @@ void createDefaultConfigFile(std::filesystem::path configfilepath, const std::st
                                 "Language = %s               # en = English, fr = French, de = German\n"
                                 "Scroll Speed = 50           # Amount to scroll the map when the cursor is near the screen border\n"
                                 "Show Tutorial Hints = true  # Show tutorial hints during the game\n"
+                                "Autosave Interval = 5       # Minutes between two autosaves (0 = no autosave)\n"
+                                "Autosave Slots = 3          # Number of autosave files that are used in turn\n"
+                                "Compress Savegames = true   # Compress savegames and replays\n"
                                 "\n"
                                 "[Video]\n"
                                 "# Minimum resolution is 640x480\n"
@@ -349,6 +355,7 @@ void createDefaultConfigFile(std::filesystem::path configfilepath, const std::st
                                 "Preferred Zoom Level = 1    # 0 = no zooming, 1 = 2x, 2 = 3x\n"
                                 "Scaler = ScaleHD            # Scaler to use: ScaleHD = apply manual drawn mask to upscale, Scale2x = smooth edges, ScaleNN = nearest neighbour, \n"
                                 "RotateUnitGraphics = false  # Freely rotate unit graphics, e.g. carryall graphics\n"
+                                "FogMaskOverlay = false      # Draw unexplored areas and fog of war as one smooth overlay\n"
                                 "\n"
                                 "[Audio]\n"
                                 "# There are three different possibilities to play music\n"
@@ -481,6 +488,9 @@ void load_settings(const INIFile& myINIFile) {
     settings.general.language          = myINIFile.getStringValue("General", "Language", "en");
     settings.general.scrollSpeed       = myINIFile.getIntValue("General", "Scroll Speed", 50);
     settings.general.showTutorialHints = myINIFile.getBoolValue("General", "Show Tutorial Hints", true);
+    settings.general.autosaveInterval  = myINIFile.getIntValue("General", "Autosave Interval", 5);
+    settings.general.autosaveSlots     = myINIFile.getIntValue("General", "Autosave Slots", 3);
+    settings.general.compressSaveGames = myINIFile.getBoolValue("General", "Compress Savegames", true);
     settings.video.width               = myINIFile.getIntValue("Video", "Width", 640);
     settings.video.height              = myINIFile.getIntValue("Video", "Height", 480);
     settings.video.physicalWidth       = myINIFile.getIntValue("Video", "Physical Width", 640);
@@ -492,6 +502,7 @@ void load_settings(const INIFile& myINIFile) {
     settings.video.rotateUnitGraphics  = myINIFile.getBoolValue("Video", "RotateUnitGraphics", false);
     settings.video.renderer            = myINIFile.getStringValue("Video", "Renderer", "default");
     settings.video.typeface            = myINIFile.getStringValue("Video", "Typeface", "default");
+    settings.video.fogMaskOverlay      = myINIFile.getBoolValue("Video", "FogMaskOverlay", false);
     settings.audio.musicType           = myINIFile.getStringValue("Audio", "Music Type", "adl");
     settings.audio.playMusic           = myINIFile.getBoolValue("Audio", "Play Music", true);
     settings.audio.musicVolume         = myINIFile.getIntValue("Audio", "Music Volume", 64);
@@ -730,6 +741,16 @@ bool run_game(int argc, char* argv[]) {
     bool bExitGame       = false;
     bool bFirstInit      = true;
     bool bFirstGamestart = false;
+    bool bOkay           = true;
+
+    std::filesystem::path tournamentFile;
+    for (int i = 1; i < argc; i++) {
+        const std::string parameter(argv[i]);
+
+        if (parameter.compare(0, 13, "--Tournament=") == 0) {
+            tournamentFile = parameter.substr(strlen("--Tournament="));
+        }
+    }
 
     dune::globals::debug       = false;
     dune::globals::cursorFrame = UI_CursorNormal;
@@ -805,6 +826,9 @@ bool run_game(int argc, char* argv[]) {
 
             sdl2::log_info("Loading graphics and sounds...");
 
+            GlobalCleanup sound_cache_cleanup{dune::globals::pSoundCache};
+            dune::globals::pSoundCache = std::make_unique<SoundCache>();
+
             GlobalCleanup sfx_cleanup{dune::globals::pSFXManager};
 #ifdef HAS_ASYNC
             // If we have async, initialize the sounds on another thread while we initialize GFX on this one.
@@ -866,21 +890,28 @@ bool run_game(int argc, char* argv[]) {
             }
 
             // Playing intro
-            if (((bFirstGamestart) || (settings.general.playIntro)) && (bFirstInit)) {
+            if (((bFirstGamestart) || (settings.general.playIntro)) && (bFirstInit) && tournamentFile.empty()) {
                 sdl2::log_info("Playing intro...");
                 Intro().run();
             }
 
             bFirstInit = false;
 
-            sdl2::log_info("Starting main menu...");
-
             { // Scope
                 GlobalCleanup game_cleanup{dune::globals::currentGame};
                 GlobalCleanup border_cleanup{dune::globals::screenborder};
 
-                if (MainMenu().showMenu({}) == MENU_QUIT_DEFAULT) {
+                if (!tournamentFile.empty()) {
+                    sdl2::log_info("Starting AI tournament...");
+
+                    bOkay     = AITournament{tournamentFile}.run();
                     bExitGame = true;
+                } else {
+                    sdl2::log_info("Starting main menu...");
+
+                    if (MainMenu().showMenu({}) == MENU_QUIT_DEFAULT) {
+                        bExitGame = true;
+                    }
                 }
             }
 
@@ -903,7 +934,7 @@ bool run_game(int argc, char* argv[]) {
         sdl2::log_info("Deinitialization finished!");
     } while (!bExitGame);
 
-    return true;
+    return bOkay;
 }
 
 namespace {
@@ -972,7 +1003,8 @@ int main(int argc, char* argv[]) {
                 bShowDebugLog = true;
             } else if ((parameter == "-f") || (parameter == "--fullscreen") || (parameter == "-w")
                        || (parameter == "--window") || (parameter.compare(0, 13, "--PlayerName=") == 0)
-                       || (parameter.compare(0, 13, "--ServerPort=") == 0)) {
+                       || (parameter.compare(0, 13, "--ServerPort=") == 0)
+                       || (parameter.compare(0, 13, "--Tournament=") == 0)) {
                 // normal parameter for overwriting settings
                 // handle later
             } else {
@@ -0,0 +1,137 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/ICompressedStream.h>
+
+#include <misc/exceptions.h>
+
+#include <lodepng.h>
+
+#include <cmath>
+
+ICompressedStream::ICompressedStream(InputStream& source, bool mayBeCompressed) : source(source) {
+    if (!mayBeCompressed) {
+        return;
+    }
+
+    const auto magic = source.readUint32();
+
+    if (magic == COMPRESSEDSTREAMMAGIC) {
+        compressed = true;
+        return;
+    }
+
+    // Not compressed: hand out the four bytes we just consumed before reading from the source again
+    const auto raw = SDL_SwapLE32(magic);
+    buffer.resize(sizeof(raw));
+    memcpy(buffer.data(), &raw, sizeof(raw));
+}
+
+ICompressedStream::~ICompressedStream() = default;
+
+std::string ICompressedStream::readString() {
+    const auto length = readUint32();
+
+    if (length == 0) {
+        return "";
+    }
+
+    std::string str;
+
+    str.resize(length);
+
+    get(str.data(), length);
+
+    return str;
+}
+
+float ICompressedStream::readFloat() {
+    const uint32_t tmp = readUint32();
+    float tmp2         = NAN;
+    memcpy(&tmp2, &tmp, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
+    return tmp2;
+}
+
+void ICompressedStream::getSlow(void* data, size_t length) {
+    auto* out = static_cast<uint8_t*>(data);
+
+    for (;;) {
+        const auto available = std::min(length, buffer.size() - bufferPos);
+
+        if (available != 0) {
+            memcpy(out, buffer.data() + bufferPos, available);
+            bufferPos += available;
+            out += available;
+            length -= available;
+        }
+
+        if (length == 0) {
+            return;
+        }
+
+        if (!compressed) {
+            source.readBytes({out, length});
+            return;
+        }
+
+        if (!readBlock()) {
+            THROW(InputStream::eof, "ICompressedStream::getSlow(): End-of-File reached!");
+        }
+    }
+}
+
+bool ICompressedStream::readBlock() {
+    if (finished) {
+        return false;
+    }
+
+    const auto rawSize = source.readUint32();
+
+    if (rawSize == 0) {
+        finished = true;
+        return false;
+    }
+
+    const auto packedSize = source.readUint32();
+
+    if (rawSize > COMPRESSEDSTREAM_MAX_BLOCKSIZE || packedSize > 2 * COMPRESSEDSTREAM_MAX_BLOCKSIZE) {
+        THROW(InputStream::error, "ICompressedStream::readBlock(): Invalid block size %u (%u compressed)!", rawSize,
+              packedSize);
+    }
+
+    std::vector<uint8_t> packed(packedSize);
+    source.readBytes(packed);
+
+    buffer.clear();
+    bufferPos = 0;
+
+    // Stop inflating at the size the block header promises instead of finding out afterwards
+    LodePNGDecompressSettings settings;
+    lodepng_decompress_settings_init(&settings);
+    settings.max_output_size = rawSize;
+
+    if (const auto error = lodepng::decompress(buffer, packed.data(), packed.size(), settings)) {
+        THROW(InputStream::error, "ICompressedStream::readBlock(): %s", lodepng_error_text(error));
+    }
+
+    if (buffer.size() != rawSize) {
+        THROW(InputStream::error, "ICompressedStream::readBlock(): Expected %u bytes but got %u!", rawSize,
+              static_cast<uint32_t>(buffer.size()));
+    }
+
+    return true;
+}
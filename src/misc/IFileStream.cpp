@@ -19,8 +19,6 @@
 
 #include <misc/exceptions.h>
 
-#include <SDL2/SDL_endian.h>
-
 #include <cmath>
 
 #ifdef _WIN32
@@ -30,7 +28,7 @@
 #    include <Windows.h>
 #endif
 
-IFileStream::IFileStream() : fp(nullptr) { }
+IFileStream::IFileStream() : buffer(bufferSize) { }
 
 IFileStream::~IFileStream() {
     close();
@@ -55,87 +53,71 @@ void IFileStream::close() {
         fclose(fp);
         fp = nullptr;
     }
+
+    bufferPos = 0;
+    bufferEnd = 0;
 }
 
 std::string IFileStream::readString() {
-    uint32_t length = 0;
-
-    length = readUint32();
+    const auto length = readUint32();
 
     if (length == 0) {
         return "";
     }
+
     std::string str;
 
     str.resize(length);
 
-    if (fread(str.data(), length, 1, fp) != 1) {
-        if (feof(fp) != 0) {
-            THROW(InputStream::eof, "IFileStream::readString(): End-of-File reached!");
-        }
-        THROW(InputStream::error, "IFileStream::readString(): An I/O-Error occurred!");
-    }
+    get(str.data(), length, "readString");
 
     return str;
 }
 
-uint8_t IFileStream::readUint8() {
-    uint8_t tmp = 0;
-    if (fread(&tmp, sizeof(uint8_t), 1, fp) != 1) {
-        if (feof(fp) != 0) {
-            THROW(InputStream::eof, "IFileStream::readUint8(): End-of-File reached!");
-        }
-        THROW(InputStream::error, "IFileStream::readUint8(): An I/O-Error occurred!");
-    }
-
-    return tmp;
+float IFileStream::readFloat() {
+    // We could use std::bit_cast from <bit>, but it is unclear
+    // if Xcode supports it yet.
+    // return std::bit_cast<float>(readUint32());
+    const uint32_t tmp = readUint32();
+    float tmp2         = NAN;
+    memcpy(&tmp2, &tmp, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
+    return tmp2;
 }
 
-uint16_t IFileStream::readUint16() {
-    uint16_t tmp = 0;
-    if (fread(&tmp, sizeof(uint16_t), 1, fp) != 1) {
-        if (feof(fp) != 0) {
-            THROW(InputStream::eof, "IFileStream::readUint16(): End-of-File reached!");
-        }
-        THROW(InputStream::error, "IFileStream::readUint16(): An I/O-Error occurred!");
-    }
+void IFileStream::getSlow(void* data, size_t length, const char* caller) {
+    auto* out = static_cast<uint8_t*>(data);
 
-    return SDL_SwapLE16(tmp);
-}
+    const auto available = bufferEnd - bufferPos;
 
-uint32_t IFileStream::readUint32() {
-    uint32_t tmp = 0;
-    if (fread(&tmp, sizeof(uint32_t), 1, fp) != 1) {
-        if (feof(fp) != 0) {
-            THROW(InputStream::eof, "IFileStream::readUint32(): End-of-File reached!");
-        }
-        THROW(InputStream::error, "IFileStream::readUint32(): An I/O-Error occurred!");
-    }
+    memcpy(out, buffer.data() + bufferPos, available);
+    out += available;
+    length -= available;
 
-    return SDL_SwapLE32(tmp);
-}
+    bufferPos = 0;
+    bufferEnd = 0;
+
+    if (fp != nullptr) {
+        if (length >= buffer.size()) {
+            // Large blocks bypass the buffer
+            if (fread(out, length, 1, fp) == 1) {
+                return;
+            }
+        } else {
+            bufferEnd = fread(buffer.data(), 1, buffer.size(), fp);
+
+            if (length <= bufferEnd) {
+                memcpy(out, buffer.data(), length);
+                bufferPos = length;
+                return;
+            }
+
+            bufferPos = bufferEnd;
+        }
 
-uint64_t IFileStream::readUint64() {
-    uint64_t tmp = 0;
-    if (fread(&tmp, sizeof(uint64_t), 1, fp) != 1) {
         if (feof(fp) != 0) {
-            THROW(InputStream::eof, "IFileStream::readUint64(): End-of-File reached!");
+            THROW(InputStream::eof, "IFileStream::%s(): End-of-File reached!", caller);
         }
-        THROW(InputStream::error, "IFileStream::readUint64(): An I/O-Error occurred!");
     }
-    return SDL_SwapLE64(tmp);
-}
 
-bool IFileStream::readBool() {
-    return readUint8() == 1;
-}
-
-float IFileStream::readFloat() {
-    // We could use std::bit_cast from <bit>, but it is unclear
-    // if Xcode supports it yet.
-    // return std::bit_cast<float>(readUint32());
-    const uint32_t tmp = readUint32();
-    float tmp2         = NAN;
-    memcpy(&tmp2, &tmp, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
-    return tmp2;
+    THROW(InputStream::error, "IFileStream::%s(): An I/O-Error occurred!", caller);
 }
@@ -1,5 +1,6 @@
 #include "misc/IMemoryStream.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <memory.h>
@@ -59,6 +60,15 @@ uint64_t IMemoryStream::readUint64() {
     return SDL_SwapLE64(tmp);
 }
 
+void IMemoryStream::readBytes(std::span<uint8_t> data) {
+    if (data.size() > bufferSize - currentPos) {
+        THROW(InputStream::eof, "IMemoryStream::readBytes(): End-of-File reached!");
+    }
+
+    std::copy_n(pBuffer + currentPos, data.size(), data.data());
+    currentPos += data.size();
+}
+
 bool IMemoryStream::readBool() {
     return readUint8() == 1 ? true : false;
 }
@@ -52,13 +52,17 @@ std::vector<uint8_t> InputStream::readUint8Vector() {
     return vec;
 }
 
+void InputStream::readBytes(std::span<uint8_t> data) {
+    for (auto& x : data) {
+        x = readUint8();
+    }
+}
+
 void InputStream::readUint8Vector(std::vector<uint8_t>& vec) {
     vec.clear();
     const auto size = readUint32();
-    vec.reserve(size);
-    for (unsigned int i = 0; i < size; i++) {
-        vec.push_back(readUint8());
-    }
+    vec.resize(size);
+    readBytes(vec);
 }
 
 void InputStream::readUint32Vector(std::vector<uint32_t>& vec) {
@@ -0,0 +1,114 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/MappedFile.h>
+
+#include <misc/exceptions.h>
+
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <Windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace dune {
+
+MappedFile::MappedFile(const std::filesystem::path& filename) {
+    const auto normal = filename.lexically_normal().make_preferred();
+
+#ifdef _WIN32
+    const auto file = CreateFileW(normal.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        THROW(io_error, "Cannot open '%s'!", reinterpret_cast<const char*>(normal.u8string().c_str()));
+    }
+
+    LARGE_INTEGER size{};
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        // The view keeps the mapping alive, so both handles can be closed right away
+        if (const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)) {
+            mapping_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+
+    if (mapping_ != nullptr) {
+        data_ = {static_cast<const uint8_t*>(mapping_), static_cast<size_t>(size.QuadPart)};
+        return;
+    }
+#else
+    const auto fd = open(normal.c_str(), O_RDONLY);
+    if (fd < 0) {
+        THROW(io_error, "Cannot open '%s'!", reinterpret_cast<const char*>(normal.u8string().c_str()));
+    }
+
+    struct stat st { };
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        auto* const address = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED)
+            mapping_ = address;
+    }
+
+    close(fd);
+
+    if (mapping_ != nullptr) {
+        data_ = {static_cast<const uint8_t*>(mapping_), static_cast<size_t>(st.st_size)};
+        return;
+    }
+#endif
+
+    readFile(normal);
+}
+
+MappedFile::~MappedFile() {
+    if (mapping_ == nullptr)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(mapping_);
+#else
+    munmap(mapping_, data_.size());
+#endif
+}
+
+void MappedFile::readFile(const std::filesystem::path& filename) {
+    std::ifstream in{filename, std::ios::binary};
+    if (!in) {
+        THROW(io_error, "Cannot open '%s'!", reinterpret_cast<const char*>(filename.u8string().c_str()));
+    }
+
+    content_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+
+    if (in.bad()) {
+        THROW(io_error, "Cannot read '%s'!", reinterpret_cast<const char*>(filename.u8string().c_str()));
+    }
+
+    data_ = content_;
+}
+
+} // namespace dune
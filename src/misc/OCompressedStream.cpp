@@ -0,0 +1,116 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/OCompressedStream.h>
+
+#include <misc/ICompressedStream.h>
+#include <misc/exceptions.h>
+
+#include <lodepng.h>
+
+#include <algorithm>
+
+OCompressedStream::OCompressedStream(OutputStream& target, size_t prefixLength)
+    : target(target), prefixLength(prefixLength) {
+    buffer.reserve(blockSize);
+
+    if (prefixLength == 0) {
+        target.writeUint32(COMPRESSEDSTREAMMAGIC);
+    }
+}
+
+OCompressedStream::~OCompressedStream() = default;
+
+void OCompressedStream::finish() {
+    if (finished) {
+        return;
+    }
+
+    if (prefixLength != 0) {
+        // Less data than the prefix was written; there is nothing to compress
+        target.writeUint32(COMPRESSEDSTREAMMAGIC);
+        prefixLength = 0;
+    }
+
+    writeBlock();
+    target.writeUint32(0);
+
+    finished = true;
+}
+
+void OCompressedStream::flush() {
+    if (prefixLength == 0 && !finished) {
+        writeBlock();
+    }
+
+    target.flush();
+}
+
+void OCompressedStream::putSlow(const void* data, size_t length) {
+    if (finished) {
+        THROW(OutputStream::error, "OCompressedStream::putSlow(): Cannot write after finish()!");
+    }
+
+    const auto* in = static_cast<const uint8_t*>(data);
+
+    if (prefixLength != 0) {
+        const auto raw = std::min(length, prefixLength);
+
+        target.writeBytes({in, raw});
+        in += raw;
+        length -= raw;
+        prefixLength -= raw;
+
+        if (prefixLength != 0) {
+            return;
+        }
+
+        target.writeUint32(COMPRESSEDSTREAMMAGIC);
+    }
+
+    while (length != 0) {
+        if (buffer.size() == blockSize) {
+            writeBlock();
+        }
+
+        const auto n = std::min(length, blockSize - buffer.size());
+
+        buffer.insert(buffer.end(), in, in + n);
+        in += n;
+        length -= n;
+    }
+}
+
+void OCompressedStream::writeBlock() {
+    static_assert(blockSize <= COMPRESSEDSTREAM_MAX_BLOCKSIZE);
+
+    if (buffer.empty()) {
+        return;
+    }
+
+    std::vector<uint8_t> packed;
+
+    if (const auto error = lodepng::compress(packed, buffer.data(), buffer.size())) {
+        THROW(OutputStream::error, "OCompressedStream::writeBlock(): %s", lodepng_error_text(error));
+    }
+
+    target.writeUint32(static_cast<uint32_t>(buffer.size()));
+    target.writeUint32(static_cast<uint32_t>(packed.size()));
+    target.writeBytes(packed);
+
+    buffer.clear();
+}
@@ -19,8 +19,6 @@
 
 #include <misc/exceptions.h>
 
-#include <SDL2/SDL_endian.h>
-
 #ifdef _WIN32
 #    ifndef WIN32_LEAN_AND_MEAN
 #        define WIN32_LEAN_AND_MEAN
@@ -28,10 +26,13 @@
 #    include <Windows.h>
 #endif
 
-OFileStream::OFileStream() = default;
+OFileStream::OFileStream() : buffer(bufferSize) { }
 
 OFileStream::~OFileStream() {
-    close();
+    if (fp != nullptr) {
+        writeBuffer();
+        fclose(fp);
+    }
 }
 
 bool OFileStream::open(const std::filesystem::path& filename) {
@@ -49,63 +50,56 @@ bool OFileStream::open(const std::filesystem::path& filename) {
 }
 
 void OFileStream::close() {
-    if (fp != nullptr) {
-        fclose(fp);
-        fp = nullptr;
+    if (fp == nullptr) {
+        bufferPos = 0;
+        return;
     }
-}
 
-void OFileStream::flush() {
-    if (fp != nullptr) {
-        fflush(fp);
-    }
-}
+    const auto written = writeBuffer();
 
-void OFileStream::writeString(std::string_view str) {
-    writeUint32(str.length());
+    const auto closed = fclose(fp) == 0;
+    fp                = nullptr;
 
-    if (!str.empty()) {
-        if (fwrite(str.data(), str.length(), 1, fp) != 1) {
-            THROW(OutputStream::error, "OFileStream::writeString(): An I/O-Error occurred!");
-        }
+    if (!written || !closed) {
+        THROW(OutputStream::error, "OFileStream::close(): An I/O-Error occurred!");
     }
 }
 
-void OFileStream::writeUint8(uint8_t x) {
-    if (fwrite(&x, sizeof(uint8_t), 1, fp) != 1) {
-        THROW(OutputStream::error, "OFileStream::writeUint8(): An I/O-Error occurred!");
+void OFileStream::flush() {
+    if (fp == nullptr) {
+        return;
     }
-}
 
-void OFileStream::writeUint16(uint16_t x) {
-    x = SDL_SwapLE16(x);
-
-    if (fwrite(&x, sizeof(uint16_t), 1, fp) != 1) {
-        THROW(OutputStream::error, "OFileStream::writeUint16(): An I/O-Error occurred!");
+    if (!writeBuffer() || fflush(fp) != 0) {
+        THROW(OutputStream::error, "OFileStream::flush(): An I/O-Error occurred!");
     }
 }
 
-void OFileStream::writeUint32(uint32_t x) {
-    x = SDL_SwapLE32(x);
+void OFileStream::putSlow(const void* data, size_t length) {
+    if (!writeBuffer()) {
+        THROW(OutputStream::error, "OFileStream::putSlow(): An I/O-Error occurred!");
+    }
+
+    if (length < buffer.size()) {
+        memcpy(buffer.data(), data, length);
+        bufferPos = length;
+        return;
+    }
 
-    if (fwrite(&x, sizeof(uint32_t), 1, fp) != 1) {
-        THROW(OutputStream::error, "OFileStream::writeUint32(): An I/O-Error occurred!");
+    // Large blocks bypass the buffer
+    if (fp == nullptr || fwrite(data, length, 1, fp) != 1) {
+        THROW(OutputStream::error, "OFileStream::putSlow(): An I/O-Error occurred!");
     }
 }
 
-void OFileStream::writeUint64(uint64_t x) {
-    x = SDL_SwapLE64(x);
-    if (fwrite(&x, sizeof(uint64_t), 1, fp) != 1) {
-        THROW(OutputStream::error, "OFileStream::writeUint64(): An I/O-Error occurred!");
+bool OFileStream::writeBuffer() noexcept {
+    if (bufferPos == 0) {
+        return true;
     }
-}
 
-void OFileStream::writeBool(bool x) {
-    writeUint8(x ? 1 : 0);
-}
+    const auto ok = fp != nullptr && fwrite(buffer.data(), bufferPos, 1, fp) == 1;
+
+    bufferPos = 0;
 
-void OFileStream::writeFloat(float x) {
-    uint32_t tmp = 0;
-    memcpy(&tmp, &x, sizeof(uint32_t)); // workaround for a strange optimization in gcc 4.1
-    writeUint32(tmp);
+    return ok;
 }
@@ -33,11 +33,15 @@ void OutputStream::writeBools(bool val1, bool val2, bool val3, bool val4, bool v
     writeUint8(val);
 }
 
+void OutputStream::writeBytes(std::span<const uint8_t> data) {
+    for (const auto x : data) {
+        writeUint8(x);
+    }
+}
+
 void OutputStream::writeUint8Vector(std::span<const uint8_t> dataVector) {
     writeUint32(static_cast<uint32_t>(dataVector.size()));
-    for (const auto data : dataVector) {
-        writeUint8(data);
-    }
+    writeBytes(dataVector);
 }
 
 void OutputStream::writeUint32Vector(std::span<const uint32_t> dataVector) {
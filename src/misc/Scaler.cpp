@@ -19,6 +19,7 @@
 
 #include "Definitions.h"
 #include "misc/draw_util.h"
+#include "misc/scaler_kernels.h"
 
 #include <algorithm>
 
@@ -232,64 +233,19 @@ sdl2::surface_ptr Scaler::doubleTiledSurfaceScale2x(SDL_Surface* src, int tilesX
     sdl2::surface_lock return_lock{returnPic.get()};
     sdl2::surface_lock src_lock{src};
 
-    const auto* RESTRICT srcPixels = static_cast<uint8_t*>(src->pixels);
-    auto* RESTRICT destPixels      = static_cast<uint8_t*>(returnPic->pixels);
+    const auto* const srcPixels = static_cast<const uint8_t*>(src->pixels);
+    auto* const destPixels      = static_cast<uint8_t*>(returnPic->pixels);
 
     const auto source_pitch      = src->pitch;
     const auto destination_pitch = returnPic->pitch;
 
     for (int j = 0; j < tilesY; ++j) {
         for (int i = 0; i < tilesX; ++i) {
-
-            /*
-
-            Scale center pixel E into 4 new pixels
-
-                Source            Dest
-            +---+---+---+
-            | A | B | C |       +--+--+
-            +---+---+---+       |E0|E1|
-            | D | E | F |   ->  +--+--+
-            +---+---+---+       |E2|E3|
-            | G | H | I |       +--+--+
-            +---+---+---+
-
-            */
-
-            for (int y = 0; y < tileHeight; ++y) {
-                for (int x = 0; x < tileWidth; ++x) {
-                    uint8_t E = srcPixels[(j * tileHeight + y) * source_pitch + (i * tileWidth + x)];
-                    const uint8_t B =
-                        srcPixels[(j * tileHeight + std::max(0, y - 1)) * source_pitch + (i * tileWidth + x)];
-                    const uint8_t H = srcPixels[(j * tileHeight + std::min(tileHeight - 1, y + 1)) * source_pitch
-                                                + (i * tileWidth + x)];
-                    uint8_t D = srcPixels[(j * tileHeight + y) * source_pitch + (i * tileWidth + std::max(0, x - 1))];
-                    uint8_t F = srcPixels[(j * tileHeight + y) * source_pitch
-                                          + (i * tileWidth + std::min(tileWidth - 1, x + 1))];
-
-                    uint8_t E0 = 0;
-                    uint8_t E1 = 0;
-                    uint8_t E2 = 0;
-                    uint8_t E3 = 0;
-
-                    if (B != H && D != F) {
-                        E0 = D == B ? D : E;
-                        E1 = B == F ? F : E;
-                        E2 = D == H ? D : E;
-                        E3 = H == F ? F : E;
-                    } else {
-                        E0 = E;
-                        E1 = E;
-                        E2 = E;
-                        E3 = E;
-                    }
-
-                    destPixels[(j * tileHeight + y) * 2 * destination_pitch + (i * tileWidth + x) * 2]           = E0;
-                    destPixels[(j * tileHeight + y) * 2 * destination_pitch + (i * tileWidth + x) * 2 + 1]       = E1;
-                    destPixels[((j * tileHeight + y) * 2 + 1) * destination_pitch + (i * tileWidth + x) * 2]     = E2;
-                    destPixels[((j * tileHeight + y) * 2 + 1) * destination_pitch + (i * tileWidth + x) * 2 + 1] = E3;
-                }
-            }
+            dune::scaler::scale2x(srcPixels + static_cast<ptrdiff_t>(j * tileHeight) * source_pitch + i * tileWidth,
+                                  source_pitch,
+                                  destPixels + static_cast<ptrdiff_t>(j * tileHeight * 2) * destination_pitch
+                                      + i * tileWidth * 2,
+                                  destination_pitch, tileWidth, tileHeight);
         }
     }
 
@@ -334,91 +290,19 @@ sdl2::surface_ptr Scaler::tripleTiledSurfaceScale3x(SDL_Surface* src, int tilesX
     sdl2::surface_lock return_lock{returnPic.get()};
     sdl2::surface_lock src_lock{src};
 
-    const auto* RESTRICT source = static_cast<uint8_t*>(src->pixels);
-    auto* RESTRICT destination  = static_cast<uint8_t*>(returnPic->pixels);
+    const auto* const source = static_cast<const uint8_t*>(src->pixels);
+    auto* const destination  = static_cast<uint8_t*>(returnPic->pixels);
 
     const auto source_pitch      = src->pitch;
     const auto destination_pitch = returnPic->pitch;
 
     for (int j = 0; j < tilesY; ++j) {
         for (int i = 0; i < tilesX; ++i) {
-
-            /*
-
-            Scale center pixel E into 4 new pixels
-
-                Source             Dest
-            +---+---+---+       +--+--+--+
-            | A | B | C |       |E0|E1|E2|
-            +---+---+---+       +--+--+--+
-            | D | E | F |   ->  |E3|E4|E5|
-            +---+---+---+       +--+--+--+
-            | G | H | I |       |E6|E7|E8|
-            +---+---+---+       +--+--+--+
-
-            */
-
-            for (int y = 0; y < tileHeight; ++y) {
-                for (int x = 0; x < tileWidth; ++x) {
-                    const uint8_t A = source[(j * tileHeight + std::max(0, y - 1)) * source_pitch
-                                             + (i * tileWidth + std::max(0, x - 1))];
-                    uint8_t B = source[(j * tileHeight + std::max(0, y - 1)) * source_pitch + (i * tileWidth + x)];
-                    const uint8_t C = source[(j * tileHeight + std::max(0, y - 1)) * source_pitch
-                                             + (i * tileWidth + std::min(tileWidth - 1, x + 1))];
-                    uint8_t D = source[(j * tileHeight + y) * source_pitch + (i * tileWidth + std::max(0, x - 1))];
-                    uint8_t E = source[(j * tileHeight + y) * source_pitch + (i * tileWidth + x)];
-                    uint8_t F =
-                        source[(j * tileHeight + y) * source_pitch + (i * tileWidth + std::min(tileWidth - 1, x + 1))];
-                    const uint8_t G = source[(j * tileHeight + std::min(tileHeight - 1, y + 1)) * source_pitch
-                                             + (i * tileWidth + std::max(0, x - 1))];
-                    uint8_t H =
-                        source[(j * tileHeight + std::min(tileHeight - 1, y + 1)) * source_pitch + (i * tileWidth + x)];
-                    const uint8_t I = source[(j * tileHeight + std::min(tileHeight - 1, y + 1)) * source_pitch
-                                             + (i * tileWidth + std::min(tileWidth - 1, x + 1))];
-
-                    uint8_t E0 = 0;
-                    uint8_t E1 = 0;
-                    uint8_t E2 = 0;
-                    uint8_t E3 = 0;
-                    uint8_t E4 = 0;
-                    uint8_t E5 = 0;
-                    uint8_t E6 = 0;
-                    uint8_t E7 = 0;
-                    uint8_t E8 = 0;
-
-                    if (B != H && D != F) {
-                        E0 = D == B ? D : E;
-                        E1 = (D == B && E != C) || (B == F && E != A) ? B : E;
-                        E2 = B == F ? F : E;
-                        E3 = (D == B && E != G) || (D == H && E != A) ? D : E;
-                        E4 = E;
-                        E5 = (B == F && E != I) || (H == F && E != C) ? F : E;
-                        E6 = D == H ? D : E;
-                        E7 = (D == H && E != I) || (H == F && E != G) ? H : E;
-                        E8 = H == F ? F : E;
-                    } else {
-                        E0 = E;
-                        E1 = E;
-                        E2 = E;
-                        E3 = E;
-                        E4 = E;
-                        E5 = E;
-                        E6 = E;
-                        E7 = E;
-                        E8 = E;
-                    }
-
-                    destination[(j * tileHeight + y) * 3 * destination_pitch + (i * tileWidth + x) * 3]           = E0;
-                    destination[(j * tileHeight + y) * 3 * destination_pitch + (i * tileWidth + x) * 3 + 1]       = E1;
-                    destination[(j * tileHeight + y) * 3 * destination_pitch + (i * tileWidth + x) * 3 + 2]       = E2;
-                    destination[((j * tileHeight + y) * 3 + 1) * destination_pitch + (i * tileWidth + x) * 3]     = E3;
-                    destination[((j * tileHeight + y) * 3 + 1) * destination_pitch + (i * tileWidth + x) * 3 + 1] = E4;
-                    destination[((j * tileHeight + y) * 3 + 1) * destination_pitch + (i * tileWidth + x) * 3 + 2] = E5;
-                    destination[((j * tileHeight + y) * 3 + 2) * destination_pitch + (i * tileWidth + x) * 3]     = E6;
-                    destination[((j * tileHeight + y) * 3 + 2) * destination_pitch + (i * tileWidth + x) * 3 + 1] = E7;
-                    destination[((j * tileHeight + y) * 3 + 2) * destination_pitch + (i * tileWidth + x) * 3 + 2] = E8;
-                }
-            }
+            dune::scaler::scale3x(source + static_cast<ptrdiff_t>(j * tileHeight) * source_pitch + i * tileWidth,
+                                  source_pitch,
+                                  destination + static_cast<ptrdiff_t>(j * tileHeight * 3) * destination_pitch
+                                      + i * tileWidth * 3,
+                                  destination_pitch, tileWidth, tileHeight);
         }
     }
 
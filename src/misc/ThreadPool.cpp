@@ -0,0 +1,67 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/ThreadPool.h>
+
+namespace dune {
+
+ThreadPool::ThreadPool(unsigned int thread_count) {
+    threads_.reserve(thread_count);
+
+    for (auto i = 0u; i < thread_count; ++i)
+        threads_.emplace_back([this] { worker(); });
+}
+
+ThreadPool::~ThreadPool() {
+    { // Scope
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+    }
+
+    cv_.notify_all();
+
+    for (auto& thread : threads_)
+        thread.join();
+}
+
+unsigned int ThreadPool::default_thread_count() {
+    const auto hardware = std::thread::hardware_concurrency();
+
+    return hardware > 1 ? hardware - 1 : 1u;
+}
+
+void ThreadPool::worker() {
+    for (;;) {
+        std::function<void()> task;
+
+        { // Scope
+            std::unique_lock lock{mutex_};
+
+            cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+
+            if (queue_.empty())
+                return;
+
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        task();
+    }
+}
+
+} // namespace dune
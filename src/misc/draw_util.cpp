@@ -23,6 +23,7 @@
 
 #include <globals.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <mutex>
 
@@ -523,25 +524,62 @@ sdl2::surface_ptr mapSurfaceColorRange(SDL_Surface* source, int srcColor, int de
 
     sdl2::surface_ptr retPic{SDL_ConvertSurface(source, source->format, 0)};
 
-    if (!source)
+    if (!retPic)
         THROW(std::runtime_error, "mapSurfaceColorRange(): Cannot copy image!");
 
     if (retPic->format->BytesPerPixel == 1) {
         SDL_SetSurfaceBlendMode(retPic.get(), SDL_BLENDMODE_NONE);
     }
 
-    const sdl2::surface_lock lock{retPic.get()};
+    const auto colorMap = createColorRangeMap(srcColor, destColor);
 
-    auto* const pixels = static_cast<uint8_t*>(lock.pixels());
+    mapColor(retPic.get(), colorMap.data());
 
-    for (auto y = 0; y < retPic->h; ++y) {
-        auto* p = &pixels[static_cast<ptrdiff_t>(y * lock.pitch())];
-        for (auto x = 0; x < retPic->w; ++x, ++p) {
-            if (*p >= srcColor && *p < srcColor + 7)
-                *p -= srcColor - destColor;
-        }
+    return retPic;
+}
+
+std::array<uint8_t, 256> createColorRangeMap(int srcColor, int destColor) {
+    std::array<uint8_t, 256> colorMap{};
+
+    for (auto i = 0; i < 256; ++i)
+        colorMap[i] = static_cast<uint8_t>(i >= srcColor && i < srcColor + 7 ? i - srcColor + destColor : i);
+
+    return colorMap;
+}
+
+sdl2::surface_ptr mapSurfacePaletteColorRange(SDL_Surface* source, int srcColor, int destColor) {
+    if (!source)
+        THROW(std::runtime_error, "mapSurfacePaletteColorRange(): Null source!");
+
+    const auto* const palette = source->format->palette;
+
+    if (source->format->BytesPerPixel != 1 || !palette || SDL_MUSTLOCK(source))
+        THROW(std::invalid_argument, "mapSurfacePaletteColorRange(): Source has to be an unlocked 8-bit surface!");
+
+    sdl2::surface_ptr retPic{SDL_CreateRGBSurfaceWithFormatFrom(source->pixels, source->w, source->h, 8,
+                                                                source->pitch, source->format->format)};
+
+    if (!retPic || !retPic->format->palette)
+        THROW(std::runtime_error, "mapSurfacePaletteColorRange(): Cannot create surface: %s!", SDL_GetError());
+
+    const auto colorMap = createColorRangeMap(srcColor, destColor);
+
+    std::array<SDL_Color, 256> colors{};
+    for (auto i = 0; i < palette->ncolors && i < 256; ++i)
+        colors[i] = palette->colors[colorMap[i] < palette->ncolors ? colorMap[i] : i];
+
+    SDL_SetPaletteColors(retPic->format->palette, colors.data(), 0, std::min(palette->ncolors, 256));
+
+    if (SDL_HasColorKey(source)) {
+        uint32_t ckey = 0;
+        SDL_GetColorKey(source, &ckey);
+        SDL_SetColorKey(retPic.get(), SDL_TRUE, ckey);
     }
 
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    SDL_GetSurfaceBlendMode(source, &blendMode);
+    SDL_SetSurfaceBlendMode(retPic.get(), blendMode);
+
     return retPic;
 }
 
@@ -0,0 +1,354 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/scaler_kernels.h>
+
+#include "Definitions.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define DUNE_SCALER_SSE2 1
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    define DUNE_SCALER_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace {
+
+/*
+
+    Scale center pixel E into 4 (Scale2x) or 9 (Scale3x) new pixels
+
+        Source            Scale2x            Scale3x
+    +---+---+---+                          +--+--+--+
+    | A | B | C |         +--+--+          |E0|E1|E2|
+    +---+---+---+         |E0|E1|          +--+--+--+
+    | D | E | F |   ->    +--+--+    or    |E3|E4|E5|
+    +---+---+---+         |E2|E3|          +--+--+--+
+    | G | H | I |         +--+--+          |E6|E7|E8|
+    +---+---+---+                          +--+--+--+
+
+*/
+
+inline void scale2x_pixel(const uint8_t* RESTRICT above, const uint8_t* RESTRICT row, const uint8_t* RESTRICT below,
+                          uint8_t* RESTRICT out0, uint8_t* RESTRICT out1, int x, int width) {
+    const uint8_t B = above[x];
+    const uint8_t D = row[std::max(0, x - 1)];
+    const uint8_t E = row[x];
+    const uint8_t F = row[std::min(width - 1, x + 1)];
+    const uint8_t H = below[x];
+
+    if (B != H && D != F) {
+        out0[2 * x]     = D == B ? D : E;
+        out0[2 * x + 1] = B == F ? F : E;
+        out1[2 * x]     = D == H ? D : E;
+        out1[2 * x + 1] = H == F ? F : E;
+    } else {
+        out0[2 * x]     = E;
+        out0[2 * x + 1] = E;
+        out1[2 * x]     = E;
+        out1[2 * x + 1] = E;
+    }
+}
+
+inline void scale3x_pixel(const uint8_t* RESTRICT above, const uint8_t* RESTRICT row, const uint8_t* RESTRICT below,
+                          uint8_t* RESTRICT out0, uint8_t* RESTRICT out1, uint8_t* RESTRICT out2, int x, int width) {
+    const auto left  = std::max(0, x - 1);
+    const auto right = std::min(width - 1, x + 1);
+
+    const uint8_t A = above[left];
+    const uint8_t B = above[x];
+    const uint8_t C = above[right];
+    const uint8_t D = row[left];
+    const uint8_t E = row[x];
+    const uint8_t F = row[right];
+    const uint8_t G = below[left];
+    const uint8_t H = below[x];
+    const uint8_t I = below[right];
+
+    if (B != H && D != F) {
+        out0[3 * x]     = D == B ? D : E;
+        out0[3 * x + 1] = (D == B && E != C) || (B == F && E != A) ? B : E;
+        out0[3 * x + 2] = B == F ? F : E;
+        out1[3 * x]     = (D == B && E != G) || (D == H && E != A) ? D : E;
+        out1[3 * x + 1] = E;
+        out1[3 * x + 2] = (B == F && E != I) || (H == F && E != C) ? F : E;
+        out2[3 * x]     = D == H ? D : E;
+        out2[3 * x + 1] = (D == H && E != I) || (H == F && E != G) ? H : E;
+        out2[3 * x + 2] = H == F ? F : E;
+    } else {
+        for (auto i = 0; i < 3; ++i) {
+            out0[3 * x + i] = E;
+            out1[3 * x + i] = E;
+            out2[3 * x + i] = E;
+        }
+    }
+}
+
+#if DUNE_SCALER_SSE2 || DUNE_SCALER_NEON
+
+inline constexpr auto LANES = 16;
+
+#    if DUNE_SCALER_SSE2
+using vec = __m128i;
+
+inline vec load(const uint8_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline vec eq(vec a, vec b) {
+    return _mm_cmpeq_epi8(a, b);
+}
+
+inline vec ne(vec a, vec b) {
+    return _mm_xor_si128(_mm_cmpeq_epi8(a, b), _mm_set1_epi8(-1));
+}
+
+inline vec and_(vec a, vec b) {
+    return _mm_and_si128(a, b);
+}
+
+inline vec or_(vec a, vec b) {
+    return _mm_or_si128(a, b);
+}
+
+/// mask ? a : b for each byte
+inline vec select(vec mask, vec a, vec b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+inline void store_interleaved(uint8_t* p, vec a, vec b) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_unpacklo_epi8(a, b));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p + LANES), _mm_unpackhi_epi8(a, b));
+}
+
+inline void store_interleaved(uint8_t* RESTRICT p, vec a, vec b, vec c) {
+    // SSE2 has no byte shuffle, so the 3-way interleave goes through the stack
+    alignas(16) uint8_t tmp[3][LANES];
+
+    _mm_store_si128(reinterpret_cast<__m128i*>(tmp[0]), a);
+    _mm_store_si128(reinterpret_cast<__m128i*>(tmp[1]), b);
+    _mm_store_si128(reinterpret_cast<__m128i*>(tmp[2]), c);
+
+    for (auto i = 0; i < LANES; ++i) {
+        p[3 * i]     = tmp[0][i];
+        p[3 * i + 1] = tmp[1][i];
+        p[3 * i + 2] = tmp[2][i];
+    }
+}
+#    else
+using vec = uint8x16_t;
+
+inline vec load(const uint8_t* p) {
+    return vld1q_u8(p);
+}
+
+inline vec eq(vec a, vec b) {
+    return vceqq_u8(a, b);
+}
+
+inline vec ne(vec a, vec b) {
+    return vmvnq_u8(vceqq_u8(a, b));
+}
+
+inline vec and_(vec a, vec b) {
+    return vandq_u8(a, b);
+}
+
+inline vec or_(vec a, vec b) {
+    return vorrq_u8(a, b);
+}
+
+/// mask ? a : b for each byte
+inline vec select(vec mask, vec a, vec b) {
+    return vbslq_u8(mask, a, b);
+}
+
+inline void store_interleaved(uint8_t* p, vec a, vec b) {
+    vst2q_u8(p, uint8x16x2_t{{a, b}});
+}
+
+inline void store_interleaved(uint8_t* p, vec a, vec b, vec c) {
+    vst3q_u8(p, uint8x16x3_t{{a, b, c}});
+}
+#    endif
+
+/**
+    Scales the pixels [x, end) of one row with the same rules as scale2x_pixel(). All neighbours have to be inside
+    the row, i.e. x >= 1 and end <= width - 1.
+    \return the first pixel that was not scaled
+*/
+int scale2x_row_simd(const uint8_t* RESTRICT above, const uint8_t* RESTRICT row, const uint8_t* RESTRICT below,
+                     uint8_t* RESTRICT out0, uint8_t* RESTRICT out1, int x, int end) {
+    for (; x + LANES <= end; x += LANES) {
+        const auto B = load(above + x);
+        const auto D = load(row + x - 1);
+        const auto E = load(row + x);
+        const auto F = load(row + x + 1);
+        const auto H = load(below + x);
+
+        const auto cond = and_(ne(B, H), ne(D, F));
+
+        store_interleaved(out0 + 2 * x, select(and_(cond, eq(D, B)), D, E), select(and_(cond, eq(B, F)), F, E));
+        store_interleaved(out1 + 2 * x, select(and_(cond, eq(D, H)), D, E), select(and_(cond, eq(H, F)), F, E));
+    }
+
+    return x;
+}
+
+/**
+    Scales the pixels [x, end) of one row with the same rules as scale3x_pixel(). All neighbours have to be inside
+    the row, i.e. x >= 1 and end <= width - 1.
+    \return the first pixel that was not scaled
+*/
+int scale3x_row_simd(const uint8_t* RESTRICT above, const uint8_t* RESTRICT row, const uint8_t* RESTRICT below,
+                     uint8_t* RESTRICT out0, uint8_t* RESTRICT out1, uint8_t* RESTRICT out2, int x, int end) {
+    for (; x + LANES <= end; x += LANES) {
+        const auto A = load(above + x - 1);
+        const auto B = load(above + x);
+        const auto C = load(above + x + 1);
+        const auto D = load(row + x - 1);
+        const auto E = load(row + x);
+        const auto F = load(row + x + 1);
+        const auto G = load(below + x - 1);
+        const auto H = load(below + x);
+        const auto I = load(below + x + 1);
+
+        const auto cond = and_(ne(B, H), ne(D, F));
+
+        const auto DB = and_(cond, eq(D, B));
+        const auto BF = and_(cond, eq(B, F));
+        const auto DH = and_(cond, eq(D, H));
+        const auto HF = and_(cond, eq(H, F));
+
+        const auto E0 = select(DB, D, E);
+        const auto E1 = select(or_(and_(DB, ne(E, C)), and_(BF, ne(E, A))), B, E);
+        const auto E2 = select(BF, F, E);
+        const auto E3 = select(or_(and_(DB, ne(E, G)), and_(DH, ne(E, A))), D, E);
+        const auto E5 = select(or_(and_(BF, ne(E, I)), and_(HF, ne(E, C))), F, E);
+        const auto E6 = select(DH, D, E);
+        const auto E7 = select(or_(and_(DH, ne(E, I)), and_(HF, ne(E, G))), H, E);
+        const auto E8 = select(HF, F, E);
+
+        store_interleaved(out0 + 3 * x, E0, E1, E2);
+        store_interleaved(out1 + 3 * x, E3, E, E5);
+        store_interleaved(out2 + 3 * x, E6, E7, E8);
+    }
+
+    return x;
+}
+
+#endif // DUNE_SCALER_SSE2 || DUNE_SCALER_NEON
+
+} // namespace
+
+namespace dune::scaler {
+
+void scale2x_scalar(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height) {
+    for (auto y = 0; y < height; ++y) {
+        const auto* const above = src + static_cast<ptrdiff_t>(std::max(0, y - 1)) * src_pitch;
+        const auto* const row   = src + static_cast<ptrdiff_t>(y) * src_pitch;
+        const auto* const below = src + static_cast<ptrdiff_t>(std::min(height - 1, y + 1)) * src_pitch;
+
+        auto* const out0 = dst + static_cast<ptrdiff_t>(2 * y) * dst_pitch;
+        auto* const out1 = out0 + dst_pitch;
+
+        for (auto x = 0; x < width; ++x)
+            scale2x_pixel(above, row, below, out0, out1, x, width);
+    }
+}
+
+void scale2x(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height) {
+#if DUNE_SCALER_SSE2 || DUNE_SCALER_NEON
+    for (auto y = 0; y < height; ++y) {
+        const auto* const above = src + static_cast<ptrdiff_t>(std::max(0, y - 1)) * src_pitch;
+        const auto* const row   = src + static_cast<ptrdiff_t>(y) * src_pitch;
+        const auto* const below = src + static_cast<ptrdiff_t>(std::min(height - 1, y + 1)) * src_pitch;
+
+        auto* const out0 = dst + static_cast<ptrdiff_t>(2 * y) * dst_pitch;
+        auto* const out1 = out0 + dst_pitch;
+
+        // The first and last pixel need their neighbours clamped, so they are always done one at a time
+        auto x = 0;
+        if (width > 0)
+            scale2x_pixel(above, row, below, out0, out1, x++, width);
+
+        x = scale2x_row_simd(above, row, below, out0, out1, x, width - 1);
+
+        for (; x < width; ++x)
+            scale2x_pixel(above, row, below, out0, out1, x, width);
+    }
+#else
+    scale2x_scalar(src, src_pitch, dst, dst_pitch, width, height);
+#endif
+}
+
+void scale3x_scalar(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height) {
+    for (auto y = 0; y < height; ++y) {
+        const auto* const above = src + static_cast<ptrdiff_t>(std::max(0, y - 1)) * src_pitch;
+        const auto* const row   = src + static_cast<ptrdiff_t>(y) * src_pitch;
+        const auto* const below = src + static_cast<ptrdiff_t>(std::min(height - 1, y + 1)) * src_pitch;
+
+        auto* const out0 = dst + static_cast<ptrdiff_t>(3 * y) * dst_pitch;
+        auto* const out1 = out0 + dst_pitch;
+        auto* const out2 = out1 + dst_pitch;
+
+        for (auto x = 0; x < width; ++x)
+            scale3x_pixel(above, row, below, out0, out1, out2, x, width);
+    }
+}
+
+void scale3x(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, int width, int height) {
+#if DUNE_SCALER_SSE2 || DUNE_SCALER_NEON
+    for (auto y = 0; y < height; ++y) {
+        const auto* const above = src + static_cast<ptrdiff_t>(std::max(0, y - 1)) * src_pitch;
+        const auto* const row   = src + static_cast<ptrdiff_t>(y) * src_pitch;
+        const auto* const below = src + static_cast<ptrdiff_t>(std::min(height - 1, y + 1)) * src_pitch;
+
+        auto* const out0 = dst + static_cast<ptrdiff_t>(3 * y) * dst_pitch;
+        auto* const out1 = out0 + dst_pitch;
+        auto* const out2 = out1 + dst_pitch;
+
+        // The first and last pixel need their neighbours clamped, so they are always done one at a time
+        auto x = 0;
+        if (width > 0)
+            scale3x_pixel(above, row, below, out0, out1, out2, x++, width);
+
+        x = scale3x_row_simd(above, row, below, out0, out1, out2, x, width - 1);
+
+        for (; x < width; ++x)
+            scale3x_pixel(above, row, below, out0, out1, out2, x, width);
+    }
+#else
+    scale3x_scalar(src, src_pitch, dst, dst_pitch, width, height);
+#endif
+}
+
+const char* simd_name() noexcept {
+#if DUNE_SCALER_SSE2
+    return "SSE2";
+#elif DUNE_SCALER_NEON
+    return "NEON";
+#else
+    return "none";
+#endif
+}
+
+} // namespace dune::scaler
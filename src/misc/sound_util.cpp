@@ -2,6 +2,7 @@
 #include <misc/sound_util.h>
 
 #include <FileClasses/FileManager.h>
+#include <FileClasses/SoundCache.h>
 #include <FileClasses/Vocfile.h>
 
 #include <misc/SDL2pp.h>
@@ -134,6 +135,9 @@ sdl2::mix_chunk_ptr createSilenceChunk(int length) {
 }
 
 sdl2::mix_chunk_ptr getChunkFromFile(std::string_view filename) {
+    if (auto* const sound_cache = dune::globals::pSoundCache.get())
+        return sound_cache->loadVOC(filename);
+
     auto returnChunk = LoadVOC_RW(dune::globals::pFileManager->openFile(filename).get());
     if (returnChunk == nullptr) {
         THROW(io_error, "Cannot load '%s'!", filename);
@@ -6,16 +6,21 @@ add_sources(MISC_SOURCES
 	dune_events.cpp
 	FileSystem.cpp
 	fnkdat.cpp
+	ICompressedStream.cpp
 	IFileStream.cpp
 	IMemoryStream.cpp
 	InputStream.cpp
+	MappedFile.cpp
 	md5.cpp
+	OCompressedStream.cpp
 	OFileStream.cpp
-	#OMemoryStream.cpp
+	OMemoryStream.cpp
 	OutputStream.cpp
 	Random.cpp
 	Scaler.cpp
+	scaler_kernels.cpp
 	SDL_LogRenderer.cpp
 	sound_util.cpp
 	string_util.cpp
+	ThreadPool.cpp
 )
@@ -175,6 +175,63 @@ std::string utf8Substr(std::string_view str, size_t pos, size_t len) {
     return result;
 }
 
+std::u32string utf8Decode(std::string_view str) {
+    static constexpr auto replacement = U'\uFFFD';
+
+    std::u32string result;
+    result.reserve(str.length());
+
+    auto iter = str.cbegin();
+    while (iter != str.cend()) {
+        const auto c = static_cast<unsigned char>(*iter++);
+
+        size_t numContinuation = 0;
+        char32_t codePoint     = 0;
+        char32_t minimum       = 0;
+        if ((c & 0x80) == 0) {
+            // 1 byte: 0xxxxxxx
+            result += c;
+            continue;
+        }
+        if ((c & 0xE0) == 0xC0) {
+            // 2 byte: 110xxxxx 10xxxxxx
+            numContinuation = 1;
+            codePoint       = c & 0x1Fu;
+            minimum         = 0x80;
+        } else if ((c & 0xF0) == 0xE0) {
+            // 3 byte: 1110xxxx 10xxxxxx 10xxxxxx
+            numContinuation = 2;
+            codePoint       = c & 0x0Fu;
+            minimum         = 0x800;
+        } else if ((c & 0xF8) == 0xF0) {
+            // 4 byte: 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+            numContinuation = 3;
+            codePoint       = c & 0x07u;
+            minimum         = 0x10000;
+        } else {
+            // invalid => skip
+            result += replacement;
+            continue;
+        }
+
+        if (static_cast<size_t>(str.cend() - iter) < numContinuation
+            || !std::all_of(iter, iter + static_cast<ptrdiff_t>(numContinuation),
+                            [](char b) { return (static_cast<unsigned char>(b) & 0xC0) == 0x80; })) {
+            result += replacement;
+            continue;
+        }
+
+        for (; numContinuation > 0; --numContinuation)
+            codePoint = (codePoint << 6) | (static_cast<unsigned char>(*iter++) & 0x3Fu);
+
+        const auto valid = codePoint >= minimum && codePoint <= 0x10FFFF && (codePoint < 0xD800 || codePoint > 0xDFFF);
+
+        result += valid ? codePoint : replacement;
+    }
+
+    return result;
+}
+
 std::vector<std::string>
 greedyWordWrap(std::string_view text, float linewidth, std::function<float(std::string_view)> pGetTextWidth) {
     // split text into single lines at every '\n'
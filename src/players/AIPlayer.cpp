@@ -24,6 +24,7 @@
 #include <Map.h>
 #include <sand.h>
 
+#include <players/DefenderSelection.h>
 #include <structures/BuilderBase.h>
 #include <structures/ConstructionYard.h>
 #include <structures/StarPort.h>
@@ -36,6 +37,8 @@
 #include <array>
 
 inline constexpr auto AIUPDATEINTERVAL = 50;
+inline constexpr auto AIBUILDSLICE     = 0;                    ///< the cycle of the update interval to build in
+inline constexpr auto AIATTACKSLICE    = AIUPDATEINTERVAL / 2; ///< the cycle of the update interval to attack in
 
 AIPlayer::AIPlayer(const GameContext& context, House* associatedHouse, const std::string& playername,
                    const Random& random, Difficulty difficulty)
@@ -77,23 +80,26 @@ void AIPlayer::save(OutputStream& stream) const {
 }
 
 void AIPlayer::update() {
-    if ((getGameCycleCount() + static_cast<int>(getHouse()->getHouseID())) % AIUPDATEINTERVAL != 0) {
-        // we are not updating this AI player this cycle
-        return;
-    }
+    // The units are checked a few at a time every cycle. Building and attacking happen once per interval but in
+    // different cycles
+    const auto slice = getUpdateSlice(AIUPDATEINTERVAL);
 
-    checkAllUnits();
+    checkAllUnits(slice);
 
-    if (buildTimer <= 0) {
-        build();
-    } else {
-        buildTimer -= AIUPDATEINTERVAL;
+    if (slice == AIBUILDSLICE) {
+        if (buildTimer <= 0) {
+            build();
+        } else {
+            buildTimer -= AIUPDATEINTERVAL;
+        }
     }
 
-    if (attackTimer <= 0) {
-        attack();
-    } else {
-        attackTimer -= AIUPDATEINTERVAL;
+    if (slice == AIATTACKSLICE) {
+        if (attackTimer <= 0) {
+            attack();
+        } else {
+            attackTimer -= AIUPDATEINTERVAL;
+        }
     }
 }
 
@@ -131,17 +137,8 @@ void AIPlayer::onDamage(const ObjectBase* pObject, [[maybe_unused]] int damage,
 }
 
 void AIPlayer::scrambleUnitsAndDefend(const ObjectBase* pIntruder) {
-    for (const auto* pUnit : getUnitList()) {
-        if (pUnit->isRespondable() && (pUnit->getOwner() == getHouse())) {
-            if ((pUnit->getAttackMode() != HUNT) && !pUnit->hasATarget()) {
-                const auto itemID = pUnit->getItemID();
-                if ((itemID != Unit_Harvester) && (itemID != Unit_MCV) && (itemID != Unit_Carryall)
-                    && (itemID != Unit_Frigate) && (itemID != Unit_Saboteur) && (itemID != Unit_Sandworm)) {
-                    doAttackObject(pUnit, pIntruder, true);
-                }
-            }
-        }
-    }
+    dune::ai::scrambleFreeDefenders(getOwnUnitList(),
+                                    [&](const UnitBase* pUnit) { doAttackObject(pUnit, pIntruder, true); });
 }
 
 Coord AIPlayer::findPlaceLocation(ItemID_enum itemID) {
@@ -160,17 +157,15 @@ Coord AIPlayer::findPlaceLocation(ItemID_enum itemID) {
         maxX = getMap().getSizeX() - 1;
         maxY = getMap().getSizeY() - 1;
     } else {
-        for (const auto* pStructure : getStructureList()) {
-            if (pStructure->getOwner() == getHouse()) {
-                if (pStructure->getX() < minX)
-                    minX = pStructure->getX();
-                if (pStructure->getX() > maxX)
-                    maxX = pStructure->getX();
-                if (pStructure->getY() < minY)
-                    minY = pStructure->getY();
-                if (pStructure->getY() > maxY)
-                    maxY = pStructure->getY();
-            }
+        for (const auto* pStructure : getOwnStructureList()) {
+            if (pStructure->getX() < minX)
+                minX = pStructure->getX();
+            if (pStructure->getX() > maxX)
+                maxX = pStructure->getX();
+            if (pStructure->getY() < minY)
+                minY = pStructure->getY();
+            if (pStructure->getY() > maxY)
+                maxY = pStructure->getY();
         }
     }
 
@@ -212,7 +207,7 @@ Coord AIPlayer::findPlaceLocation(ItemID_enum itemID) {
                 case Structure_Refinery: {
                     // place near spice
                     Coord spicePos;
-                    if (getMap().findSpice(spicePos, pos)) {
+                    if (getMap().findSpice(spicePos, pos, getRandomGen())) {
                         rating = 10000000 - blockDistance(pos, spicePos);
                     } else {
                         rating = 10000000;
@@ -221,12 +216,10 @@ Coord AIPlayer::findPlaceLocation(ItemID_enum itemID) {
 
                 case Structure_ConstructionYard: {
                     FixPoint nearestUnit = 10000000;
-                    for (const auto* pUnit : getUnitList()) {
-                        if (pUnit->getOwner() == getHouse()) {
-                            const auto distance = blockDistance(pos, pUnit->getLocation());
-                            if (distance < nearestUnit) {
-                                nearestUnit = distance;
-                            }
+                    for (const auto* pUnit : getOwnUnitList()) {
+                        const auto distance = blockDistance(pos, pUnit->getLocation());
+                        if (distance < nearestUnit) {
+                            nearestUnit = distance;
                         }
                     }
 
@@ -334,350 +327,345 @@ int AIPlayer::getNumAdjacentStructureTiles(Coord pos, int structureSizeX, int st
 
 void AIPlayer::build() {
     bool bConstructionYardChecked = false;
-    for (const StructureBase* pStructure : getStructureList()) {
+    for (const StructureBase* pStructure : getOwnStructureList()) {
         // if this players structure, and its a heavy factory, build something
-        if (pStructure->getOwner() == getHouse()) {
+        if ((!pStructure->isRepairing()) && (pStructure->getHealth() < pStructure->getMaxHealth())) {
+            doRepair(pStructure);
+        }
+
+        if (pStructure->isABuilder()) {
+            const auto* pBuilder = static_cast<const BuilderBase*>(pStructure);
 
-            if ((!pStructure->isRepairing()) && (pStructure->getHealth() < pStructure->getMaxHealth())) {
-                doRepair(pStructure);
+            if ((getHouse()->getCredits() > 2000) && (pBuilder->getHealth() >= pBuilder->getMaxHealth())
+                && (!pBuilder->isUpgrading())
+                && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
+                doUpgrade(pBuilder);
+                continue;
             }
 
-            if (pStructure->isABuilder()) {
-                const auto* pBuilder = static_cast<const BuilderBase*>(pStructure);
+            switch (pStructure->getItemID()) {
 
-                if ((getHouse()->getCredits() > 2000) && (pBuilder->getHealth() >= pBuilder->getMaxHealth())
-                    && (!pBuilder->isUpgrading())
-                    && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
-                    doUpgrade(pBuilder);
-                    continue;
-                }
+                case Structure_Barracks: {
+                    if (isAllowedToArm() && (!getHouse()->hasLightFactory()) && (!getHouse()->hasHeavyFactory())) {
+                        if ((getHouse()->getCredits() > 1500) && (pBuilder->getProductionQueueSize() < 1)
+                            && (pBuilder->getBuildListSize() > 0)) {
+                            doBuildRandom(pBuilder);
+                        }
+                    }
+                } break;
 
-                switch (pStructure->getItemID()) {
+                case Structure_LightFactory: {
+                    if (isAllowedToArm() && !getHouse()->hasHeavyFactory()) {
+                        if ((getHouse()->getCredits() > 1500) && (pBuilder->getProductionQueueSize() < 1)
+                            && (pBuilder->getBuildListSize() > 0)) {
+                            doBuildRandom(pBuilder);
+                        }
+                    }
+                } break;
 
-                    case Structure_Barracks: {
-                        if (isAllowedToArm() && (!getHouse()->hasLightFactory()) && (!getHouse()->hasHeavyFactory())) {
-                            if ((getHouse()->getCredits() > 1500) && (pBuilder->getProductionQueueSize() < 1)
-                                && (pBuilder->getBuildListSize() > 0)) {
-                                doBuildRandom(pBuilder);
-                            }
+                case Structure_WOR: {
+                    if (isAllowedToArm() && !getHouse()->hasHeavyFactory()) {
+                        if ((getHouse()->getCredits() > 1500) && (pBuilder->getProductionQueueSize() < 1)
+                            && (pBuilder->getBuildListSize() > 0)) {
+                            doBuildRandom(pBuilder);
                         }
-                    } break;
+                    }
+                } break;
 
-                    case Structure_LightFactory: {
-                        if (isAllowedToArm() && !getHouse()->hasHeavyFactory()) {
-                            if ((getHouse()->getCredits() > 1500) && (pBuilder->getProductionQueueSize() < 1)
-                                && (pBuilder->getBuildListSize() > 0)) {
-                                doBuildRandom(pBuilder);
+                case Structure_HeavyFactory: {
+                    if (isAllowedToArm() && (pBuilder->getProductionQueueSize() < 1)
+                        && (pBuilder->getBuildListSize() > 0)) {
+
+                        if (getHouse()->getNumItems(Unit_Harvester) < getMaxHarvester()) {
+                            doProduceItem(pBuilder, Unit_Harvester);
+                        } else if (getHouse()->getCredits() > 1500) {
+                            const auto numTanks = getHouse()->getNumItems(Unit_Devastator)
+                                                + getHouse()->getNumItems(Unit_SiegeTank)
+                                                + getHouse()->getNumItems(Unit_Tank);
+                            const auto numLauncher =
+                                getHouse()->getNumItems(Unit_Launcher) + getHouse()->getNumItems(Unit_Deviator);
+
+                            if (pBuilder->isAvailableToBuild(Unit_SonicTank)) {
+                                doProduceItem(pBuilder, Unit_SonicTank);
+                            } else if (pBuilder->isAvailableToBuild(Unit_Devastator) && numTanks <= 5 * numLauncher
+                                       && getHouse()->getNumItems(Unit_Devastator)
+                                              < getHouse()->getNumItems(Unit_SiegeTank)) {
+                                doProduceItem(pBuilder, Unit_Devastator);
+                            } else if (pBuilder->isAvailableToBuild(Unit_Deviator)
+                                       && 5 * getHouse()->getNumItems(Unit_Deviator) <= numTanks) {
+                                doProduceItem(pBuilder, Unit_Deviator);
+                            } else if (pBuilder->isAvailableToBuild(Unit_SiegeTank) && numTanks <= 5 * numLauncher) {
+                                doProduceItem(pBuilder, Unit_SiegeTank);
+                            } else if (pBuilder->isAvailableToBuild(Unit_Launcher) && 5 * numLauncher <= numTanks) {
+                                doProduceItem(pBuilder, Unit_Launcher);
+                            } else if (pBuilder->isAvailableToBuild(Unit_SiegeTank)) {
+                                doProduceItem(pBuilder, Unit_SiegeTank);
+                            } else if (pBuilder->isAvailableToBuild(Unit_Tank)) {
+                                doProduceItem(pBuilder, Unit_Tank);
                             }
                         }
-                    } break;
+                    }
+                } break;
 
-                    case Structure_WOR: {
-                        if (isAllowedToArm() && !getHouse()->hasHeavyFactory()) {
-                            if ((getHouse()->getCredits() > 1500) && (pBuilder->getProductionQueueSize() < 1)
-                                && (pBuilder->getBuildListSize() > 0)) {
-                                doBuildRandom(pBuilder);
-                            }
+                case Structure_HighTechFactory: {
+                    if (isAllowedToArm() && (getHouse()->getCredits() > 800)
+                        && (pBuilder->getProductionQueueSize() < 1)) {
+
+                        if (getHouse()->getNumItems(Unit_Carryall)
+                            < (getHouse()->getNumItems(Unit_Harvester) + 1) / 2) {
+                            doProduceItem(pBuilder, Unit_Carryall);
+                        } else if (getHouse()->getCredits() > 2500) {
+                            doProduceItem(pBuilder, Unit_Ornithopter);
                         }
-                    } break;
+                    }
+                } break;
 
-                    case Structure_HeavyFactory: {
-                        if (isAllowedToArm() && (pBuilder->getProductionQueueSize() < 1)
-                            && (pBuilder->getBuildListSize() > 0)) {
+                case Structure_StarPort: {
+                    const auto* pStarPort = static_cast<const StarPort*>(pBuilder);
+                    if (isAllowedToArm() && pStarPort->okToOrder()) {
+                        const auto& choam = getHouse()->getChoam();
 
-                            if (getHouse()->getNumItems(Unit_Harvester) < getMaxHarvester()) {
+                        if (getHouse()->getNumItems(Unit_Harvester) < getMaxHarvester()
+                            && choam.getNumAvailable(Unit_Harvester) > 0) {
+                            if (getHouse()->getCredits() > 300) {
                                 doProduceItem(pBuilder, Unit_Harvester);
-                            } else if (getHouse()->getCredits() > 1500) {
-                                const auto numTanks = getHouse()->getNumItems(Unit_Devastator)
-                                                    + getHouse()->getNumItems(Unit_SiegeTank)
-                                                    + getHouse()->getNumItems(Unit_Tank);
-                                const auto numLauncher =
-                                    getHouse()->getNumItems(Unit_Launcher) + getHouse()->getNumItems(Unit_Deviator);
-
-                                if (pBuilder->isAvailableToBuild(Unit_SonicTank)) {
-                                    doProduceItem(pBuilder, Unit_SonicTank);
-                                } else if (pBuilder->isAvailableToBuild(Unit_Devastator) && numTanks <= 5 * numLauncher
-                                           && getHouse()->getNumItems(Unit_Devastator)
-                                                  < getHouse()->getNumItems(Unit_SiegeTank)) {
-                                    doProduceItem(pBuilder, Unit_Devastator);
-                                } else if (pBuilder->isAvailableToBuild(Unit_Deviator)
-                                           && 5 * getHouse()->getNumItems(Unit_Deviator) <= numTanks) {
-                                    doProduceItem(pBuilder, Unit_Deviator);
-                                } else if (pBuilder->isAvailableToBuild(Unit_SiegeTank)
-                                           && numTanks <= 5 * numLauncher) {
+                                if (getHouse()->getCredits() > 300 && choam.getNumAvailable(Unit_Harvester) > 0) {
+                                    doProduceItem(pBuilder, Unit_Harvester);
+                                }
+                                doPlaceOrder(pStarPort);
+                            }
+                        } else if (getHouse()->getNumItems(Unit_Carryall)
+                                       < (getHouse()->getNumItems(Unit_Harvester) + 1) / 2
+                                   && choam.getNumAvailable(Unit_Carryall) > 0) {
+                            if (getHouse()->getCredits() > 800) {
+                                doProduceItem(pBuilder, Unit_Carryall);
+                                doPlaceOrder(pStarPort);
+                            }
+                        } else {
+                            // order max 6 units
+                            auto num = 6;
+                            while ((num > 0) && (getHouse()->getCredits() > 2000)) {
+                                if (pStarPort->isAvailableToBuild(Unit_SiegeTank)
+                                    && choam.getNumAvailable(Unit_SiegeTank) > 0 && choam.isCheap(Unit_SiegeTank)) {
                                     doProduceItem(pBuilder, Unit_SiegeTank);
-                                } else if (pBuilder->isAvailableToBuild(Unit_Launcher) && 5 * numLauncher <= numTanks) {
+                                } else if (pStarPort->isAvailableToBuild(Unit_Launcher)
+                                           && choam.getNumAvailable(Unit_Launcher) > 0
+                                           && choam.isCheap(Unit_Launcher)) {
                                     doProduceItem(pBuilder, Unit_Launcher);
-                                } else if (pBuilder->isAvailableToBuild(Unit_SiegeTank)) {
-                                    doProduceItem(pBuilder, Unit_SiegeTank);
-                                } else if (pBuilder->isAvailableToBuild(Unit_Tank)) {
+                                } else if (pStarPort->isAvailableToBuild(Unit_Tank)
+                                           && choam.getNumAvailable(Unit_Tank) > 0 && choam.isCheap(Unit_Tank)) {
                                     doProduceItem(pBuilder, Unit_Tank);
+                                } else if (pStarPort->isAvailableToBuild(Unit_Quad)
+                                           && choam.getNumAvailable(Unit_Quad) > 0 && choam.isCheap(Unit_Quad)) {
+                                    doProduceItem(pBuilder, Unit_Quad);
+                                } else if (pStarPort->isAvailableToBuild(Unit_Trike)
+                                           && choam.getNumAvailable(Unit_Trike) > 0 && choam.isCheap(Unit_Trike)) {
+                                    doProduceItem(pBuilder, Unit_Trike);
                                 }
+                                num--;
                             }
+                            doPlaceOrder(pStarPort);
                         }
-                    } break;
-
-                    case Structure_HighTechFactory: {
-                        if (isAllowedToArm() && (getHouse()->getCredits() > 800)
-                            && (pBuilder->getProductionQueueSize() < 1)) {
-
-                            if (getHouse()->getNumItems(Unit_Carryall)
-                                < (getHouse()->getNumItems(Unit_Harvester) + 1) / 2) {
-                                doProduceItem(pBuilder, Unit_Carryall);
-                            } else if (getHouse()->getCredits() > 2500) {
-                                doProduceItem(pBuilder, Unit_Ornithopter);
-                            }
-                        }
-                    } break;
+                    }
+                } break;
 
-                    case Structure_StarPort: {
-                        const auto* pStarPort = static_cast<const StarPort*>(pBuilder);
-                        if (isAllowedToArm() && pStarPort->okToOrder()) {
-                            const auto& choam = getHouse()->getChoam();
+                case Structure_ConstructionYard: {
+                    if ((getHouse()->getCredits() > 900)
+                        && ((pBuilder->getCurrentUpgradeLevel() == 0) || (getHouse()->hasRadar()))
+                        && (pBuilder->getHealth() >= pBuilder->getMaxHealth()) && (!pBuilder->isUpgrading())
+                        && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
+                        (void)doUpgrade(pBuilder);
+                    }
 
-                            if (getHouse()->getNumItems(Unit_Harvester) < getMaxHarvester()
-                                && choam.getNumAvailable(Unit_Harvester) > 0) {
-                                if (getHouse()->getCredits() > 300) {
-                                    doProduceItem(pBuilder, Unit_Harvester);
-                                    if (getHouse()->getCredits() > 300 && choam.getNumAvailable(Unit_Harvester) > 0) {
-                                        doProduceItem(pBuilder, Unit_Harvester);
-                                    }
-                                    doPlaceOrder(pStarPort);
-                                }
-                            } else if (getHouse()->getNumItems(Unit_Carryall)
-                                           < (getHouse()->getNumItems(Unit_Harvester) + 1) / 2
-                                       && choam.getNumAvailable(Unit_Carryall) > 0) {
-                                if (getHouse()->getCredits() > 800) {
-                                    doProduceItem(pBuilder, Unit_Carryall);
-                                    doPlaceOrder(pStarPort);
+                    if (!bConstructionYardChecked && !pBuilder->isUpgrading()) {
+                        bConstructionYardChecked = true;
+                        if (getHouse()->getCredits() > 100) {
+                            if ((pBuilder->getProductionQueueSize() < 1) && (pBuilder->getBuildListSize() > 0)) {
+                                auto itemID = ItemID_enum::ItemID_Invalid;
+                                if (getHouse()->getProducedPower() - getHouse()->getPowerRequirement() < 50
+                                    && pBuilder->isAvailableToBuild(Structure_WindTrap)) {
+                                    itemID = Structure_WindTrap;
+                                } else if (getHouse()->getNumItems(Structure_Refinery) < 3
+                                           && pBuilder->isAvailableToBuild(Structure_Refinery)) {
+                                    itemID = Structure_Refinery;
+                                } else if ((!getHouse()->hasRadar()) && pBuilder->isAvailableToBuild(Structure_Radar)) {
+                                    itemID = Structure_Radar;
+                                } else if ((getHouse()->getNumItems(Structure_StarPort) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_StarPort)) {
+                                    itemID = Structure_StarPort;
+                                } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 1)
+                                           && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
+                                    itemID = Structure_RocketTurret;
+                                } else if ((!getHouse()->hasLightFactory())
+                                           && pBuilder->isAvailableToBuild(Structure_LightFactory)) {
+                                    itemID = Structure_LightFactory;
+                                } else if ((getHouse()->getNumItems(Structure_HeavyFactory) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
+                                    itemID = Structure_HeavyFactory;
+                                } else if (getHouse()->getCredits() < 1000) {
+                                    // we don't need any more buildings if we have such few credits
+                                } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 3)
+                                           && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
+                                    itemID = Structure_RocketTurret;
+                                } else if ((getHouse()->getNumItems(Structure_IX) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_IX)) {
+                                    itemID = Structure_IX;
+                                } else if ((getHouse()->getNumItems(Structure_RepairYard) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_RepairYard)) {
+                                    itemID = Structure_RepairYard;
+                                } else if ((getHouse()->getNumItems(Structure_Palace) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_Palace)) {
+                                    itemID = Structure_Palace;
+                                } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 4)
+                                           && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
+                                    itemID = Structure_RocketTurret;
+                                } else if ((getHouse()->getNumItems(Structure_WOR) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_WOR)) {
+                                    itemID = Structure_WOR;
+                                } else if ((getHouse()->getNumItems(Structure_HighTechFactory) <= 0)
+                                           && pBuilder->isAvailableToBuild(Structure_HighTechFactory)) {
+                                    itemID = Structure_HighTechFactory;
+                                } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 5)
+                                           && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
+                                    itemID = Structure_RocketTurret;
+                                } else if (!pBuilder->isAvailableToBuild(Structure_HeavyFactory)
+                                           && (getHouse()->getNumItems(Structure_LightFactory) < 2)
+                                           && pBuilder->isAvailableToBuild(Structure_LightFactory)) {
+                                    itemID = Structure_LightFactory;
+                                } else if ((getHouse()->getNumItems(Structure_HeavyFactory) < 2)
+                                           && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
+                                    itemID = Structure_HeavyFactory;
+                                } else if (getHouse()->getCredits() > 2000
+                                           && (getHouse()->getNumItems(Structure_Silo) < 2)
+                                           && pBuilder->isAvailableToBuild(Structure_Silo)) {
+                                    itemID = Structure_Silo;
+                                } else if (getHouse()->getCredits() > 2000
+                                           && (getHouse()->getNumItems(Structure_RepairYard) < 2)
+                                           && pBuilder->isAvailableToBuild(Structure_RepairYard)) {
+                                    itemID = Structure_RepairYard;
+                                } else if (((difficulty == Difficulty::Medium) || (difficulty == Difficulty::Hard))
+                                           && getHouse()->getNumItems(Structure_Refinery) < 4
+                                           && pBuilder->isAvailableToBuild(Structure_Refinery)) {
+                                    itemID = Structure_Refinery;
+                                } else if ((difficulty == Difficulty::Hard)
+                                           && getHouse()->getNumItems(Structure_Refinery) < 5
+                                           && pBuilder->isAvailableToBuild(Structure_Refinery)) {
+                                    itemID = Structure_Refinery;
+                                } else if ((getHouse()->getNumItems(Structure_HeavyFactory) < 3)
+                                           && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
+                                    itemID = Structure_HeavyFactory;
+                                } else if (getHouse()->getCredits() > 2000
+                                           && (getHouse()->getNumItems(Structure_RocketTurret) < 10)
+                                           && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
+                                    itemID = Structure_RocketTurret;
+                                } else if (getHouse()->getCredits() > 3000
+                                           && (getHouse()->getNumItems(Structure_RocketTurret) < 20)
+                                           && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
+                                    itemID = Structure_RocketTurret;
                                 }
-                            } else {
-                                // order max 6 units
-                                auto num = 6;
-                                while ((num > 0) && (getHouse()->getCredits() > 2000)) {
-                                    if (pStarPort->isAvailableToBuild(Unit_SiegeTank)
-                                        && choam.getNumAvailable(Unit_SiegeTank) > 0 && choam.isCheap(Unit_SiegeTank)) {
-                                        doProduceItem(pBuilder, Unit_SiegeTank);
-                                    } else if (pStarPort->isAvailableToBuild(Unit_Launcher)
-                                               && choam.getNumAvailable(Unit_Launcher) > 0
-                                               && choam.isCheap(Unit_Launcher)) {
-                                        doProduceItem(pBuilder, Unit_Launcher);
-                                    } else if (pStarPort->isAvailableToBuild(Unit_Tank)
-                                               && choam.getNumAvailable(Unit_Tank) > 0 && choam.isCheap(Unit_Tank)) {
-                                        doProduceItem(pBuilder, Unit_Tank);
-                                    } else if (pStarPort->isAvailableToBuild(Unit_Quad)
-                                               && choam.getNumAvailable(Unit_Quad) > 0 && choam.isCheap(Unit_Quad)) {
-                                        doProduceItem(pBuilder, Unit_Quad);
-                                    } else if (pStarPort->isAvailableToBuild(Unit_Trike)
-                                               && choam.getNumAvailable(Unit_Trike) > 0 && choam.isCheap(Unit_Trike)) {
-                                        doProduceItem(pBuilder, Unit_Trike);
-                                    }
-                                    num--;
-                                }
-                                doPlaceOrder(pStarPort);
-                            }
-                        }
-                    } break;
-
-                    case Structure_ConstructionYard: {
-                        if ((getHouse()->getCredits() > 900)
-                            && ((pBuilder->getCurrentUpgradeLevel() == 0) || (getHouse()->hasRadar()))
-                            && (pBuilder->getHealth() >= pBuilder->getMaxHealth()) && (!pBuilder->isUpgrading())
-                            && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
-                            (void)doUpgrade(pBuilder);
-                        }
-
-                        if (!bConstructionYardChecked && !pBuilder->isUpgrading()) {
-                            bConstructionYardChecked = true;
-                            if (getHouse()->getCredits() > 100) {
-                                if ((pBuilder->getProductionQueueSize() < 1) && (pBuilder->getBuildListSize() > 0)) {
-                                    auto itemID = ItemID_enum::ItemID_Invalid;
-                                    if (getHouse()->getProducedPower() - getHouse()->getPowerRequirement() < 50
-                                        && pBuilder->isAvailableToBuild(Structure_WindTrap)) {
-                                        itemID = Structure_WindTrap;
-                                    } else if (getHouse()->getNumItems(Structure_Refinery) < 3
-                                               && pBuilder->isAvailableToBuild(Structure_Refinery)) {
-                                        itemID = Structure_Refinery;
-                                    } else if ((!getHouse()->hasRadar())
-                                               && pBuilder->isAvailableToBuild(Structure_Radar)) {
-                                        itemID = Structure_Radar;
-                                    } else if ((getHouse()->getNumItems(Structure_StarPort) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_StarPort)) {
-                                        itemID = Structure_StarPort;
-                                    } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 1)
-                                               && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
-                                        itemID = Structure_RocketTurret;
-                                    } else if ((!getHouse()->hasLightFactory())
-                                               && pBuilder->isAvailableToBuild(Structure_LightFactory)) {
-                                        itemID = Structure_LightFactory;
-                                    } else if ((getHouse()->getNumItems(Structure_HeavyFactory) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
-                                        itemID = Structure_HeavyFactory;
-                                    } else if (getHouse()->getCredits() < 1000) {
-                                        // we don't need any more buildings if we have such few credits
-                                    } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 3)
-                                               && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
-                                        itemID = Structure_RocketTurret;
-                                    } else if ((getHouse()->getNumItems(Structure_IX) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_IX)) {
-                                        itemID = Structure_IX;
-                                    } else if ((getHouse()->getNumItems(Structure_RepairYard) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_RepairYard)) {
-                                        itemID = Structure_RepairYard;
-                                    } else if ((getHouse()->getNumItems(Structure_Palace) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_Palace)) {
-                                        itemID = Structure_Palace;
-                                    } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 4)
-                                               && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
-                                        itemID = Structure_RocketTurret;
-                                    } else if ((getHouse()->getNumItems(Structure_WOR) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_WOR)) {
-                                        itemID = Structure_WOR;
-                                    } else if ((getHouse()->getNumItems(Structure_HighTechFactory) <= 0)
-                                               && pBuilder->isAvailableToBuild(Structure_HighTechFactory)) {
-                                        itemID = Structure_HighTechFactory;
-                                    } else if ((getHouse()->getNumItems(Structure_RocketTurret) < 5)
-                                               && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
-                                        itemID = Structure_RocketTurret;
-                                    } else if (!pBuilder->isAvailableToBuild(Structure_HeavyFactory)
-                                               && (getHouse()->getNumItems(Structure_LightFactory) < 2)
-                                               && pBuilder->isAvailableToBuild(Structure_LightFactory)) {
-                                        itemID = Structure_LightFactory;
-                                    } else if ((getHouse()->getNumItems(Structure_HeavyFactory) < 2)
-                                               && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
-                                        itemID = Structure_HeavyFactory;
-                                    } else if (getHouse()->getCredits() > 2000
-                                               && (getHouse()->getNumItems(Structure_Silo) < 2)
-                                               && pBuilder->isAvailableToBuild(Structure_Silo)) {
-                                        itemID = Structure_Silo;
-                                    } else if (getHouse()->getCredits() > 2000
-                                               && (getHouse()->getNumItems(Structure_RepairYard) < 2)
-                                               && pBuilder->isAvailableToBuild(Structure_RepairYard)) {
-                                        itemID = Structure_RepairYard;
-                                    } else if (((difficulty == Difficulty::Medium) || (difficulty == Difficulty::Hard))
-                                               && getHouse()->getNumItems(Structure_Refinery) < 4
-                                               && pBuilder->isAvailableToBuild(Structure_Refinery)) {
-                                        itemID = Structure_Refinery;
-                                    } else if ((difficulty == Difficulty::Hard)
-                                               && getHouse()->getNumItems(Structure_Refinery) < 5
-                                               && pBuilder->isAvailableToBuild(Structure_Refinery)) {
-                                        itemID = Structure_Refinery;
-                                    } else if ((getHouse()->getNumItems(Structure_HeavyFactory) < 3)
-                                               && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
-                                        itemID = Structure_HeavyFactory;
-                                    } else if (getHouse()->getCredits() > 2000
-                                               && (getHouse()->getNumItems(Structure_RocketTurret) < 10)
-                                               && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
-                                        itemID = Structure_RocketTurret;
-                                    } else if (getHouse()->getCredits() > 3000
-                                               && (getHouse()->getNumItems(Structure_RocketTurret) < 20)
-                                               && pBuilder->isAvailableToBuild(Structure_RocketTurret)) {
-                                        itemID = Structure_RocketTurret;
-                                    }
 
-                                    if (itemID != ItemID_enum::ItemID_Invalid) {
-                                        Coord location = findPlaceLocation(itemID);
-
-                                        if (location.isValid()) {
-                                            Coord placeLocation = location;
-                                            if (getGameInitSettings().getGameOptions().concreteRequired) {
-                                                int incI   = 0;
-                                                int incJ   = 0;
-                                                int startI = 0;
-                                                int startJ = 0;
-
-                                                if (getMap().isWithinBuildRange(location.x, location.y, getHouse())) {
-                                                    startI = location.x, startJ = location.y, incI = 1, incJ = 1;
-                                                } else if (getMap().isWithinBuildRange(
-                                                               location.x + getStructureSize(itemID).x - 1, location.y,
-                                                               getHouse())) {
-                                                    startI = location.x + getStructureSize(itemID).x - 1,
-                                                    startJ = location.y, incI = -1, incJ = 1;
-                                                } else if (getMap().isWithinBuildRange(
-                                                               location.x, location.y + getStructureSize(itemID).y - 1,
-                                                               getHouse())) {
-                                                    startI = location.x,
-                                                    startJ = location.y + getStructureSize(itemID).y - 1, incI = 1,
-                                                    incJ = -1;
-                                                } else {
-                                                    startI = location.x + getStructureSize(itemID).x - 1,
-                                                    startJ = location.y + getStructureSize(itemID).y - 1, incI = -1,
-                                                    incJ = -1;
-                                                }
+                                if (itemID != ItemID_enum::ItemID_Invalid) {
+                                    Coord location = findPlaceLocation(itemID);
+
+                                    if (location.isValid()) {
+                                        Coord placeLocation = location;
+                                        if (getGameInitSettings().getGameOptions().concreteRequired) {
+                                            int incI   = 0;
+                                            int incJ   = 0;
+                                            int startI = 0;
+                                            int startJ = 0;
+
+                                            if (getMap().isWithinBuildRange(location.x, location.y, getHouse())) {
+                                                startI = location.x, startJ = location.y, incI = 1, incJ = 1;
+                                            } else if (getMap().isWithinBuildRange(
+                                                           location.x + getStructureSize(itemID).x - 1, location.y,
+                                                           getHouse())) {
+                                                startI = location.x + getStructureSize(itemID).x - 1,
+                                                startJ = location.y, incI = -1, incJ = 1;
+                                            } else if (getMap().isWithinBuildRange(
+                                                           location.x, location.y + getStructureSize(itemID).y - 1,
+                                                           getHouse())) {
+                                                startI = location.x,
+                                                startJ = location.y + getStructureSize(itemID).y - 1, incI = 1,
+                                                incJ = -1;
+                                            } else {
+                                                startI = location.x + getStructureSize(itemID).x - 1,
+                                                startJ = location.y + getStructureSize(itemID).y - 1, incI = -1,
+                                                incJ = -1;
+                                            }
 
-                                                for (int i = startI; abs(i - startI) < getStructureSize(itemID).x;
-                                                     i += incI) {
-                                                    for (int j = startJ; abs(j - startJ) < getStructureSize(itemID).y;
-                                                         j += incJ) {
-                                                        const Tile* pTile = getMap().getTile(i, j);
-
-                                                        if ((getStructureSize(itemID).x > 1)
-                                                            && (getStructureSize(itemID).y > 1)
-                                                            && pBuilder->isAvailableToBuild(Structure_Slab4)
-                                                            && (abs(i - location.x) < 2) && (abs(j - location.y) < 2)) {
-                                                            if ((i == location.x) && (j == location.y)
-                                                                && pTile->getType() != Terrain_Slab) {
-                                                                placeLocations.emplace_back(i, j);
-                                                                doProduceItem(pBuilder, Structure_Slab4);
-                                                            }
-                                                        } else if (pTile->getType() != Terrain_Slab) {
+                                            for (int i = startI; abs(i - startI) < getStructureSize(itemID).x;
+                                                 i += incI) {
+                                                for (int j = startJ; abs(j - startJ) < getStructureSize(itemID).y;
+                                                     j += incJ) {
+                                                    const Tile* pTile = getMap().getTile(i, j);
+
+                                                    if ((getStructureSize(itemID).x > 1)
+                                                        && (getStructureSize(itemID).y > 1)
+                                                        && pBuilder->isAvailableToBuild(Structure_Slab4)
+                                                        && (abs(i - location.x) < 2) && (abs(j - location.y) < 2)) {
+                                                        if ((i == location.x) && (j == location.y)
+                                                            && pTile->getType() != Terrain_Slab) {
                                                             placeLocations.emplace_back(i, j);
-                                                            doProduceItem(pBuilder, Structure_Slab1);
+                                                            doProduceItem(pBuilder, Structure_Slab4);
                                                         }
+                                                    } else if (pTile->getType() != Terrain_Slab) {
+                                                        placeLocations.emplace_back(i, j);
+                                                        doProduceItem(pBuilder, Structure_Slab1);
                                                     }
                                                 }
                                             }
+                                        }
 
-                                            placeLocations.push_back(placeLocation);
-                                            doProduceItem(pBuilder, itemID);
-                                        } else {
-                                            // we havn't found a placing location => build some random slabs
-                                            location = findPlaceLocation(Structure_Slab1);
-                                            if (location.isValid()
-                                                && getMap().isWithinBuildRange(location.x, location.y, getHouse())) {
-                                                placeLocations.push_back(location);
-                                                doProduceItem(pBuilder, Structure_Slab1);
-                                            }
+                                        placeLocations.push_back(placeLocation);
+                                        doProduceItem(pBuilder, itemID);
+                                    } else {
+                                        // we havn't found a placing location => build some random slabs
+                                        location = findPlaceLocation(Structure_Slab1);
+                                        if (location.isValid()
+                                            && getMap().isWithinBuildRange(location.x, location.y, getHouse())) {
+                                            placeLocations.push_back(location);
+                                            doProduceItem(pBuilder, Structure_Slab1);
                                         }
                                     }
                                 }
                             }
                         }
+                    }
 
-                        if (pBuilder->isWaitingToPlace()) {
-                            // find total region of possible placement and place in random ok position
-                            const auto itemID   = pBuilder->getCurrentProducedItem();
-                            const auto itemsize = getStructureSize(itemID);
-
-                            // see if there is already a spot to put it stored
-                            if (!placeLocations.empty()) {
-                                const Coord location   = placeLocations.front();
-                                const auto* pConstYard = static_cast<const ConstructionYard*>(pBuilder);
-                                if (getMap().okayToPlaceStructure(location.x, location.y, itemsize.x, itemsize.y, false,
-                                                                  pConstYard->getOwner())) {
-                                    doPlaceStructure(pConstYard, location.x, location.y);
-                                    placeLocations.pop_front();
-                                } else if (itemID == Structure_Slab1) {
-                                    // forget about concrete
-                                    doCancelItem(pConstYard, Structure_Slab1);
-                                    placeLocations.pop_front();
-                                } else if (itemID == Structure_Slab4) {
-                                    // forget about concrete
-                                    doCancelItem(pConstYard, Structure_Slab4);
-                                    placeLocations.pop_front();
-                                } else {
-                                    // cancel item
-                                    doCancelItem(pConstYard, itemID);
-                                    placeLocations.pop_front();
-                                }
+                    if (pBuilder->isWaitingToPlace()) {
+                        // find total region of possible placement and place in random ok position
+                        const auto itemID   = pBuilder->getCurrentProducedItem();
+                        const auto itemsize = getStructureSize(itemID);
+
+                        // see if there is already a spot to put it stored
+                        if (!placeLocations.empty()) {
+                            const Coord location   = placeLocations.front();
+                            const auto* pConstYard = static_cast<const ConstructionYard*>(pBuilder);
+                            if (getMap().okayToPlaceStructure(location.x, location.y, itemsize.x, itemsize.y, false,
+                                                              pConstYard->getOwner())) {
+                                doPlaceStructure(pConstYard, location.x, location.y);
+                                placeLocations.pop_front();
+                            } else if (itemID == Structure_Slab1) {
+                                // forget about concrete
+                                doCancelItem(pConstYard, Structure_Slab1);
+                                placeLocations.pop_front();
+                            } else if (itemID == Structure_Slab4) {
+                                // forget about concrete
+                                doCancelItem(pConstYard, Structure_Slab4);
+                                placeLocations.pop_front();
+                            } else {
+                                // cancel item
+                                doCancelItem(pConstYard, itemID);
+                                placeLocations.pop_front();
                             }
                         }
+                    }
 
-                    } break;
+                } break;
 
-                    default: {
-                        break;
-                    }
+                default: {
+                    break;
                 }
             }
         }
@@ -689,12 +677,8 @@ void AIPlayer::build() {
 void AIPlayer::attack() {
     Coord destination;
     const UnitBase* pLeaderUnit = nullptr;
-    for (const auto* pUnit : getUnitList()) {
-        if (nullptr == pUnit)
-            continue;
-
-        if (pUnit->isRespondable() && (pUnit->getOwner() == getHouse())
-            && pUnit->isActive()
+    for (const auto* pUnit : getOwnUnitList()) {
+        if (pUnit->isRespondable() && pUnit->isActive()
             /*&& !(pUnit->getAttackMode() == HUNT)*/
             && (pUnit->getAttackMode() == AREAGUARD || pUnit->getAttackMode() == GUARD
                 || pUnit->getAttackMode() == AMBUSH)
@@ -727,39 +711,29 @@ void AIPlayer::attack() {
     attackTimer = getRandomGen().rand(10000, 20000);
 }
 
-void AIPlayer::handle_sandworm(const UnitBase* sandworm) {
+void AIPlayer::handle_sandworm(const UnitBase* sandworm, const Harvester* harvester) {
     auto& map = getMap();
 
-    for (const auto* const unit : getUnitList()) {
-        if (unit->getOwner() != getHouse())
-            continue;
-
-        const auto* const harvester = dune_cast<const Harvester>(unit);
-        if (!harvester)
-            continue;
-
-        if (harvester->isPickedUp())
-            continue;
-
-        if (map.tileExists(harvester->getLocation()) && !map.getTile(harvester->getLocation())->isRock()
-            && blockDistance(sandworm->getLocation(), harvester->getLocation()) <= 5) {
+    if (harvester->isPickedUp())
+        return;
 
-            if (!harvester->isReturning())
-                doReturn(harvester);
+    if (map.tileExists(harvester->getLocation()) && !map.getTile(harvester->getLocation())->isRock()) {
+        if (!harvester->isReturning())
+            doReturn(harvester);
 
-            scrambleUnitsAndDefend(sandworm);
-        }
+        scrambleUnitsAndDefend(sandworm);
     }
 }
 
-void AIPlayer::checkAllUnits() {
-    for (const auto* pUnit : getUnitList()) {
-        if (pUnit->getItemID() == Unit_Sandworm)
-            handle_sandworm(pUnit);
+void AIPlayer::checkAllUnits(int slice) {
+    for (const auto& [pSandworm, pHarvester] : getHouse()->getSandwormContacts()) {
+        if (isInUpdateSlice(pSandworm, slice, AIUPDATEINTERVAL))
+            handle_sandworm(pSandworm, static_cast<const Harvester*>(pHarvester));
+    }
 
-        if (pUnit->getOwner() != getHouse()) {
+    for (const auto* pUnit : getOwnUnitList()) {
+        if (!isInUpdateSlice(pUnit, slice, AIUPDATEINTERVAL))
             continue;
-        }
 
         switch (pUnit->getItemID()) {
             case Unit_MCV: {
@@ -28,7 +28,10 @@
 #include <structures/Palace.h>
 #include <units/UnitBase.h>
 
+#include <algorithm>
+#include <array>
 #include <unordered_map>
+#include <utility>
 
 namespace {
 inline constexpr auto AIUPDATEINTERVAL = 50;
@@ -39,45 +42,68 @@ const std::unordered_map<uint32_t, int> buildPriorityMap = {
     {Unit_SiegeTank, 9}, {Unit_Devastator, 10}, {Unit_SonicTank, 7}, {Unit_Trike, 3},    {Unit_RaiderTrike, 4},
     {Unit_Quad, 5},      {Unit_Harvester, 1},   {Unit_MCV, 1}};
 
-const std::unordered_map<uint32_t, int> targetPriorityMap = {{Unit_Carryall, 36},
-                                                             {Unit_Ornithopter, 105},
-                                                             {Unit_Infantry, 40},
-                                                             {Unit_Troopers, 100},
-                                                             {Unit_Soldier, 20},
-                                                             {Unit_Trooper, 50},
-                                                             {Unit_Saboteur, 700},
-                                                             {Unit_Launcher, 250},
-                                                             {Unit_Deviator, 225},
-                                                             {Unit_Tank, 180},
-                                                             {Unit_SiegeTank, 280},
-                                                             {Unit_Devastator, 355},
-                                                             {Unit_SonicTank, 190},
-                                                             {Unit_Trike, 100},
-                                                             {Unit_RaiderTrike, 115},
-                                                             {Unit_Quad, 120},
-                                                             {Unit_Harvester, 160},
-                                                             {Unit_MCV, 160},
-                                                             {Unit_Frigate, 0},
-                                                             {Unit_Sandworm, 0},
-                                                             {Structure_Slab1, 5},
-                                                             {Structure_Slab4, 10},
-                                                             {Structure_Palace, 400},
-                                                             {Structure_LightFactory, 200},
-                                                             {Structure_HeavyFactory, 600},
-                                                             {Structure_HighTechFactory, 200},
-                                                             {Structure_IX, 100},
-                                                             {Structure_WOR, 175},
-                                                             {Structure_ConstructionYard, 300},
-                                                             {Structure_WindTrap, 300},
-                                                             {Structure_Barracks, 100},
-                                                             {Structure_StarPort, 250},
-                                                             {Structure_Refinery, 300},
-                                                             {Structure_RepairYard, 600},
-                                                             {Structure_Wall, 30},
-                                                             {Structure_GunTurret, 225},
-                                                             {Structure_RocketTurret, 175},
-                                                             {Structure_Silo, 150},
-                                                             {Structure_Radar, 275}};
+/// The base priority of attacking an item, indexed by its item id
+constexpr auto targetPriorities = [] {
+    constexpr std::pair<ItemID_enum, int> itemPriorities[] = {
+        {Unit_Carryall, 36},
+        {Unit_Ornithopter, 105},
+        {Unit_Infantry, 40},
+        {Unit_Troopers, 100},
+        {Unit_Soldier, 20},
+        {Unit_Trooper, 50},
+        {Unit_Saboteur, 700},
+        {Unit_Launcher, 250},
+        {Unit_Deviator, 225},
+        {Unit_Tank, 180},
+        {Unit_SiegeTank, 280},
+        {Unit_Devastator, 355},
+        {Unit_SonicTank, 190},
+        {Unit_Trike, 100},
+        {Unit_RaiderTrike, 115},
+        {Unit_Quad, 120},
+        {Unit_Harvester, 160},
+        {Unit_MCV, 160},
+        {Unit_Frigate, 0},
+        {Unit_Sandworm, 0},
+        {Structure_Slab1, 5},
+        {Structure_Slab4, 10},
+        {Structure_Palace, 400},
+        {Structure_LightFactory, 200},
+        {Structure_HeavyFactory, 600},
+        {Structure_HighTechFactory, 200},
+        {Structure_IX, 100},
+        {Structure_WOR, 175},
+        {Structure_ConstructionYard, 300},
+        {Structure_WindTrap, 300},
+        {Structure_Barracks, 100},
+        {Structure_StarPort, 250},
+        {Structure_Refinery, 300},
+        {Structure_RepairYard, 600},
+        {Structure_Wall, 30},
+        {Structure_GunTurret, 225},
+        {Structure_RocketTurret, 175},
+        {Structure_Silo, 150},
+        {Structure_Radar, 275}};
+
+    std::array<int, Num_ItemID> priorities{};
+    for (const auto& [itemID, priority] : itemPriorities)
+        priorities[itemID] = priority;
+
+    return priorities;
+}();
+
+/// All item ids ordered by descending target priority; equal priorities are ordered by item id
+constexpr auto targetPriorityOrder = [] {
+    std::array<ItemID_enum, ItemID_LastID - ItemID_FirstID + 1> order{};
+    for (auto i = 0U; i < order.size(); ++i)
+        order[i] = static_cast<ItemID_enum>(ItemID_FirstID + i);
+
+    std::sort(order.begin(), order.end(), [](ItemID_enum a, ItemID_enum b) {
+        return targetPriorities[a] != targetPriorities[b] ? targetPriorities[a] > targetPriorities[b] : a < b;
+    });
+
+    return order;
+}();
 } // namespace
 
 CampaignAIPlayer::CampaignAIPlayer(const GameContext& context, House* associatedHouse, const std::string& playername,
@@ -104,18 +130,16 @@ void CampaignAIPlayer::save(OutputStream& stream) const {
 }
 
 void CampaignAIPlayer::update() {
-    if ((getGameCycleCount() + static_cast<int>(getHouse()->getHouseID())) % AIUPDATEINTERVAL != 0) {
-        // we are not updating this AI player this cycle
-        return;
-    }
-
     if (!getHouse()->hadDirectContactWithEnemy()) {
         // we are not doing anything until we had contact with the enemy
         return;
     }
 
-    updateStructures();
-    updateUnits();
+    // Every cycle only a slice of our structures and units is updated
+    const auto slice = getUpdateSlice(AIUPDATEINTERVAL);
+
+    updateStructures(slice);
+    updateUnits(slice);
 }
 
 void CampaignAIPlayer::onObjectWasBuilt([[maybe_unused]] const ObjectBase* pObject) { }
@@ -152,9 +176,9 @@ void CampaignAIPlayer::onDamage(const ObjectBase* pObject, [[maybe_unused]] int
     }
 }
 
-void CampaignAIPlayer::updateStructures() {
-    for (const auto* pStructure : getStructureList()) {
-        if (pStructure->getOwner() != getHouse()) {
+void CampaignAIPlayer::updateStructures(int slice) {
+    for (const auto* pStructure : getOwnStructureList()) {
+        if (!isInUpdateSlice(pStructure, slice, AIUPDATEINTERVAL)) {
             continue;
         }
 
@@ -291,10 +315,13 @@ void CampaignAIPlayer::updateStructures() {
     }
 }
 
-void CampaignAIPlayer::updateUnits() {
-    for (const UnitBase* pUnit : getUnitList()) {
-        if (pUnit->getOwner() != getHouse() || pUnit->wasForced() || !pUnit->isRespondable() || pUnit->isByScenario()
-            || pUnit->hasATarget()) {
+void CampaignAIPlayer::updateUnits(int slice) {
+    for (const UnitBase* pUnit : getOwnUnitList()) {
+        if (!isInUpdateSlice(pUnit, slice, AIUPDATEINTERVAL)) {
+            continue;
+        }
+
+        if (pUnit->wasForced() || !pUnit->isRespondable() || pUnit->isByScenario() || pUnit->hasATarget()) {
             continue;
         }
 
@@ -305,28 +332,27 @@ void CampaignAIPlayer::updateUnits() {
 
         const ObjectBase* pBestCandidate = nullptr;
         int bestCandidatePriority        = -1;
-        for (const StructureBase* pCandidate : getStructureList()) {
-            if (!pUnit->canAttack(pCandidate)) {
-                continue;
-            }
 
-            const int priority = calculateTargetPriority(pUnit, pCandidate);
-            if (priority > bestCandidatePriority) {
-                bestCandidatePriority = priority;
-                pBestCandidate        = pCandidate;
+        // The candidates are visited by item type in descending base priority. A candidate scores at most its base
+        // priority + 1, so once the best candidate scores more than that no later item type can beat it.
+        for (const auto itemID : targetPriorityOrder) {
+            if (bestCandidatePriority > targetPriorities[itemID] + 1) {
+                break;
             }
-        }
 
-        for (const UnitBase* pCandidate : getUnitList()) {
-            if (!pUnit->canAttack(pCandidate)) {
-                continue;
-            }
+            context_.game.for_each_house([&](const auto& house) {
+                for (const ObjectBase* pCandidate : house.getItemList(itemID)) {
+                    if (!pUnit->canAttack(pCandidate)) {
+                        continue;
+                    }
 
-            const int priority = calculateTargetPriority(pUnit, pCandidate);
-            if (priority > bestCandidatePriority) {
-                bestCandidatePriority = priority;
-                pBestCandidate        = pCandidate;
-            }
+                    const int priority = calculateTargetPriority(pUnit, pCandidate);
+                    if (priority > bestCandidatePriority) {
+                        bestCandidatePriority = priority;
+                        pBestCandidate        = pCandidate;
+                    }
+                }
+            });
         }
 
         if (pBestCandidate) {
@@ -340,9 +366,7 @@ int CampaignAIPlayer::calculateTargetPriority(const UnitBase* pUnit, const Objec
         return 0;
     }
 
-    const auto it = targetPriorityMap.find(pObject->getItemID());
-
-    const int priority = it == targetPriorityMap.end() ? 0 : it->second;
+    const int priority = targetPriorities[pObject->getItemID()];
     const int distance = blockDistanceApprox(pUnit->getLocation(), pObject->getLocation());
 
     return (distance > 0) ? ((priority / distance) + 1) : priority;
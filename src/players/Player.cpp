@@ -38,6 +38,7 @@
 
 #include <globals.h>
 #include <sand.h>
+#include <algorithm>
 #include <utility>
 
 Player::Player(const GameContext& context, House* associatedHouse, std::string playername, const Random& random)
@@ -55,6 +56,29 @@ Player::~Player() {
     context_.game.unregisterPlayer(this);
 }
 
+void Player::think() {
+    actions_.clear();
+
+    const RobustListReadOnlyScope readOnly;
+    const auto start = dune::dune_clock::now();
+
+    thinking_ = true;
+    update();
+    thinking_ = false;
+
+    const auto elapsed = dune::dune_clock::now() - start;
+
+    thinkTime_ += elapsed;
+    maxThinkTime_ = std::max(maxThinkTime_, elapsed);
+}
+
+void Player::applyActions() {
+    for (const auto& action : actions_)
+        action();
+
+    actions_.clear();
+}
+
 void Player::save(OutputStream& stream) const {
     stream.writeUint8(playerID);
     stream.writeString(playername);
@@ -73,6 +97,11 @@ uint32_t Player::getGameCycleCount() const {
     return context_.game.getGameCycleCount();
 }
 
+int Player::getUpdateSlice(int numSlices) const {
+    return static_cast<int>((getGameCycleCount() + static_cast<uint32_t>(pHouse->getHouseID()))
+                            % static_cast<uint32_t>(numSlices));
+}
+
 int Player::getTechLevel() const {
     return context_.game.techLevel;
 }
@@ -97,6 +126,18 @@ const RobustList<const UnitBase*>& Player::getUnitList() const {
     return reinterpret_cast<const RobustList<const UnitBase*>&>(dune::globals::unitList);
 }
 
+const RobustList<const StructureBase*>& Player::getOwnStructureList() const {
+    return reinterpret_cast<const RobustList<const StructureBase*>&>(pHouse->getStructureList());
+}
+
+const RobustList<const UnitBase*>& Player::getOwnUnitList() const {
+    return reinterpret_cast<const RobustList<const UnitBase*>&>(pHouse->getUnitList());
+}
+
+const RobustList<const ObjectBase*>& Player::getOwnItemList(ItemID_enum itemID) const {
+    return reinterpret_cast<const RobustList<const ObjectBase*>&>(pHouse->getItemList(itemID));
+}
+
 const House* Player::getHouse(HOUSETYPE houseID) {
     if (static_cast<int>(houseID) < 0 || houseID >= HOUSETYPE::NUM_HOUSES) {
         return nullptr;
@@ -169,6 +210,9 @@ void Player::doSetBuildSpeedLimit(const BuilderBase* pBuilder, FixPoint buildSpe
 }
 
 void Player::doBuildRandom(const BuilderBase* pBuilder) const {
+    if (deferAction([=, this] { doBuildRandom(pBuilder); }))
+        return;
+
     if (pBuilder->getOwner() == getHouse() && pBuilder->isActive()) {
         const_cast<BuilderBase*>(pBuilder)->doBuildRandom(context_);
     } else {
@@ -188,6 +232,9 @@ void Player::doPlaceOrder(const StarPort* pStarport) const {
 }
 
 bool Player::doPlaceStructure(const ConstructionYard* pConstYard, int x, int y) const {
+    if (deferAction([=, this] { (void)doPlaceStructure(pConstYard, x, y); }))
+        return false;
+
     if (pConstYard->getOwner() == getHouse() && pConstYard->isActive()) {
         return const_cast<ConstructionYard*>(pConstYard)->doPlaceStructure(x, y);
     }
@@ -198,6 +245,9 @@ bool Player::doPlaceStructure(const ConstructionYard* pConstYard, int x, int y)
 }
 
 void Player::doSpecialWeapon(const Palace* pPalace) const {
+    if (deferAction([=, this] { doSpecialWeapon(pPalace); }))
+        return;
+
     if (pPalace->getOwner() == getHouse() && pPalace->isActive()) {
         const_cast<Palace*>(pPalace)->doSpecialWeapon(context_);
     } else {
@@ -208,6 +258,9 @@ void Player::doSpecialWeapon(const Palace* pPalace) const {
 }
 
 void Player::doLaunchDeathhand(const Palace* pPalace, int x, int y) const {
+    if (deferAction([=, this] { doLaunchDeathhand(pPalace, x, y); }))
+        return;
+
     if (pPalace->getOwner() == getHouse() && pPalace->isActive()) {
         const_cast<Palace*>(pPalace)->doLaunchDeathhand(context_, x, y);
     } else {
@@ -292,6 +345,9 @@ void Player::doCaptureStructure(const InfantryBase* pInfantry, const StructureBa
 }
 
 bool Player::doDeploy(const MCV* pMCV) const {
+    if (deferAction([=, this] { (void)doDeploy(pMCV); }))
+        return false;
+
     if (pMCV->getOwner() == getHouse() && pMCV->isActive()) {
         return const_cast<MCV*>(pMCV)->doDeploy();
     }
@@ -301,6 +357,9 @@ bool Player::doDeploy(const MCV* pMCV) const {
 }
 
 bool Player::doRequestCarryallDrop(const GroundUnit* pGroundUnit) const {
+    if (deferAction([=, this] { (void)doRequestCarryallDrop(pGroundUnit); }))
+        return false;
+
     if (pGroundUnit->getOwner() == getHouse() && pGroundUnit->isActive()) {
         return const_cast<GroundUnit*>(pGroundUnit)->requestCarryall(context_);
     }
@@ -37,7 +37,11 @@
 #include <units/Saboteur.h>
 #include <units/UnitBase.h>
 
+#include <algorithm>
+
 inline constexpr auto AIUPDATEINTERVAL = 50;
+inline constexpr auto AIBUILDSLICE     = 0;                    ///< the cycle of the update interval to build in
+inline constexpr auto AIATTACKSLICE    = AIUPDATEINTERVAL / 2; ///< the cycle of the update interval to attack in
 
 /**
  TODO
@@ -377,8 +381,13 @@ void QuantBot::update() {
         }
     }
 
-    if ((getGameCycleCount() + static_cast<int>(getHouse()->getHouseID())) % AIUPDATEINTERVAL != 0) {
-        // we are not updating this AI player this cycle
+    // The units are checked a few at a time every cycle. Building and attacking happen once per interval but in
+    // different cycles
+    const auto slice = getUpdateSlice(AIUPDATEINTERVAL);
+
+    checkAllUnits(slice);
+
+    if (slice != AIBUILDSLICE && slice != AIATTACKSLICE) {
         return;
     }
 
@@ -392,12 +401,13 @@ void QuantBot::update() {
     }
     // logDebug("Military Value %d  Initial Military Value %d", militaryValue, initialMilitaryValue);
 
-    checkAllUnits();
-
-    if (buildTimer <= 0) {
-        build(militaryValue);
-    } else {
-        buildTimer -= AIUPDATEINTERVAL;
+    if (slice == AIBUILDSLICE) {
+        if (buildTimer <= 0) {
+            build(militaryValue);
+        } else {
+            buildTimer -= AIUPDATEINTERVAL;
+        }
+        return;
     }
 
     if (attackTimer <= 0) {
@@ -576,133 +586,146 @@ Coord QuantBot::findMcvPlaceLocation(const MCV* pMCV) {
 }
 
 Coord QuantBot::findPlaceLocation(ItemID_enum itemID) {
-    // Will over allocate space for small maps so its not clean
-    // But should allow Richard to compile
-    int buildLocationScore[128][128] = {};
+    const auto& map    = getMap();
+    const int mapSizeX = map.getSizeX();
+    const int newSizeX = getStructureSize(itemID).x;
+    const int newSizeY = getStructureSize(itemID).y;
+
+    const House* pBuildRangeHouse = (itemID == Structure_ConstructionYard) ? nullptr : getHouse();
+
+    // Every call starts with a fresh generation so the grid does not have to be cleared
+    placementGrid.resize(static_cast<size_t>(mapSizeX) * map.getSizeY());
+    if (++placementGeneration == 0) {
+        std::ranges::fill(placementGrid, PlacementCell{});
+        placementGeneration = 1;
+    }
+
+    if (!getOwnStructureList().empty()) {
+        squadRallyLocation = findSquadRallyLocation();
+    }
+    const Coord baseCentre = findBaseCentre(getHouse()->getHouseID());
 
-    int bestLocationX     = -1;
-    int bestLocationY     = -1;
     int bestLocationScore = -10000;
-    const int newSizeX    = getStructureSize(itemID).x;
-    const int newSizeY    = getStructureSize(itemID).y;
     Coord bestLocation    = Coord::Invalid();
 
-    for (const StructureBase* pStructureExisting : getStructureList()) {
-        if (pStructureExisting->getOwner() == getHouse()) {
-
-            const int existingStartX = pStructureExisting->getX();
-            const int existingStartY = pStructureExisting->getY();
-
-            const int existingSizeX = pStructureExisting->getStructureSizeX();
-            const int existingSizeY = pStructureExisting->getStructureSizeY();
-
-            const int existingEndX = existingStartX + existingSizeX;
-            const int existingEndY = existingStartY + existingSizeY;
-
-            squadRallyLocation = findSquadRallyLocation();
-
-            const bool existingIsBuilder = (pStructureExisting->getItemID() == Structure_HeavyFactory
-                                            || pStructureExisting->getItemID() == Structure_RepairYard
-                                            || pStructureExisting->getItemID() == Structure_LightFactory
-                                            || pStructureExisting->getItemID() == Structure_WOR
-                                            || pStructureExisting->getItemID() == Structure_Barracks
-                                            || pStructureExisting->getItemID() == Structure_StarPort);
-
-            const bool sizeMatchX = (existingSizeX == newSizeX);
-            const bool sizeMatchY = (existingSizeY == newSizeY);
-
-            for (int placeLocationX = existingStartX - newSizeX; placeLocationX <= existingEndX; placeLocationX++) {
-                for (int placeLocationY = existingStartY - newSizeY; placeLocationY <= existingEndY; placeLocationY++) {
-                    if (getMap().tileExists(placeLocationX, placeLocationY)) {
-                        if (getMap().okayToPlaceStructure(placeLocationX, placeLocationY, newSizeX, newSizeY, false,
-                                                          (itemID == Structure_ConstructionYard) ? nullptr
-                                                                                                 : getHouse())) {
-
-                            const int placeLocationEndX = placeLocationX + newSizeX;
-                            const int placeLocationEndY = placeLocationY + newSizeY;
-
-                            const bool alignedX = (placeLocationX == existingStartX && sizeMatchX);
-                            const bool alignedY = (placeLocationY == existingStartY && sizeMatchY);
-
-                            // bool placeGapExists = (placeLocationEndX < existingStartX || placeLocationX >
-                            // existingEndX || placeLocationEndY < existingStartY || placeLocationY > existingEndY);
-
-                            // How many free spaces the building will have if placed
-                            for (int i = placeLocationX - 1; i <= placeLocationEndX; i++) {
-                                for (int j = placeLocationY - 1; j <= placeLocationEndY; j++) {
-                                    if (getMap().tileExists(i, j) && (getMap().getSizeX() > i) && (0 <= i)
-                                        && (getMap().getSizeY() > j) && (0 <= j)) {
-                                        // Penalise if near edge of map
-                                        if ((i == 0) || (i == getMap().getSizeX() - 1) || (j == 0)
-                                            || (j == getMap().getSizeY() - 1)) {
-                                            buildLocationScore[placeLocationX][placeLocationY] -= 10;
-                                        }
-
-                                        if (getMap().hasAStructure(context_, i, j)) {
-                                            // If one of our buildings is nearby favour the location
-                                            // if it is someone else's building don't favour it
-                                            if (getMap().getTile(i, j)->getOwner() == getHouse()->getHouseID()) {
-                                                buildLocationScore[placeLocationX][placeLocationY] += 3;
-                                            } else {
-                                                buildLocationScore[placeLocationX][placeLocationY] -= 10;
-                                            }
-                                        } else if (!getMap().getTile(i, j)->isRock()) {
-                                            // square isn't rock, favour it
-                                            buildLocationScore[placeLocationX][placeLocationY] += 1;
-                                        } else if (getMap().getTile(i, j)->hasAGroundObject()) {
-                                            if (getMap().getTile(i, j)->getOwner() != getHouse()->getHouseID()) {
-                                                // try not to build next to units which aren't yours
-                                                buildLocationScore[placeLocationX][placeLocationY] -= 100;
-                                            } else if (itemID != Structure_RocketTurret) {
-                                                buildLocationScore[placeLocationX][placeLocationY] -= 20;
-                                            }
-                                        }
-                                    } else {
-                                        // penalise if on edge of map
-                                        buildLocationScore[placeLocationX][placeLocationY] -= 200;
-                                    }
-                                }
-                            }
+    for (const StructureBase* pStructureExisting : getOwnStructureList()) {
+        const int existingStartX = pStructureExisting->getX();
+        const int existingStartY = pStructureExisting->getY();
 
-                            // encourage structure alignment
-                            if (alignedX) {
-                                buildLocationScore[placeLocationX][placeLocationX] += 10;
-                            }
+        const int existingSizeX = pStructureExisting->getStructureSizeX();
+        const int existingSizeY = pStructureExisting->getStructureSizeY();
 
-                            if (alignedY) {
-                                buildLocationScore[placeLocationX][placeLocationY] += 10;
-                            }
+        const int existingEndX = existingStartX + existingSizeX;
+        const int existingEndY = existingStartY + existingSizeY;
 
-                            // Add building specific scores
-                            if (existingIsBuilder || itemID == Structure_GunTurret
-                                || itemID == Structure_RocketTurret) {
-                                buildLocationScore[placeLocationX][placeLocationY] -= lround(
-                                    blockDistance(squadRallyLocation, Coord(placeLocationX, placeLocationY)) / 2);
+        const bool existingIsBuilder = (pStructureExisting->getItemID() == Structure_HeavyFactory
+                                        || pStructureExisting->getItemID() == Structure_RepairYard
+                                        || pStructureExisting->getItemID() == Structure_LightFactory
+                                        || pStructureExisting->getItemID() == Structure_WOR
+                                        || pStructureExisting->getItemID() == Structure_Barracks
+                                        || pStructureExisting->getItemID() == Structure_StarPort);
 
-                                buildLocationScore[placeLocationX][placeLocationY] -= lround(blockDistance(
-                                    findBaseCentre(getHouse()->getHouseID()), Coord(placeLocationX, placeLocationY)));
-                            }
+        const bool sizeMatchX = (existingSizeX == newSizeX);
+        const bool sizeMatchY = (existingSizeY == newSizeY);
 
-                            // Pick this location if it has the best score
-                            if (buildLocationScore[placeLocationX][placeLocationY] > bestLocationScore) {
-                                bestLocationScore = buildLocationScore[placeLocationX][placeLocationY];
-                                bestLocationX     = placeLocationX;
-                                bestLocationY     = placeLocationY;
-                                // logDebug("Build location for item:%d  x:%d y:%d score:%d", itemID, bestLocationX,
-                                // bestLocationY, bestLocationScore);
-                            }
-                        }
-                    }
+        for (int placeLocationX = existingStartX - newSizeX; placeLocationX <= existingEndX; placeLocationX++) {
+            for (int placeLocationY = existingStartY - newSizeY; placeLocationY <= existingEndY; placeLocationY++) {
+                if (!map.tileExists(placeLocationX, placeLocationY)) {
+                    continue;
+                }
+
+                // Locations next to several structures are visited once for each of them; the map does not change
+                // in between, so placeability and surroundings are only rated on the first visit
+                auto& cell = placementGrid[static_cast<size_t>(placeLocationY) * mapSizeX + placeLocationX];
+                if (cell.generation != placementGeneration) {
+                    cell.generation = placementGeneration;
+                    cell.score      = 0;
+                    cell.placeable  = map.okayToPlaceStructure(placeLocationX, placeLocationY, newSizeX, newSizeY,
+                                                               false, pBuildRangeHouse);
+                    cell.surroundingsScore =
+                        cell.placeable ? rateSurroundings(itemID, placeLocationX, placeLocationY, newSizeX, newSizeY)
+                                       : 0;
+                }
+
+                if (!cell.placeable) {
+                    continue;
+                }
+
+                cell.score += cell.surroundingsScore;
+
+                // encourage structure alignment
+                if (placeLocationX == existingStartX && sizeMatchX) {
+                    cell.score += 10;
+                }
+
+                if (placeLocationY == existingStartY && sizeMatchY) {
+                    cell.score += 10;
+                }
+
+                // Add building specific scores
+                if (existingIsBuilder || itemID == Structure_GunTurret || itemID == Structure_RocketTurret) {
+                    const Coord placeLocation(placeLocationX, placeLocationY);
+
+                    cell.score -= lround(blockDistance(squadRallyLocation, placeLocation) / 2);
+                    cell.score -= lround(blockDistance(baseCentre, placeLocation));
+                }
+
+                // Pick this location if it has the best score
+                if (cell.score > bestLocationScore) {
+                    bestLocationScore = cell.score;
+                    bestLocation      = Coord(placeLocationX, placeLocationY);
+                    // logDebug("Build location for item:%d  x:%d y:%d score:%d", itemID, bestLocation.x,
+                    // bestLocation.y, bestLocationScore);
                 }
             }
         }
     }
 
-    if (bestLocationScore != -10000) {
-        bestLocation = Coord(bestLocationX, bestLocationY);
+    return bestLocation;
+}
+
+int QuantBot::rateSurroundings(ItemID_enum itemID, int x, int y, int sizeX, int sizeY) {
+    const auto& map = getMap();
+    int score       = 0;
+
+    // How many free spaces the building will have if placed
+    for (int i = x - 1; i <= x + sizeX; i++) {
+        for (int j = y - 1; j <= y + sizeY; j++) {
+            if (!map.tileExists(i, j)) {
+                // penalise if on edge of map
+                score -= 200;
+                continue;
+            }
+
+            // Penalise if near edge of map
+            if ((i == 0) || (i == map.getSizeX() - 1) || (j == 0) || (j == map.getSizeY() - 1)) {
+                score -= 10;
+            }
+
+            const auto* pTile = map.getTile(i, j);
+            if (map.hasAStructure(context_, i, j)) {
+                // If one of our buildings is nearby favour the location
+                // if it is someone else's building don't favour it
+                if (pTile->getOwner() == getHouse()->getHouseID()) {
+                    score += 3;
+                } else {
+                    score -= 10;
+                }
+            } else if (!pTile->isRock()) {
+                // square isn't rock, favour it
+                score += 1;
+            } else if (pTile->hasAGroundObject()) {
+                if (pTile->getOwner() != getHouse()->getHouseID()) {
+                    // try not to build next to units which aren't yours
+                    score -= 100;
+                } else if (itemID != Structure_RocketTurret) {
+                    score -= 20;
+                }
+            }
+        }
     }
 
-    return bestLocation;
+    return score;
 }
 
 void QuantBot::build(int militaryValue) {
@@ -727,31 +750,29 @@ void QuantBot::build(int militaryValue) {
     }
 
     // Next add in the objects we are building
-    for (const StructureBase* pStructure : getStructureList()) {
-        if (pStructure->getOwner() == getHouse()) {
-            if (pStructure->isABuilder()) {
-                const auto* pBuilder = static_cast<const BuilderBase*>(pStructure);
-                if (pBuilder->getProductionQueueSize() > 0) {
-                    itemCount[pBuilder->getCurrentProducedItem()]++;
-                    if (pBuilder->getItemID() == Structure_HeavyFactory) {
-                        activeHeavyFactoryCount++;
-                    }
-                }
-            } else if (pStructure->getItemID() == Structure_RepairYard) {
-                const auto* pRepairYard = static_cast<const RepairYard*>(pStructure);
-                if (!pRepairYard->isFree()) {
-                    activeRepairYardCount++;
+    for (const StructureBase* pStructure : getOwnStructureList()) {
+        if (pStructure->isABuilder()) {
+            const auto* pBuilder = static_cast<const BuilderBase*>(pStructure);
+            if (pBuilder->getProductionQueueSize() > 0) {
+                itemCount[pBuilder->getCurrentProducedItem()]++;
+                if (pBuilder->getItemID() == Structure_HeavyFactory) {
+                    activeHeavyFactoryCount++;
                 }
             }
-
-            // Set unit deployment position
-            if (pStructure->getItemID() == Structure_Barracks || pStructure->getItemID() == Structure_WOR
-                || pStructure->getItemID() == Structure_LightFactory
-                || pStructure->getItemID() == Structure_HeavyFactory || pStructure->getItemID() == Structure_RepairYard
-                || pStructure->getItemID() == Structure_StarPort) {
-                doSetDeployPosition(pStructure, squadRallyLocation.x, squadRallyLocation.y);
+        } else if (pStructure->getItemID() == Structure_RepairYard) {
+            const auto* pRepairYard = static_cast<const RepairYard*>(pStructure);
+            if (!pRepairYard->isFree()) {
+                activeRepairYardCount++;
             }
         }
+
+        // Set unit deployment position
+        if (pStructure->getItemID() == Structure_Barracks || pStructure->getItemID() == Structure_WOR
+            || pStructure->getItemID() == Structure_LightFactory
+            || pStructure->getItemID() == Structure_HeavyFactory || pStructure->getItemID() == Structure_RepairYard
+            || pStructure->getItemID() == Structure_StarPort) {
+            doSetDeployPosition(pStructure, squadRallyLocation.x, squadRallyLocation.y);
+        }
     }
 
     int money = getHouse()->getCredits();
@@ -886,125 +907,186 @@ void QuantBot::build(int militaryValue) {
 
     // End of adaptive unit prioritisation algorithm
 
-    for (const auto* const pStructure : getStructureList()) {
-        if (pStructure->getOwner() == getHouse()) {
-            if ((!pStructure->isRepairing()) && (pStructure->getHealth() < pStructure->getMaxHealth())
-                && (!getGameInitSettings().getGameOptions().concreteRequired
-                    || pStructure->getItemID() == Structure_Palace) // Palace repairs for free
-                && (pStructure->getItemID() != Structure_Refinery && pStructure->getItemID() != Structure_Silo
-                    && pStructure->getItemID() != Structure_Radar && pStructure->getItemID() != Structure_WindTrap)) {
+    for (const auto* const pStructure : getOwnStructureList()) {
+        if ((!pStructure->isRepairing()) && (pStructure->getHealth() < pStructure->getMaxHealth())
+            && (!getGameInitSettings().getGameOptions().concreteRequired
+                || pStructure->getItemID() == Structure_Palace) // Palace repairs for free
+            && (pStructure->getItemID() != Structure_Refinery && pStructure->getItemID() != Structure_Silo
+                && pStructure->getItemID() != Structure_Radar && pStructure->getItemID() != Structure_WindTrap)) {
+            doRepair(pStructure);
+        } else if ((pStructure->isRepairing() == false)
+                   && (pStructure->getHealth() < pStructure->getMaxHealth() * 0.40_fix) && money > 1000) {
+            doRepair(pStructure);
+        } else if ((!pStructure->isRepairing()) && money > 5000) {
+            // Repair if we are rich
+            doRepair(pStructure);
+        } else if (pStructure->getItemID() == Structure_RocketTurret) {
+            if (!getGameInitSettings().getGameOptions().structuresDegradeOnConcrete || pStructure->hasATarget()) {
                 doRepair(pStructure);
-            } else if ((pStructure->isRepairing() == false)
-                       && (pStructure->getHealth() < pStructure->getMaxHealth() * 0.40_fix) && money > 1000) {
-                doRepair(pStructure);
-            } else if ((!pStructure->isRepairing()) && money > 5000) {
-                // Repair if we are rich
-                doRepair(pStructure);
-            } else if (pStructure->getItemID() == Structure_RocketTurret) {
-                if (!getGameInitSettings().getGameOptions().structuresDegradeOnConcrete || pStructure->hasATarget()) {
-                    doRepair(pStructure);
-                }
             }
+        }
 
-            // Special weapon launch logic
-            if (pStructure->getItemID() == Structure_Palace) {
-
-                const auto* pPalace = static_cast<const Palace*>(pStructure);
-                if (pPalace->isSpecialWeaponReady()) {
+        // Special weapon launch logic
+        if (pStructure->getItemID() == Structure_Palace) {
 
-                    if (houseID != HOUSETYPE::HOUSE_HARKONNEN && houseID != HOUSETYPE::HOUSE_SARDAUKAR) {
-                        doSpecialWeapon(pPalace);
-                    } else {
-                        auto enemyHouseID           = HOUSETYPE::HOUSE_INVALID;
-                        int enemyHouseBuildingCount = 0;
-
-                        context_.game.for_each_house([&](const auto& house) {
-                            if (house.getTeamID() != getHouse()->getTeamID()
-                                && house.getNumStructures() > enemyHouseBuildingCount) {
-                                enemyHouseBuildingCount = house.getNumStructures();
-                                enemyHouseID            = house.getHouseID();
-                            }
-                        });
+            const auto* pPalace = static_cast<const Palace*>(pStructure);
+            if (pPalace->isSpecialWeaponReady()) {
 
-                        if ((enemyHouseID != HOUSETYPE::HOUSE_INVALID)
-                            && (houseID == HOUSETYPE::HOUSE_HARKONNEN || houseID == HOUSETYPE::HOUSE_SARDAUKAR)) {
-                            Coord target = findBaseCentre(enemyHouseID);
-                            doLaunchDeathhand(pPalace, target.x, target.y);
+                if (houseID != HOUSETYPE::HOUSE_HARKONNEN && houseID != HOUSETYPE::HOUSE_SARDAUKAR) {
+                    doSpecialWeapon(pPalace);
+                } else {
+                    auto enemyHouseID           = HOUSETYPE::HOUSE_INVALID;
+                    int enemyHouseBuildingCount = 0;
+
+                    context_.game.for_each_house([&](const auto& house) {
+                        if (house.getTeamID() != getHouse()->getTeamID()
+                            && house.getNumStructures() > enemyHouseBuildingCount) {
+                            enemyHouseBuildingCount = house.getNumStructures();
+                            enemyHouseID            = house.getHouseID();
                         }
+                    });
+
+                    if ((enemyHouseID != HOUSETYPE::HOUSE_INVALID)
+                        && (houseID == HOUSETYPE::HOUSE_HARKONNEN || houseID == HOUSETYPE::HOUSE_SARDAUKAR)) {
+                        Coord target = findBaseCentre(enemyHouseID);
+                        doLaunchDeathhand(pPalace, target.x, target.y);
                     }
                 }
             }
+        }
 
-            if (const auto* const pBuilder = dune_cast<BuilderBase>(pStructure)) {
-                switch (pStructure->getItemID()) {
-
-                    case Structure_LightFactory: {
-                        if (!pBuilder->isUpgrading() && gameMode == GameMode::Campaign && money > 1000
-                            && ((itemCount[Structure_HeavyFactory] == 0)
-                                || militaryValue < militaryValueLimit * 0.30_fix)
-                            && pBuilder->getProductionQueueSize() < 1 && pBuilder->getBuildListSize() > 0
-                            && militaryValue < militaryValueLimit) {
-
-                            if (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel()
-                                && getHouse()->getCredits() > 1500) {
-                                doUpgrade(pBuilder);
-                            } else if (!getHouse()->isGroundUnitLimitReached()) {
-                                auto itemID = ItemID_enum::ItemID_Invalid;
-
-                                if (pBuilder->isAvailableToBuild(Unit_RaiderTrike)) {
-                                    itemID = Unit_RaiderTrike;
-                                } else if (pBuilder->isAvailableToBuild(Unit_Quad)) {
-                                    itemID = Unit_Quad;
-                                } else if (pBuilder->isAvailableToBuild(Unit_Trike)) {
-                                    itemID = Unit_Trike;
-                                }
+        if (const auto* const pBuilder = dune_cast<BuilderBase>(pStructure)) {
+            switch (pStructure->getItemID()) {
+
+                case Structure_LightFactory: {
+                    if (!pBuilder->isUpgrading() && gameMode == GameMode::Campaign && money > 1000
+                        && ((itemCount[Structure_HeavyFactory] == 0) || militaryValue < militaryValueLimit * 0.30_fix)
+                        && pBuilder->getProductionQueueSize() < 1 && pBuilder->getBuildListSize() > 0
+                        && militaryValue < militaryValueLimit) {
+
+                        if (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel()
+                            && getHouse()->getCredits() > 1500) {
+                            doUpgrade(pBuilder);
+                        } else if (!getHouse()->isGroundUnitLimitReached()) {
+                            auto itemID = ItemID_enum::ItemID_Invalid;
+
+                            if (pBuilder->isAvailableToBuild(Unit_RaiderTrike)) {
+                                itemID = Unit_RaiderTrike;
+                            } else if (pBuilder->isAvailableToBuild(Unit_Quad)) {
+                                itemID = Unit_Quad;
+                            } else if (pBuilder->isAvailableToBuild(Unit_Trike)) {
+                                itemID = Unit_Trike;
+                            }
 
-                                if (itemID != ItemID_enum::ItemID_Invalid) {
-                                    doProduceItem(pBuilder, itemID);
-                                    itemCount[itemID]++;
-                                }
+                            if (itemID != ItemID_enum::ItemID_Invalid) {
+                                doProduceItem(pBuilder, itemID);
+                                itemCount[itemID]++;
                             }
                         }
-                    } break;
-
-                    case Structure_WOR: {
-                        if (!pBuilder->isUpgrading() && pBuilder->isAvailableToBuild(Unit_Trooper)
-                            && gameMode == GameMode::Campaign && money > 1000
-                            && ((itemCount[Structure_HeavyFactory] == 0)
-                                || militaryValue < militaryValueLimit * 0.30_fix)
-                            && pBuilder->getProductionQueueSize() < 1 && pBuilder->getBuildListSize() > 0
-                            && !getHouse()->isInfantryUnitLimitReached() && militaryValue < militaryValueLimit) {
+                    }
+                } break;
 
-                            doProduceItem(pBuilder, Unit_Trooper);
-                            itemCount[Unit_Trooper]++;
-                        }
-                    } break;
+                case Structure_WOR: {
+                    if (!pBuilder->isUpgrading() && pBuilder->isAvailableToBuild(Unit_Trooper)
+                        && gameMode == GameMode::Campaign && money > 1000
+                        && ((itemCount[Structure_HeavyFactory] == 0) || militaryValue < militaryValueLimit * 0.30_fix)
+                        && pBuilder->getProductionQueueSize() < 1 && pBuilder->getBuildListSize() > 0
+                        && !getHouse()->isInfantryUnitLimitReached() && militaryValue < militaryValueLimit) {
 
-                    case Structure_Barracks: {
-                        if (!pBuilder->isUpgrading() && pBuilder->isAvailableToBuild(Unit_Soldier)
-                            && gameMode == GameMode::Campaign
-                            && ((itemCount[Structure_HeavyFactory] == 0)
-                                || militaryValue < militaryValueLimit * 0.30_fix)
-                            && itemCount[Structure_WOR] == 0 && money > 1000 && pBuilder->getProductionQueueSize() < 1
-                            && pBuilder->getBuildListSize() > 0 && !getHouse()->isInfantryUnitLimitReached()
-                            && militaryValue < militaryValueLimit) {
-
-                            doProduceItem(pBuilder, Unit_Soldier);
-                            itemCount[Unit_Soldier]++;
+                        doProduceItem(pBuilder, Unit_Trooper);
+                        itemCount[Unit_Trooper]++;
+                    }
+                } break;
+
+                case Structure_Barracks: {
+                    if (!pBuilder->isUpgrading() && pBuilder->isAvailableToBuild(Unit_Soldier)
+                        && gameMode == GameMode::Campaign
+                        && ((itemCount[Structure_HeavyFactory] == 0) || militaryValue < militaryValueLimit * 0.30_fix)
+                        && itemCount[Structure_WOR] == 0 && money > 1000 && pBuilder->getProductionQueueSize() < 1
+                        && pBuilder->getBuildListSize() > 0 && !getHouse()->isInfantryUnitLimitReached()
+                        && militaryValue < militaryValueLimit) {
+
+                        doProduceItem(pBuilder, Unit_Soldier);
+                        itemCount[Unit_Soldier]++;
+                    }
+                } break;
+
+                case Structure_HighTechFactory: {
+                    int ornithopterValue =
+                        data[Unit_Ornithopter][static_cast<int>(houseID)].price * itemCount[Unit_Ornithopter];
+
+                    if (pBuilder->isAvailableToBuild(Unit_Carryall)
+                        && itemCount[Unit_Carryall] < (militaryValue + itemCount[Unit_Harvester] * 500) / 3000
+                        && (pBuilder->getProductionQueueSize() < 1) && money > 1000
+                        && !getHouse()->isAirUnitLimitReached()
+                        && itemCount[Unit_Carryall] * 5 < getHouse()->getMaxUnits()) {
+                        doProduceItem(pBuilder, Unit_Carryall);
+                        itemCount[Unit_Carryall]++;
+                    } else if ((money > 500) && (!pBuilder->isUpgrading())
+                               && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
+                        if (pBuilder->getHealth() >= pBuilder->getMaxHealth()) {
+                            doUpgrade(pBuilder);
+                        } else {
+                            doRepair(pBuilder);
                         }
-                    } break;
-
-                    case Structure_HighTechFactory: {
-                        int ornithopterValue =
-                            data[Unit_Ornithopter][static_cast<int>(houseID)].price * itemCount[Unit_Ornithopter];
-
-                        if (pBuilder->isAvailableToBuild(Unit_Carryall)
-                            && itemCount[Unit_Carryall] < (militaryValue + itemCount[Unit_Harvester] * 500) / 3000
-                            && (pBuilder->getProductionQueueSize() < 1) && money > 1000
-                            && !getHouse()->isAirUnitLimitReached()
-                            && itemCount[Unit_Carryall] * 5 < getHouse()->getMaxUnits()) {
-                            doProduceItem(pBuilder, Unit_Carryall);
-                            itemCount[Unit_Carryall]++;
+                    } else if (pBuilder->isAvailableToBuild(Unit_Ornithopter)
+                               && (militaryValue * ornithopterPercent > ornithopterValue)
+                               && (pBuilder->getProductionQueueSize() < 1) && !getHouse()->isAirUnitLimitReached()
+                               && itemCount[Unit_Carryall] * 5 < getHouse()->getMaxUnits() && money > 1200) {
+                        // Current value and what percentage of military we want used to determine
+                        // whether to build an additional unit.
+                        doProduceItem(pBuilder, Unit_Ornithopter);
+                        itemCount[Unit_Ornithopter]++;
+                        money -= data[Unit_Ornithopter][static_cast<int>(houseID)].price;
+                        militaryValue += data[Unit_Ornithopter][static_cast<int>(houseID)].price;
+                    }
+                } break;
+
+                case Structure_HeavyFactory: {
+                    // only if the factory isn't busy
+                    if ((!pBuilder->isUpgrading()) && (pBuilder->getProductionQueueSize() < 1)
+                        && (pBuilder->getBuildListSize() > 0)) {
+                        // we need a construction yard. Build an MCV if we don't have a starport
+                        if ((difficulty == Difficulty::Hard || difficulty == Difficulty::Brutal)
+                            && itemCount[Unit_MCV] + itemCount[Structure_ConstructionYard]
+                                       + itemCount[Structure_StarPort]
+                                   < 1
+                            && pBuilder->isAvailableToBuild(Unit_MCV) && !getHouse()->isGroundUnitLimitReached()
+                            && itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV] < 15
+                            && itemCount[Unit_MCV] < 5) {
+                            doProduceItem(pBuilder, Unit_MCV);
+                            itemCount[Unit_MCV]++;
+                        } else if ((money > 10000) && (pBuilder->isUpgrading() == false)
+                                   && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
+                            if (pBuilder->getHealth() >= pBuilder->getMaxHealth()) {
+                                doUpgrade(pBuilder);
+                            } else {
+                                doRepair(pBuilder);
+                            }
+                        } else if (gameMode == GameMode::Custom
+                                   && (itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV]) * 10000 < money
+                                   && pBuilder->isAvailableToBuild(Unit_MCV)
+                                   && itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV] < 4
+                                   && !getHouse()->isGroundUnitLimitReached()) {
+                            // If we are really rich, like in all against Atriedes
+                            doProduceItem(pBuilder, Unit_MCV);
+                            itemCount[Unit_MCV]++;
+                        } else if (gameMode == GameMode::Custom && pBuilder->isAvailableToBuild(Unit_Harvester)
+                                   && !getHouse()->isGroundUnitLimitReached()
+                                   && itemCount[Unit_Harvester] < militaryValue / 1000
+                                   && itemCount[Unit_Harvester] < harvesterLimit) {
+                            // In case we get given lots of money, it will eventually run out so we need to be
+                            // prepared
+                            doProduceItem(pBuilder, Unit_Harvester);
+                            itemCount[Unit_Harvester]++;
+                        } else if (itemCount[Unit_Harvester] < harvesterLimit
+                                   && pBuilder->isAvailableToBuild(Unit_Harvester)
+                                   && !getHouse()->isGroundUnitLimitReached()
+                                   && (money < 2000 || gameMode == GameMode::Campaign)) {
+                            // logDebug("*Building a Harvester.",
+                            // itemCount[Unit_Harvester], harvesterLimit, money);
+                            doProduceItem(pBuilder, Unit_Harvester);
+                            itemCount[Unit_Harvester]++;
                         } else if ((money > 500) && (!pBuilder->isUpgrading())
                                    && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
                             if (pBuilder->getHealth() >= pBuilder->getMaxHealth()) {
@@ -1012,423 +1094,356 @@ void QuantBot::build(int militaryValue) {
                             } else {
                                 doRepair(pBuilder);
                             }
-                        } else if (pBuilder->isAvailableToBuild(Unit_Ornithopter)
-                                   && (militaryValue * ornithopterPercent > ornithopterValue)
-                                   && (pBuilder->getProductionQueueSize() < 1) && !getHouse()->isAirUnitLimitReached()
-                                   && itemCount[Unit_Carryall] * 5 < getHouse()->getMaxUnits() && money > 1200) {
-                            // Current value and what percentage of military we want used to determine
-                            // whether to build an additional unit.
-                            doProduceItem(pBuilder, Unit_Ornithopter);
-                            itemCount[Unit_Ornithopter]++;
-                            money -= data[Unit_Ornithopter][static_cast<int>(houseID)].price;
-                            militaryValue += data[Unit_Ornithopter][static_cast<int>(houseID)].price;
-                        }
-                    } break;
-
-                    case Structure_HeavyFactory: {
-                        // only if the factory isn't busy
-                        if ((!pBuilder->isUpgrading()) && (pBuilder->getProductionQueueSize() < 1)
-                            && (pBuilder->getBuildListSize() > 0)) {
-                            // we need a construction yard. Build an MCV if we don't have a starport
-                            if ((difficulty == Difficulty::Hard || difficulty == Difficulty::Brutal)
-                                && itemCount[Unit_MCV] + itemCount[Structure_ConstructionYard]
-                                           + itemCount[Structure_StarPort]
-                                       < 1
-                                && pBuilder->isAvailableToBuild(Unit_MCV) && !getHouse()->isGroundUnitLimitReached()
-                                && itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV] < 15
-                                && itemCount[Unit_MCV] < 5) {
-                                doProduceItem(pBuilder, Unit_MCV);
-                                itemCount[Unit_MCV]++;
-                            } else if ((money > 10000) && (pBuilder->isUpgrading() == false)
-                                       && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
-                                if (pBuilder->getHealth() >= pBuilder->getMaxHealth()) {
-                                    doUpgrade(pBuilder);
-                                } else {
-                                    doRepair(pBuilder);
-                                }
-                            } else if (gameMode == GameMode::Custom
-                                       && (itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV]) * 10000 < money
-                                       && pBuilder->isAvailableToBuild(Unit_MCV)
-                                       && itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV] < 4
-                                       && !getHouse()->isGroundUnitLimitReached()) {
-                                // If we are really rich, like in all against Atriedes
-                                doProduceItem(pBuilder, Unit_MCV);
-                                itemCount[Unit_MCV]++;
-                            } else if (gameMode == GameMode::Custom && pBuilder->isAvailableToBuild(Unit_Harvester)
-                                       && !getHouse()->isGroundUnitLimitReached()
-                                       && itemCount[Unit_Harvester] < militaryValue / 1000
-                                       && itemCount[Unit_Harvester] < harvesterLimit) {
-                                // In case we get given lots of money, it will eventually run out so we need to be
-                                // prepared
-                                doProduceItem(pBuilder, Unit_Harvester);
-                                itemCount[Unit_Harvester]++;
-                            } else if (itemCount[Unit_Harvester] < harvesterLimit
-                                       && pBuilder->isAvailableToBuild(Unit_Harvester)
-                                       && !getHouse()->isGroundUnitLimitReached()
-                                       && (money < 2000 || gameMode == GameMode::Campaign)) {
-                                // logDebug("*Building a Harvester.",
-                                // itemCount[Unit_Harvester], harvesterLimit, money);
-                                doProduceItem(pBuilder, Unit_Harvester);
-                                itemCount[Unit_Harvester]++;
-                            } else if ((money > 500) && (!pBuilder->isUpgrading())
-                                       && (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel())) {
-                                if (pBuilder->getHealth() >= pBuilder->getMaxHealth()) {
-                                    doUpgrade(pBuilder);
-                                } else {
-                                    doRepair(pBuilder);
-                                }
-                            } else if (money > 2000 && militaryValue < militaryValueLimit
-                                       && !getHouse()->isGroundUnitLimitReached()) {
-                                // TODO: This entire section needs to be refactored to make it more generic
-                                // Limit enemy military units based on difficulty
-
-                                // Calculate current value of units
-                                int launcherValue =
-                                    data[Unit_Launcher][static_cast<int>(houseID)].price * itemCount[Unit_Launcher];
-                                int specialValue =
-                                    data[Unit_Devastator][static_cast<int>(houseID)].price * itemCount[Unit_Devastator]
-                                    + data[Unit_Deviator][static_cast<int>(houseID)].price * itemCount[Unit_Deviator]
-                                    + data[Unit_SonicTank][static_cast<int>(houseID)].price * itemCount[Unit_SonicTank];
-                                int siegeValue =
-                                    data[Unit_SiegeTank][static_cast<int>(houseID)].price * itemCount[Unit_SiegeTank];
-
-                                /// Use current value and what percentage of military we want to determine
-                                /// whether to build an additional unit.
-                                if (pBuilder->isAvailableToBuild(Unit_Launcher)
-                                    && (militaryValue * launcherPercent > launcherValue)) {
-                                    doProduceItem(pBuilder, Unit_Launcher);
-                                    itemCount[Unit_Launcher]++;
-                                    money -= data[Unit_Launcher][static_cast<int>(houseID)].price;
-                                    militaryValue += data[Unit_Launcher][static_cast<int>(houseID)].price;
-                                } else if (pBuilder->isAvailableToBuild(Unit_Devastator)
-                                           && (militaryValue * specialPercent > specialValue)) {
-                                    doProduceItem(pBuilder, Unit_Devastator);
-                                    itemCount[Unit_Devastator]++;
-                                    money -= data[Unit_Devastator][static_cast<int>(houseID)].price;
-                                    militaryValue += data[Unit_Devastator][static_cast<int>(houseID)].price;
-                                } else if (pBuilder->isAvailableToBuild(Unit_SonicTank)
-                                           && (militaryValue * specialPercent > specialValue)) {
-                                    doProduceItem(pBuilder, Unit_SonicTank);
-                                    itemCount[Unit_SonicTank]++;
-                                    money -= data[Unit_SonicTank][static_cast<int>(houseID)].price;
-                                    militaryValue += data[Unit_SonicTank][static_cast<int>(houseID)].price;
-                                } else if (pBuilder->isAvailableToBuild(Unit_Deviator)
-                                           && (militaryValue * specialPercent > specialValue)) {
-                                    doProduceItem(pBuilder, Unit_Deviator);
-                                    itemCount[Unit_Deviator]++;
-                                    money -= data[Unit_Deviator][static_cast<int>(houseID)].price;
-                                    militaryValue += data[Unit_Deviator][static_cast<int>(houseID)].price;
-                                } else if (pBuilder->isAvailableToBuild(Unit_SiegeTank)
-                                           && (militaryValue * siegePercent > siegeValue)) {
-                                    doProduceItem(pBuilder, Unit_SiegeTank);
-                                    itemCount[Unit_SiegeTank]++;
-                                    money -= data[Unit_Tank][static_cast<int>(houseID)].price;
-                                    militaryValue += data[Unit_SiegeTank][static_cast<int>(houseID)].price;
-                                } else if (pBuilder->isAvailableToBuild(Unit_Tank)) {
-                                    // Tanks for all else
-                                    doProduceItem(pBuilder, Unit_Tank);
-                                    itemCount[Unit_Tank]++;
-                                    money -= data[Unit_Tank][static_cast<int>(houseID)].price;
-                                    militaryValue += data[Unit_Tank][static_cast<int>(houseID)].price;
-                                }
+                        } else if (money > 2000 && militaryValue < militaryValueLimit
+                                   && !getHouse()->isGroundUnitLimitReached()) {
+                            // TODO: This entire section needs to be refactored to make it more generic
+                            // Limit enemy military units based on difficulty
+
+                            // Calculate current value of units
+                            int launcherValue =
+                                data[Unit_Launcher][static_cast<int>(houseID)].price * itemCount[Unit_Launcher];
+                            int specialValue =
+                                data[Unit_Devastator][static_cast<int>(houseID)].price * itemCount[Unit_Devastator]
+                                + data[Unit_Deviator][static_cast<int>(houseID)].price * itemCount[Unit_Deviator]
+                                + data[Unit_SonicTank][static_cast<int>(houseID)].price * itemCount[Unit_SonicTank];
+                            int siegeValue =
+                                data[Unit_SiegeTank][static_cast<int>(houseID)].price * itemCount[Unit_SiegeTank];
+
+                            /// Use current value and what percentage of military we want to determine
+                            /// whether to build an additional unit.
+                            if (pBuilder->isAvailableToBuild(Unit_Launcher)
+                                && (militaryValue * launcherPercent > launcherValue)) {
+                                doProduceItem(pBuilder, Unit_Launcher);
+                                itemCount[Unit_Launcher]++;
+                                money -= data[Unit_Launcher][static_cast<int>(houseID)].price;
+                                militaryValue += data[Unit_Launcher][static_cast<int>(houseID)].price;
+                            } else if (pBuilder->isAvailableToBuild(Unit_Devastator)
+                                       && (militaryValue * specialPercent > specialValue)) {
+                                doProduceItem(pBuilder, Unit_Devastator);
+                                itemCount[Unit_Devastator]++;
+                                money -= data[Unit_Devastator][static_cast<int>(houseID)].price;
+                                militaryValue += data[Unit_Devastator][static_cast<int>(houseID)].price;
+                            } else if (pBuilder->isAvailableToBuild(Unit_SonicTank)
+                                       && (militaryValue * specialPercent > specialValue)) {
+                                doProduceItem(pBuilder, Unit_SonicTank);
+                                itemCount[Unit_SonicTank]++;
+                                money -= data[Unit_SonicTank][static_cast<int>(houseID)].price;
+                                militaryValue += data[Unit_SonicTank][static_cast<int>(houseID)].price;
+                            } else if (pBuilder->isAvailableToBuild(Unit_Deviator)
+                                       && (militaryValue * specialPercent > specialValue)) {
+                                doProduceItem(pBuilder, Unit_Deviator);
+                                itemCount[Unit_Deviator]++;
+                                money -= data[Unit_Deviator][static_cast<int>(houseID)].price;
+                                militaryValue += data[Unit_Deviator][static_cast<int>(houseID)].price;
+                            } else if (pBuilder->isAvailableToBuild(Unit_SiegeTank)
+                                       && (militaryValue * siegePercent > siegeValue)) {
+                                doProduceItem(pBuilder, Unit_SiegeTank);
+                                itemCount[Unit_SiegeTank]++;
+                                money -= data[Unit_Tank][static_cast<int>(houseID)].price;
+                                militaryValue += data[Unit_SiegeTank][static_cast<int>(houseID)].price;
+                            } else if (pBuilder->isAvailableToBuild(Unit_Tank)) {
+                                // Tanks for all else
+                                doProduceItem(pBuilder, Unit_Tank);
+                                itemCount[Unit_Tank]++;
+                                money -= data[Unit_Tank][static_cast<int>(houseID)].price;
+                                militaryValue += data[Unit_Tank][static_cast<int>(houseID)].price;
                             }
                         }
+                    }
 
-                    } break;
+                } break;
 
-                    case Structure_StarPort: {
-                        const auto* pStarPort = static_cast<const StarPort*>(pBuilder);
-                        if (pStarPort->okToOrder()) {
-                            const Choam& choam = getHouse()->getChoam();
-
-                            // We need a construction yard!!
-                            if ((difficulty == Difficulty::Hard || difficulty == Difficulty::Brutal)
-                                && pStarPort->isAvailableToBuild(Unit_MCV) && choam.getNumAvailable(Unit_MCV) > 0
-                                && itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV] < 1) {
-                                doProduceItem(pBuilder, Unit_MCV);
-                                itemCount[Unit_MCV]++;
-                                money = money - choam.getPrice(Unit_MCV);
-                            }
+                case Structure_StarPort: {
+                    const auto* pStarPort = static_cast<const StarPort*>(pBuilder);
+                    if (pStarPort->okToOrder()) {
+                        const Choam& choam = getHouse()->getChoam();
 
-                            if (money > choam.getPrice(Unit_Carryall) && choam.getNumAvailable(Unit_Carryall) > 0
-                                && itemCount[Unit_Carryall] == 0) {
-                                // Get at least one Carryall
-                                doProduceItem(pBuilder, Unit_Carryall);
-                                itemCount[Unit_Carryall]++;
-                                money = money - choam.getPrice(Unit_Carryall);
-                            }
+                        // We need a construction yard!!
+                        if ((difficulty == Difficulty::Hard || difficulty == Difficulty::Brutal)
+                            && pStarPort->isAvailableToBuild(Unit_MCV) && choam.getNumAvailable(Unit_MCV) > 0
+                            && itemCount[Structure_ConstructionYard] + itemCount[Unit_MCV] < 1) {
+                            doProduceItem(pBuilder, Unit_MCV);
+                            itemCount[Unit_MCV]++;
+                            money = money - choam.getPrice(Unit_MCV);
+                        }
 
-                            while (money > choam.getPrice(Unit_Harvester) && choam.getNumAvailable(Unit_Harvester) > 0
-                                   && itemCount[Unit_Harvester] < harvesterLimit) {
-                                doProduceItem(pBuilder, Unit_Harvester);
-                                itemCount[Unit_Harvester]++;
-                                money = money - choam.getPrice(Unit_Harvester);
-                            }
+                        if (money > choam.getPrice(Unit_Carryall) && choam.getNumAvailable(Unit_Carryall) > 0
+                            && itemCount[Unit_Carryall] == 0) {
+                            // Get at least one Carryall
+                            doProduceItem(pBuilder, Unit_Carryall);
+                            itemCount[Unit_Carryall]++;
+                            money = money - choam.getPrice(Unit_Carryall);
+                        }
 
-                            int itemCountUnits = itemCount[Unit_Tank] + itemCount[Unit_SiegeTank]
-                                               + itemCount[Unit_Launcher] + itemCount[Unit_Harvester];
+                        while (money > choam.getPrice(Unit_Harvester) && choam.getNumAvailable(Unit_Harvester) > 0
+                               && itemCount[Unit_Harvester] < harvesterLimit) {
+                            doProduceItem(pBuilder, Unit_Harvester);
+                            itemCount[Unit_Harvester]++;
+                            money = money - choam.getPrice(Unit_Harvester);
+                        }
 
-                            while (money > choam.getPrice(Unit_Carryall) && choam.getNumAvailable(Unit_Carryall) > 0
-                                   && itemCount[Unit_Carryall] < itemCountUnits / 7) {
-                                doProduceItem(pBuilder, Unit_Carryall);
-                                itemCount[Unit_Carryall]++;
-                                money = money - choam.getPrice(Unit_Carryall);
-                            }
+                        int itemCountUnits = itemCount[Unit_Tank] + itemCount[Unit_SiegeTank]
+                                           + itemCount[Unit_Launcher] + itemCount[Unit_Harvester];
 
-                            while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_SiegeTank)
-                                   && choam.getNumAvailable(Unit_SiegeTank) > 0 && choam.isCheap(Unit_SiegeTank)
-                                   && militaryValue < militaryValueLimit && money > 2000) {
-                                doProduceItem(pBuilder, Unit_SiegeTank);
-                                itemCount[Unit_SiegeTank]++;
-                                money = money - choam.getPrice(Unit_SiegeTank);
-                                militaryValue += data[Unit_SiegeTank][static_cast<int>(houseID)].price;
-                            }
+                        while (money > choam.getPrice(Unit_Carryall) && choam.getNumAvailable(Unit_Carryall) > 0
+                               && itemCount[Unit_Carryall] < itemCountUnits / 7) {
+                            doProduceItem(pBuilder, Unit_Carryall);
+                            itemCount[Unit_Carryall]++;
+                            money = money - choam.getPrice(Unit_Carryall);
+                        }
 
-                            while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_Launcher)
-                                   && choam.getNumAvailable(Unit_Launcher) > 0 && choam.isCheap(Unit_Launcher)
-                                   && militaryValue < militaryValueLimit && money > 2000) {
-                                doProduceItem(pBuilder, Unit_Launcher);
-                                itemCount[Unit_Launcher]++;
-                                money = money - choam.getPrice(Unit_Launcher);
-                                militaryValue += data[Unit_Launcher][static_cast<int>(houseID)].price;
-                            }
+                        while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_SiegeTank)
+                               && choam.getNumAvailable(Unit_SiegeTank) > 0 && choam.isCheap(Unit_SiegeTank)
+                               && militaryValue < militaryValueLimit && money > 2000) {
+                            doProduceItem(pBuilder, Unit_SiegeTank);
+                            itemCount[Unit_SiegeTank]++;
+                            money = money - choam.getPrice(Unit_SiegeTank);
+                            militaryValue += data[Unit_SiegeTank][static_cast<int>(houseID)].price;
+                        }
 
-                            while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_Tank)
-                                   && choam.getNumAvailable(Unit_Tank) > 0 && choam.isCheap(Unit_Tank)
-                                   && militaryValue < militaryValueLimit && money > 2000) {
-                                doProduceItem(pBuilder, Unit_Tank);
-                                itemCount[Unit_Tank]++;
-                                money = money - choam.getPrice(Unit_Tank);
-                                militaryValue += data[Unit_Tank][static_cast<int>(houseID)].price;
-                            }
+                        while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_Launcher)
+                               && choam.getNumAvailable(Unit_Launcher) > 0 && choam.isCheap(Unit_Launcher)
+                               && militaryValue < militaryValueLimit && money > 2000) {
+                            doProduceItem(pBuilder, Unit_Launcher);
+                            itemCount[Unit_Launcher]++;
+                            money = money - choam.getPrice(Unit_Launcher);
+                            militaryValue += data[Unit_Launcher][static_cast<int>(houseID)].price;
+                        }
 
-                            while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_Ornithopter)
-                                   && choam.getNumAvailable(Unit_Ornithopter) > 0 && choam.isCheap(Unit_Ornithopter)
-                                   && militaryValue < militaryValueLimit && money > 2000) {
-                                doProduceItem(pBuilder, Unit_Ornithopter);
-                                itemCount[Unit_Ornithopter]++;
-                                money = money - choam.getPrice(Unit_Ornithopter);
-                                militaryValue += data[Unit_Ornithopter][static_cast<int>(houseID)].price;
-                            }
+                        while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_Tank)
+                               && choam.getNumAvailable(Unit_Tank) > 0 && choam.isCheap(Unit_Tank)
+                               && militaryValue < militaryValueLimit && money > 2000) {
+                            doProduceItem(pBuilder, Unit_Tank);
+                            itemCount[Unit_Tank]++;
+                            money = money - choam.getPrice(Unit_Tank);
+                            militaryValue += data[Unit_Tank][static_cast<int>(houseID)].price;
+                        }
 
-                            doPlaceOrder(pStarPort);
+                        while (militaryValue < militaryValueLimit && money > choam.getPrice(Unit_Ornithopter)
+                               && choam.getNumAvailable(Unit_Ornithopter) > 0 && choam.isCheap(Unit_Ornithopter)
+                               && militaryValue < militaryValueLimit && money > 2000) {
+                            doProduceItem(pBuilder, Unit_Ornithopter);
+                            itemCount[Unit_Ornithopter]++;
+                            money = money - choam.getPrice(Unit_Ornithopter);
+                            militaryValue += data[Unit_Ornithopter][static_cast<int>(houseID)].price;
                         }
 
-                    } break;
+                        doPlaceOrder(pStarPort);
+                    }
 
-                    case Structure_ConstructionYard: {
+                } break;
 
-                        if constexpr (false) {
-                            // If rocket turrets don't need power then let's build some for defense
-                            int rocketTurretValue = itemCount[Structure_RocketTurret] * 250;
+                case Structure_ConstructionYard: {
 
-                            // disable rocket turrets for now
-                            if (getGameInitSettings().getGameOptions().rocketTurretsNeedPower || true) {
-                                rocketTurretValue = 1000000; // If rocket turrets need power we don't want to build them
-                            }
+                    if constexpr (false) {
+                        // If rocket turrets don't need power then let's build some for defense
+                        int rocketTurretValue = itemCount[Structure_RocketTurret] * 250;
+
+                        // disable rocket turrets for now
+                        if (getGameInitSettings().getGameOptions().rocketTurretsNeedPower || true) {
+                            rocketTurretValue = 1000000; // If rocket turrets need power we don't want to build them
                         }
+                    }
 
-                        const auto* pConstYard = static_cast<const ConstructionYard*>(pBuilder);
+                    const auto* pConstYard = static_cast<const ConstructionYard*>(pBuilder);
 
-                        if (!pBuilder->isUpgrading() && getHouse()->getCredits() > 100
-                            && (pBuilder->getProductionQueueSize() < 1) && pBuilder->getBuildListSize()) {
+                    if (!pBuilder->isUpgrading() && getHouse()->getCredits() > 100
+                        && (pBuilder->getProductionQueueSize() < 1) && pBuilder->getBuildListSize()) {
 
-                            // Campaign Build order, iterate through the buildings, if the number that exist
-                            // is less than the number that should exist, then build the one that is missing
+                        // Campaign Build order, iterate through the buildings, if the number that exist
+                        // is less than the number that should exist, then build the one that is missing
 
-                            if (gameMode == GameMode::Campaign && difficulty != Difficulty::Brutal) {
-                                // logDebug("GameMode Campaign.. ");
+                        if (gameMode == GameMode::Campaign && difficulty != Difficulty::Brutal) {
+                            // logDebug("GameMode Campaign.. ");
 
-                                for (int i = Structure_FirstID; i <= Structure_LastID; i++) {
-                                    if (itemCount[i] < initialItemCount[i]
-                                        && pBuilder->isAvailableToBuild(static_cast<ItemID_enum>(i))
-                                        && findPlaceLocation(static_cast<ItemID_enum>(i)).isValid()
-                                        && !pBuilder->isUpgrading() && pBuilder->getProductionQueueSize() < 1) {
+                            for (int i = Structure_FirstID; i <= Structure_LastID; i++) {
+                                if (itemCount[i] < initialItemCount[i]
+                                    && pBuilder->isAvailableToBuild(static_cast<ItemID_enum>(i))
+                                    && findPlaceLocation(static_cast<ItemID_enum>(i)).isValid()
+                                    && !pBuilder->isUpgrading() && pBuilder->getProductionQueueSize() < 1) {
 
-                                        logDebug("***CampAI Build itemID: %o structure count: %o, initial count: %o", i,
-                                                 itemCount[i], initialItemCount[i]);
-                                        doProduceItem(pBuilder, static_cast<ItemID_enum>(i));
-                                        itemCount[i]++;
-                                    }
+                                    logDebug("***CampAI Build itemID: %o structure count: %o, initial count: %o", i,
+                                             itemCount[i], initialItemCount[i]);
+                                    doProduceItem(pBuilder, static_cast<ItemID_enum>(i));
+                                    itemCount[i]++;
                                 }
+                            }
 
-                                // If Campaign AI can't build military, let it build up its cash reserves and defenses
-
-                                if (pStructure->getHealth() < pStructure->getMaxHealth()) {
-                                    doRepair(pBuilder);
-                                } else if (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel()
-                                           && !pBuilder->isUpgrading() && itemCount[Unit_Harvester] >= harvesterLimit) {
-
-                                    (void)doUpgrade(pBuilder);
-                                    logDebug("***CampAI Upgrade builder");
-                                } else if ((getHouse()->getProducedPower() < getHouse()->getPowerRequirement())
-                                           && pBuilder->isAvailableToBuild(Structure_WindTrap)
-                                           && findPlaceLocation(Structure_WindTrap).isValid()
-                                           && pBuilder->getProductionQueueSize() == 0) {
-
-                                    doProduceItem(pBuilder, Structure_WindTrap);
-                                    itemCount[Structure_WindTrap]++;
-
-                                    logDebug("***CampAI Build A new Windtrap increasing count to: %d",
-                                             itemCount[Structure_WindTrap]);
-                                } else if ((getHouse()->getCapacity() < getHouse()->getStoredCredits() + 2000)
-                                           && pBuilder->isAvailableToBuild(Structure_Silo)
-                                           && findPlaceLocation(Structure_Silo).isValid()
-                                           && pBuilder->getProductionQueueSize() == 0) {
-
-                                    doProduceItem(pBuilder, Structure_Silo);
-                                    itemCount[Structure_Silo]++;
-
-                                    logDebug("***CampAI Build A new Silo increasing count to: %d",
-                                             itemCount[Structure_Silo]);
-                                } else if (money > 3000 && pBuilder->isAvailableToBuild(Structure_RocketTurret)
-                                           && findPlaceLocation(Structure_RocketTurret).isValid()
-                                           && pBuilder->getProductionQueueSize() == 0
-                                           && (itemCount[Structure_RocketTurret]
-                                               < (itemCount[Structure_Silo] + itemCount[Structure_Refinery]) * 2)) {
-
-                                    doProduceItem(pBuilder, Structure_RocketTurret);
-                                    itemCount[Structure_RocketTurret]++;
-
-                                    logDebug("***CampAI Build A new Rocket turret increasing count to: %d",
-                                             itemCount[Structure_RocketTurret]);
-                                }
+                            // If Campaign AI can't build military, let it build up its cash reserves and defenses
 
-                                buildTimer = getRandomGen().rand(0, 3) * 5;
-                            } else {
-                                // custom AI starts here:
-
-                                auto itemID = ItemID_enum::ItemID_Invalid;
-
-                                if (itemCount[Structure_WindTrap] == 0
-                                    && pBuilder->isAvailableToBuild(Structure_WindTrap)) {
-                                    itemID = Structure_WindTrap;
-                                    itemCount[Structure_WindTrap]++;
-                                } else if ((itemCount[Structure_Refinery] == 0
-                                            || itemCount[Structure_Refinery] < itemCount[Unit_Harvester] / 3)
-                                           && pBuilder->isAvailableToBuild(Structure_Refinery)) {
-                                    itemID = Structure_Refinery;
-                                    itemCount[Unit_Harvester]++;
-                                    itemCount[Structure_Refinery]++;
-                                } else if (itemCount[Structure_Refinery] < 3
-                                           && pBuilder->isAvailableToBuild(Structure_Refinery) && money < 4000) {
-                                    itemID = Structure_Refinery;
-                                    itemCount[Unit_Harvester]++;
-                                    itemCount[Structure_Refinery]++;
-                                } else if (itemCount[Structure_StarPort] == 0
-                                           && pBuilder->isAvailableToBuild(Structure_StarPort)
-                                           && findPlaceLocation(Structure_StarPort).isValid()) {
-                                    itemID = Structure_StarPort;
-                                } else if (itemCount[Structure_LightFactory] == 0
-                                           && pBuilder->isAvailableToBuild(Structure_LightFactory)
-                                           && ((itemCount[Unit_Harvester] > 4 && money > 1500) || money > 3000)) {
-                                    itemID = Structure_LightFactory;
-                                } else if (itemCount[Structure_Radar] == 0
-                                           && pBuilder->isAvailableToBuild(Structure_Radar)
-                                           && (((itemCount[Unit_Harvester] > 4 && money > 1500) || money > 3000))) {
-                                    itemID = Structure_Radar;
-                                } else if (itemCount[Structure_HeavyFactory] == 0 && money > 10000
-                                           && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
+                            if (pStructure->getHealth() < pStructure->getMaxHealth()) {
+                                doRepair(pBuilder);
+                            } else if (pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel()
+                                       && !pBuilder->isUpgrading() && itemCount[Unit_Harvester] >= harvesterLimit) {
+
+                                (void)doUpgrade(pBuilder);
+                                logDebug("***CampAI Upgrade builder");
+                            } else if ((getHouse()->getProducedPower() < getHouse()->getPowerRequirement())
+                                       && pBuilder->isAvailableToBuild(Structure_WindTrap)
+                                       && findPlaceLocation(Structure_WindTrap).isValid()
+                                       && pBuilder->getProductionQueueSize() == 0) {
+
+                                doProduceItem(pBuilder, Structure_WindTrap);
+                                itemCount[Structure_WindTrap]++;
+
+                                logDebug("***CampAI Build A new Windtrap increasing count to: %d",
+                                         itemCount[Structure_WindTrap]);
+                            } else if ((getHouse()->getCapacity() < getHouse()->getStoredCredits() + 2000)
+                                       && pBuilder->isAvailableToBuild(Structure_Silo)
+                                       && findPlaceLocation(Structure_Silo).isValid()
+                                       && pBuilder->getProductionQueueSize() == 0) {
+
+                                doProduceItem(pBuilder, Structure_Silo);
+                                itemCount[Structure_Silo]++;
+
+                                logDebug("***CampAI Build A new Silo increasing count to: %d",
+                                         itemCount[Structure_Silo]);
+                            } else if (money > 3000 && pBuilder->isAvailableToBuild(Structure_RocketTurret)
+                                       && findPlaceLocation(Structure_RocketTurret).isValid()
+                                       && pBuilder->getProductionQueueSize() == 0
+                                       && (itemCount[Structure_RocketTurret]
+                                           < (itemCount[Structure_Silo] + itemCount[Structure_Refinery]) * 2)) {
+
+                                doProduceItem(pBuilder, Structure_RocketTurret);
+                                itemCount[Structure_RocketTurret]++;
+
+                                logDebug("***CampAI Build A new Rocket turret increasing count to: %d",
+                                         itemCount[Structure_RocketTurret]);
+                            }
+
+                            buildTimer = getRandomGen().rand(0, 3) * 5;
+                        } else {
+                            // custom AI starts here:
+
+                            auto itemID = ItemID_enum::ItemID_Invalid;
+
+                            if (itemCount[Structure_WindTrap] == 0
+                                && pBuilder->isAvailableToBuild(Structure_WindTrap)) {
+                                itemID = Structure_WindTrap;
+                                itemCount[Structure_WindTrap]++;
+                            } else if ((itemCount[Structure_Refinery] == 0
+                                        || itemCount[Structure_Refinery] < itemCount[Unit_Harvester] / 3)
+                                       && pBuilder->isAvailableToBuild(Structure_Refinery)) {
+                                itemID = Structure_Refinery;
+                                itemCount[Unit_Harvester]++;
+                                itemCount[Structure_Refinery]++;
+                            } else if (itemCount[Structure_Refinery] < 3
+                                       && pBuilder->isAvailableToBuild(Structure_Refinery) && money < 4000) {
+                                itemID = Structure_Refinery;
+                                itemCount[Unit_Harvester]++;
+                                itemCount[Structure_Refinery]++;
+                            } else if (itemCount[Structure_StarPort] == 0
+                                       && pBuilder->isAvailableToBuild(Structure_StarPort)
+                                       && findPlaceLocation(Structure_StarPort).isValid()) {
+                                itemID = Structure_StarPort;
+                            } else if (itemCount[Structure_LightFactory] == 0
+                                       && pBuilder->isAvailableToBuild(Structure_LightFactory)
+                                       && ((itemCount[Unit_Harvester] > 4 && money > 1500) || money > 3000)) {
+                                itemID = Structure_LightFactory;
+                            } else if (itemCount[Structure_Radar] == 0 && pBuilder->isAvailableToBuild(Structure_Radar)
+                                       && (((itemCount[Unit_Harvester] > 4 && money > 1500) || money > 3000))) {
+                                itemID = Structure_Radar;
+                            } else if (itemCount[Structure_HeavyFactory] == 0 && money > 10000
+                                       && pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
+                                itemID = Structure_HeavyFactory;
+                            } else if (itemCount[Structure_RepairYard] == 0
+                                       && pBuilder->isAvailableToBuild(Structure_RepairYard)) {
+                                itemID = Structure_RepairYard;
+                            } else if (itemCount[Structure_HeavyFactory] == 0 && money > 2000) {
+                                if (pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
                                     itemID = Structure_HeavyFactory;
-                                } else if (itemCount[Structure_RepairYard] == 0
-                                           && pBuilder->isAvailableToBuild(Structure_RepairYard)) {
-                                    itemID = Structure_RepairYard;
-                                } else if (itemCount[Structure_HeavyFactory] == 0 && money > 2000) {
-                                    if (pBuilder->isAvailableToBuild(Structure_HeavyFactory)) {
-                                        itemID = Structure_HeavyFactory;
-                                    }
-                                } else if (itemCount[Structure_HighTechFactory] == 0 && money > 2000) {
-                                    if (pBuilder->isAvailableToBuild(Structure_HighTechFactory)) {
-                                        itemID = Structure_HighTechFactory;
-                                    }
                                 }
-                                // If we need more refinerys for our harvesters or we don't have a heavy factory
-                                else if (((money > 2000 && itemCount[Structure_Refinery] * 3.5_fix < harvesterLimit)
-                                          || (context_.game.techLevel < 4 && itemCount[Unit_Harvester] < harvesterLimit
-                                              && money > 1000))
-                                         && pBuilder->isAvailableToBuild(Structure_Refinery)) {
-                                    itemID = Structure_Refinery;
-                                    itemCount[Unit_Harvester]++;
-                                    itemCount[Structure_Refinery]++;
-
-                                } else if (itemCount[Structure_IX] == 0 && money > 2500) {
-                                    // Let's trial special units
-                                    if (pBuilder->isAvailableToBuild(Structure_IX)) {
-                                        itemID = Structure_IX;
-                                    }
-                                } else if (pBuilder->isAvailableToBuild(Structure_RepairYard) && money > 2000
-                                           && (itemCount[Structure_RepairYard]
-                                                   <= activeRepairYardCount // is this still working?
-                                               || itemCount[Structure_RepairYard] * 5000 < militaryValue)) {
-                                    // If we have a lot of troops get some repair facilities
-                                    itemID = Structure_RepairYard;
-                                    // logDebug("Build Repair... active: %d  total: %d", activeRepairYardCount,
-                                    // getHouse()->getNumItems(Structure_RepairYard));
-
-                                } else if ((pBuilder->isAvailableToBuild(Structure_HeavyFactory)
-                                            && ((itemCount[Structure_HeavyFactory] <= activeHeavyFactoryCount
-                                                 && (money > 1000 + itemCount[Structure_HeavyFactory] * 1500))
-                                                || (itemCount[Structure_HeavyFactory] < 3
-                                                    && money > 1000 + itemCount[Structure_HeavyFactory] * 2000)))
-                                           || (money > 1000 + itemCount[Structure_HeavyFactory] * 3000)) {
-                                    // If we have a lot of money get more heavy factories
-                                    itemID = Structure_HeavyFactory;
-                                    logDebug("Build Factory... active: %d  total: %d", activeHeavyFactoryCount,
-                                             getHouse()->getNumItems(Structure_HeavyFactory));
-                                } else if (itemCount[Structure_Refinery] * 3.5_fix < itemCount[Unit_Harvester]
-                                           && pBuilder->isAvailableToBuild(Structure_Refinery)) {
-                                    itemID = Structure_Refinery;
-                                } else if (getHouse()->getStoredCredits() + 1000
-                                               > (itemCount[Structure_Refinery] + itemCount[Structure_Silo]) * 1000
-                                           && pBuilder->isAvailableToBuild(Structure_Silo)) {
-                                    // We are running out of spice storage capacity
-                                    itemID = Structure_Silo;
-                                } else if (money > 8000 && pBuilder->isAvailableToBuild(Structure_Palace)
-                                           && getGameInitSettings().getGameOptions().onlyOnePalace
-                                           && itemCount[Structure_Palace] == 0) {
-                                    // Let's build one palace if its available
-                                    itemID = Structure_Palace;
-                                } else if (money > 10000
-                                           && pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel()) {
-                                    // First off we need to upgrade the construction yard
-                                    doUpgrade(pBuilder);
-                                } else if (money > 10000) {
-                                    // Here are our luxury items:
-                                    // - Rocket Turrets
-                                    // - Palaces
-                                    // Need to balance saving credits with expenditure on palaces and turrets
-
-                                    // logDebug("Build Luxury.. money: %d  mildecifict: %d", money, militaryValueLimit -
-                                    // militaryValue);
-                                    if (pBuilder->isAvailableToBuild(Structure_Palace)
-                                        && !getGameInitSettings().getGameOptions().onlyOnePalace) {
-                                        itemID = Structure_Palace;
-                                    }
+                            } else if (itemCount[Structure_HighTechFactory] == 0 && money > 2000) {
+                                if (pBuilder->isAvailableToBuild(Structure_HighTechFactory)) {
+                                    itemID = Structure_HighTechFactory;
                                 }
+                            }
+                            // If we need more refinerys for our harvesters or we don't have a heavy factory
+                            else if (((money > 2000 && itemCount[Structure_Refinery] * 3.5_fix < harvesterLimit)
+                                      || (context_.game.techLevel < 4 && itemCount[Unit_Harvester] < harvesterLimit
+                                          && money > 1000))
+                                     && pBuilder->isAvailableToBuild(Structure_Refinery)) {
+                                itemID = Structure_Refinery;
+                                itemCount[Unit_Harvester]++;
+                                itemCount[Structure_Refinery]++;
 
-                                // TODO: Build concrete if we have bad building spots
-                                if (pBuilder->isAvailableToBuild(itemID) && findPlaceLocation(itemID).isValid()
-                                    && itemID != ItemID_enum::ItemID_Invalid) {
-                                    doProduceItem(pBuilder, itemID);
-                                    itemCount[itemID]++;
-                                } /*else if(pBuilder->isAvailableToBuild(Structure_Slab1) &&
-                                 findPlaceLocation(Structure_Slab1).isValid()){ doProduceItem(pBuilder,
-                                 Structure_Slab1);
-                                 }*/
+                            } else if (itemCount[Structure_IX] == 0 && money > 2500) {
+                                // Let's trial special units
+                                if (pBuilder->isAvailableToBuild(Structure_IX)) {
+                                    itemID = Structure_IX;
+                                }
+                            } else if (pBuilder->isAvailableToBuild(Structure_RepairYard) && money > 2000
+                                       && (itemCount[Structure_RepairYard]
+                                               <= activeRepairYardCount // is this still working?
+                                           || itemCount[Structure_RepairYard] * 5000 < militaryValue)) {
+                                // If we have a lot of troops get some repair facilities
+                                itemID = Structure_RepairYard;
+                                // logDebug("Build Repair... active: %d  total: %d", activeRepairYardCount,
+                                // getHouse()->getNumItems(Structure_RepairYard));
+
+                            } else if ((pBuilder->isAvailableToBuild(Structure_HeavyFactory)
+                                        && ((itemCount[Structure_HeavyFactory] <= activeHeavyFactoryCount
+                                             && (money > 1000 + itemCount[Structure_HeavyFactory] * 1500))
+                                            || (itemCount[Structure_HeavyFactory] < 3
+                                                && money > 1000 + itemCount[Structure_HeavyFactory] * 2000)))
+                                       || (money > 1000 + itemCount[Structure_HeavyFactory] * 3000)) {
+                                // If we have a lot of money get more heavy factories
+                                itemID = Structure_HeavyFactory;
+                                logDebug("Build Factory... active: %d  total: %d", activeHeavyFactoryCount,
+                                         getHouse()->getNumItems(Structure_HeavyFactory));
+                            } else if (itemCount[Structure_Refinery] * 3.5_fix < itemCount[Unit_Harvester]
+                                       && pBuilder->isAvailableToBuild(Structure_Refinery)) {
+                                itemID = Structure_Refinery;
+                            } else if (getHouse()->getStoredCredits() + 1000
+                                           > (itemCount[Structure_Refinery] + itemCount[Structure_Silo]) * 1000
+                                       && pBuilder->isAvailableToBuild(Structure_Silo)) {
+                                // We are running out of spice storage capacity
+                                itemID = Structure_Silo;
+                            } else if (money > 8000 && pBuilder->isAvailableToBuild(Structure_Palace)
+                                       && getGameInitSettings().getGameOptions().onlyOnePalace
+                                       && itemCount[Structure_Palace] == 0) {
+                                // Let's build one palace if its available
+                                itemID = Structure_Palace;
+                            } else if (money > 10000
+                                       && pBuilder->getCurrentUpgradeLevel() < pBuilder->getMaxUpgradeLevel()) {
+                                // First off we need to upgrade the construction yard
+                                doUpgrade(pBuilder);
+                            } else if (money > 10000) {
+                                // Here are our luxury items:
+                                // - Rocket Turrets
+                                // - Palaces
+                                // Need to balance saving credits with expenditure on palaces and turrets
+
+                                // logDebug("Build Luxury.. money: %d  mildecifict: %d", money, militaryValueLimit -
+                                // militaryValue);
+                                if (pBuilder->isAvailableToBuild(Structure_Palace)
+                                    && !getGameInitSettings().getGameOptions().onlyOnePalace) {
+                                    itemID = Structure_Palace;
+                                }
                             }
+
+                            // TODO: Build concrete if we have bad building spots
+                            if (pBuilder->isAvailableToBuild(itemID) && findPlaceLocation(itemID).isValid()
+                                && itemID != ItemID_enum::ItemID_Invalid) {
+                                doProduceItem(pBuilder, itemID);
+                                itemCount[itemID]++;
+                            } /*else if(pBuilder->isAvailableToBuild(Structure_Slab1) &&
+                             findPlaceLocation(Structure_Slab1).isValid()){ doProduceItem(pBuilder,
+                             Structure_Slab1);
+                             }*/
                         }
+                    }
 
-                        if (pBuilder->isWaitingToPlace()) {
-                            Coord location = findPlaceLocation(pBuilder->getCurrentProducedItem());
+                    if (pBuilder->isWaitingToPlace()) {
+                        Coord location = findPlaceLocation(pBuilder->getCurrentProducedItem());
 
-                            if (location.isValid()) {
-                                doPlaceStructure(pConstYard, location.x, location.y);
-                            } else {
-                                doCancelItem(pConstYard, pBuilder->getCurrentProducedItem());
-                            }
+                        if (location.isValid()) {
+                            doPlaceStructure(pConstYard, location.x, location.y);
+                        } else {
+                            doCancelItem(pConstYard, pBuilder->getCurrentProducedItem());
                         }
-                    } break;
-                }
+                    }
+                } break;
             }
         }
     }
@@ -1437,8 +1452,8 @@ void QuantBot::build(int militaryValue) {
 }
 
 void QuantBot::scrambleUnitsAndDefend(const ObjectBase* pIntruder, int numUnits) {
-    for (const UnitBase* pUnit : getUnitList()) {
-        if (pUnit->isRespondable() && (pUnit->getOwner() == getHouse())) {
+    for (const UnitBase* pUnit : getOwnUnitList()) {
+        if (pUnit->isRespondable()) {
             if (!pUnit->hasATarget() && !pUnit->wasForced()) {
                 const ItemID_enum itemID = pUnit->getItemID();
                 if ((itemID != Unit_Harvester) && (pUnit->getItemID() != Unit_MCV)
@@ -1489,8 +1504,8 @@ void QuantBot::attack(int militaryValue) {
     // overwriting existing logic for the time being
     attackTimer = MILLI2CYCLES(40000);
 
-    for (const auto* pUnit : getUnitList()) {
-        if (pUnit->isRespondable() && (pUnit->getOwner() == getHouse()) && pUnit->isActive()
+    for (const auto* pUnit : getOwnUnitList()) {
+        if (pUnit->isRespondable() && pUnit->isActive()
             && pUnit->getItemID() != Unit_Harvester && pUnit->getItemID() != Unit_MCV
             && pUnit->getItemID() != Unit_Carryall && pUnit->getHealth() / pUnit->getMaxHealth() > 0.6_fix)
 
@@ -1501,33 +1516,21 @@ void QuantBot::attack(int militaryValue) {
 }
 
 Coord QuantBot::findSquadRallyLocation() {
-    int buildingCount = 0;
-    int totalX        = 0;
-    int totalY        = 0;
-
-    int enemyBuildingCount = 0;
-    int enemyTotalX        = 0;
-    int enemyTotalY        = 0;
-
-    for (const StructureBase* pCurrentStructure : getStructureList()) {
-        if (pCurrentStructure->getOwner()->getHouseID() == getHouse()->getHouseID()) {
-            // Lets find the center of mass of our squad
-            buildingCount++;
-            totalX += pCurrentStructure->getX();
-            totalY += pCurrentStructure->getY();
-        } else if (pCurrentStructure->getOwner()->getTeamID() != getHouse()->getTeamID()) {
-            enemyBuildingCount++;
-            enemyTotalX += pCurrentStructure->getX();
-            enemyTotalY += pCurrentStructure->getY();
-        }
-    }
+    const auto& buildings = getHouse()->getInfluence().getStructures();
+
+    HouseInfluence::Centroid enemyBuildings;
+    context_.game.for_each_house([&](const auto& house) {
+        if (house.getTeamID() != getHouse()->getTeamID())
+            enemyBuildings += house.getInfluence().getStructures();
+    });
 
     Coord baseCentreLocation = Coord::Invalid();
-    if (enemyBuildingCount > 0 && buildingCount > 0) {
-        baseCentreLocation.x =
-            lround((totalX / buildingCount) * 0.75_fix + (enemyTotalX / enemyBuildingCount) * 0.25_fix);
-        baseCentreLocation.y =
-            lround((totalY / buildingCount) * 0.75_fix + (enemyTotalY / enemyBuildingCount) * 0.25_fix);
+    if (enemyBuildings.count > 0 && buildings.count > 0) {
+        const auto centre      = buildings.getCentre();
+        const auto enemyCentre = enemyBuildings.getCentre();
+
+        baseCentreLocation.x = lround(centre.x * 0.75_fix + enemyCentre.x * 0.25_fix);
+        baseCentreLocation.y = lround(centre.y * 0.75_fix + enemyCentre.y * 0.25_fix);
     }
 
     // logDebug("Squad rally location: %d, %d", baseCentreLocation.x , baseCentreLocation.y );
@@ -1539,16 +1542,14 @@ Coord QuantBot::findSquadRetreatLocation() {
     Coord newSquadRetreatLocation = Coord::Invalid();
 
     FixPoint closestDistance = FixPt_MAX;
-    for (const StructureBase* pStructure : getStructureList()) {
-        // if it is our building, check to see if it is closer to the squad rally point then we are
-        if (pStructure->getOwner()->getHouseID() == getHouse()->getHouseID()) {
-            Coord closestStructurePoint = pStructure->getClosestPoint(squadRallyLocation);
-            FixPoint structureDistance  = blockDistance(squadRallyLocation, closestStructurePoint);
-
-            if (structureDistance < closestDistance) {
-                closestDistance         = structureDistance;
-                newSquadRetreatLocation = closestStructurePoint;
-            }
+    for (const StructureBase* pStructure : getOwnStructureList()) {
+        // check to see if it is closer to the squad rally point then we are
+        Coord closestStructurePoint = pStructure->getClosestPoint(squadRallyLocation);
+        FixPoint structureDistance  = blockDistance(squadRallyLocation, closestStructurePoint);
+
+        if (structureDistance < closestDistance) {
+            closestDistance         = structureDistance;
+            newSquadRetreatLocation = closestStructurePoint;
         }
     }
 
@@ -1556,66 +1557,25 @@ Coord QuantBot::findSquadRetreatLocation() {
 }
 
 Coord QuantBot::findBaseCentre(HOUSETYPE houseID) {
-    int buildingCount = 0;
-    int totalX        = 0;
-    int totalY        = 0;
-
-    for (const StructureBase* pCurrentStructure : getStructureList()) {
-        if (pCurrentStructure->getOwner()->getHouseID() == houseID && pCurrentStructure->getStructureSizeX() != 1) {
-            // Lets find the center of mass of our squad
-            buildingCount++;
-            totalX += pCurrentStructure->getX();
-            totalY += pCurrentStructure->getY();
-        }
-    }
+    const auto* pHouse = getHouse(houseID);
+    if (!pHouse)
+        return Coord::Invalid();
 
-    Coord baseCentreLocation = Coord::Invalid();
-
-    if (buildingCount > 0) {
-        baseCentreLocation.x = totalX / buildingCount;
-        baseCentreLocation.y = totalY / buildingCount;
-    }
-
-    return baseCentreLocation;
+    return pHouse->getInfluence().getBaseStructures().getCentre();
 }
 
 Coord QuantBot::findSquadCenter(HOUSETYPE houseID) const {
-    int squadSize = 0;
-
-    int totalX = 0;
-    int totalY = 0;
-
-    for (const auto* pCurrentUnit : getUnitList()) {
-        if (pCurrentUnit->getOwner()->getHouseID() == houseID && pCurrentUnit->getItemID() != Unit_Carryall
-            && pCurrentUnit->getItemID() != Unit_Harvester && pCurrentUnit->getItemID() != Unit_Frigate
-            && pCurrentUnit->getItemID() != Unit_MCV
-
-            // Stop freeman making tanks roll forward
-            && !(context_.game.techLevel > 6 && pCurrentUnit->getItemID() == Unit_Trooper)
-            && pCurrentUnit->getItemID() != Unit_Saboteur && pCurrentUnit->getItemID() != Unit_Sandworm
-
-            // Don't let troops moving to rally point contribute
-            /*
-            && pCurrentUnit->getAttackMode() != RETREAT
-            && pCurrentUnit->getDestination().x != squadRallyLocation.x
-            && pCurrentUnit->getDestination().y != squadRallyLocation.y*/
-        ) {
-
-            // Lets find the center of mass of our squad
-            squadSize++;
-            totalX += pCurrentUnit->getX();
-            totalY += pCurrentUnit->getY();
-        }
-    }
+    const auto* pHouse = context_.game.getHouse(houseID);
+    if (!pHouse)
+        return Coord::Invalid();
 
-    Coord squadCenterLocation = Coord::Invalid();
+    auto squad = pHouse->getInfluence().getSquad();
 
-    if (squadSize > 0) {
-        squadCenterLocation.x = totalX / squadSize;
-        squadCenterLocation.y = totalY / squadSize;
-    }
+    // Stop freeman making tanks roll forward
+    if (context_.game.techLevel <= 6)
+        squad += pHouse->getInfluence().getTroopers();
 
-    return squadCenterLocation;
+    return squad.getCentre();
 }
 
 /**
@@ -1636,10 +1596,10 @@ void QuantBot::retreatAllUnits() {
 
     // If no base exists yet, there is no retreat location
     if (squadRallyLocation.isValid() && squadRetreatLocation.isValid()) {
-        for (const auto* pUnit : getUnitList()) {
-            if (pUnit->getOwner() == getHouse() && pUnit->getItemID() != Unit_Carryall
-                && pUnit->getItemID() != Unit_Sandworm && pUnit->getItemID() != Unit_Harvester
-                && pUnit->getItemID() != Unit_MCV && pUnit->getItemID() != Unit_Frigate) {
+        for (const auto* pUnit : getOwnUnitList()) {
+            if (pUnit->getItemID() != Unit_Carryall && pUnit->getItemID() != Unit_Sandworm
+                && pUnit->getItemID() != Unit_Harvester && pUnit->getItemID() != Unit_MCV
+                && pUnit->getItemID() != Unit_Frigate) {
 
                 doSetAttackMode(pUnit, RETREAT);
             }
@@ -1656,11 +1616,11 @@ void QuantBot::retreatAllUnits() {
     battle field these units should always have other supporting units to work with
 
 */
-void QuantBot::checkAllUnits() {
+void QuantBot::checkAllUnits(int slice) {
     const Coord squadCenterLocation = findSquadCenter(getHouse()->getHouseID());
 
-    for (const auto* pUnit : getUnitList()) {
-        if (pUnit->getOwner() != getHouse())
+    for (const auto* pUnit : getOwnUnitList()) {
+        if (!isInUpdateSlice(pUnit, slice, AIUPDATEINTERVAL))
             continue;
 
         switch (pUnit->getItemID()) {
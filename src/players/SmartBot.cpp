@@ -24,6 +24,7 @@
 #include <Map.h>
 #include <sand.h>
 
+#include <players/DefenderSelection.h>
 #include <structures/BuilderBase.h>
 #include <structures/ConstructionYard.h>
 #include <structures/StarPort.h>
@@ -35,6 +36,8 @@
 #include <string>
 
 inline constexpr auto AIUPDATEINTERVAL = 50;
+inline constexpr auto AIBUILDSLICE     = 0;                    ///< the cycle of the update interval to build in
+inline constexpr auto AIATTACKSLICE    = AIUPDATEINTERVAL / 2; ///< the cycle of the update interval to attack in
 inline constexpr auto REFINERYLIMIT    = 10;
 
 SmartBot::SmartBot(const GameContext& context, House* associatedHouse, const std::string& playername,
@@ -85,23 +88,26 @@ void SmartBot::save(OutputStream& stream) const {
 }
 
 void SmartBot::update() {
-    if ((getGameCycleCount() + static_cast<int>(getHouse()->getHouseID())) % AIUPDATEINTERVAL != 0) {
-        // we are not updating this AI player this cycle
-        return;
-    }
+    // The units are checked a few at a time every cycle. Building and attacking happen once per interval but in
+    // different cycles
+    const auto slice = getUpdateSlice(AIUPDATEINTERVAL);
 
-    checkAllUnits();
+    checkAllUnits(slice);
 
-    if (buildTimer <= 0) {
-        build(context_);
-    } else {
-        buildTimer -= AIUPDATEINTERVAL;
+    if (slice == AIBUILDSLICE) {
+        if (buildTimer <= 0) {
+            build(context_);
+        } else {
+            buildTimer -= AIUPDATEINTERVAL;
+        }
     }
 
-    if (attackTimer <= 0) {
-        attack();
-    } else {
-        attackTimer -= AIUPDATEINTERVAL;
+    if (slice == AIATTACKSLICE) {
+        if (attackTimer <= 0) {
+            attack();
+        } else {
+            attackTimer -= AIUPDATEINTERVAL;
+        }
     }
 }
 
@@ -143,32 +149,20 @@ void SmartBot::onDamage(const ObjectBase* pObject, [[maybe_unused]] int damage,
 }
 
 void SmartBot::scrambleUnitsAndDefend(const ObjectBase* pIntruder) {
-    for (const UnitBase* pUnit : getUnitList()) {
-        if (pUnit->isRespondable() && (pUnit->getOwner() == getHouse())) {
-
-            if ((pUnit->getAttackMode() != HUNT) && !pUnit->hasATarget()) {
-                const ItemID_enum itemID = pUnit->getItemID();
-                if ((itemID != Unit_Harvester) && (pUnit->getItemID() != Unit_MCV)
-                    && (pUnit->getItemID() != Unit_Carryall) && (pUnit->getItemID() != Unit_Frigate)
-                    && (pUnit->getItemID() != Unit_Saboteur) && (pUnit->getItemID() != Unit_Sandworm)) {
-
-                    if (pUnit->getItemID() == Unit_Launcher) {
-                        doAttackObject(pUnit, pIntruder, true);
-                    } else {
-                        doMove2Pos(pUnit, pIntruder->getLocation().x, pIntruder->getLocation().y, false);
+    dune::ai::scrambleFreeDefenders(getOwnUnitList(), [&](const UnitBase* pUnit) {
+        if (pUnit->getItemID() == Unit_Launcher) {
+            doAttackObject(pUnit, pIntruder, true);
+        } else {
+            doMove2Pos(pUnit, pIntruder->getLocation().x, pIntruder->getLocation().y, false);
 
-                        if (getGameInitSettings().getGameOptions().manualCarryallDrops && pUnit->isAGroundUnit()
-                            && pUnit->isVisible()
-                            && (blockDistance(pUnit->getLocation(), pUnit->getDestination()) >= 10)
-                            && (pUnit->getHealth() / pUnit->getMaxHealth() > BADLYDAMAGEDRATIO)) {
+            if (getGameInitSettings().getGameOptions().manualCarryallDrops && pUnit->isAGroundUnit()
+                && pUnit->isVisible() && (blockDistance(pUnit->getLocation(), pUnit->getDestination()) >= 10)
+                && (pUnit->getHealth() / pUnit->getMaxHealth() > BADLYDAMAGEDRATIO)) {
 
-                            doRequestCarryallDrop(static_cast<const GroundUnit*>(pUnit));
-                        }
-                    }
-                }
+                doRequestCarryallDrop(static_cast<const GroundUnit*>(pUnit));
             }
         }
-    }
+    });
 }
 
 Coord SmartBot::findPlaceLocation(ItemID_enum itemID) {
@@ -187,17 +181,15 @@ Coord SmartBot::findPlaceLocation(ItemID_enum itemID) {
         maxX = getMap().getSizeX() - 1;
         maxY = getMap().getSizeY() - 1;
     } else {
-        for (const StructureBase* pStructure : getStructureList()) {
-            if (pStructure->getOwner() == getHouse()) {
-                if (pStructure->getX() < minX)
-                    minX = pStructure->getX();
-                if (pStructure->getX() > maxX)
-                    maxX = pStructure->getX();
-                if (pStructure->getY() < minY)
-                    minY = pStructure->getY();
-                if (pStructure->getY() > maxY)
-                    maxY = pStructure->getY();
-            }
+        for (const StructureBase* pStructure : getOwnStructureList()) {
+            if (pStructure->getX() < minX)
+                minX = pStructure->getX();
+            if (pStructure->getX() > maxX)
+                maxX = pStructure->getX();
+            if (pStructure->getY() < minY)
+                minY = pStructure->getY();
+            if (pStructure->getY() > maxY)
+                maxY = pStructure->getY();
         }
     }
 
@@ -241,7 +233,7 @@ Coord SmartBot::findPlaceLocation(ItemID_enum itemID) {
                 case Structure_Refinery: {
                     // place near spice
                     Coord spicePos;
-                    if (getMap().findSpice(spicePos, pos)) {
+                    if (getMap().findSpice(spicePos, pos, getRandomGen())) {
                         rating = 10'000'000 - blockDistance(pos, spicePos);
                     } else {
                         rating = 10'000'000;
@@ -251,12 +243,10 @@ Coord SmartBot::findPlaceLocation(ItemID_enum itemID) {
                 case Structure_ConstructionYard: {
                     FixPoint nearestUnit = 10'000'000;
 
-                    for (const auto* pUnit : getUnitList()) {
-                        if (pUnit->getOwner() == getHouse()) {
-                            FixPoint tmp = blockDistance(pos, pUnit->getLocation());
-                            if (tmp < nearestUnit) {
-                                nearestUnit = tmp;
-                            }
+                    for (const auto* pUnit : getOwnUnitList()) {
+                        FixPoint tmp = blockDistance(pos, pUnit->getLocation());
+                        if (tmp < nearestUnit) {
+                            nearestUnit = tmp;
                         }
                     }
 
@@ -369,10 +359,7 @@ void SmartBot::build([[maybe_unused]] const GameContext& context) {
     // Lets count what we are building
     int buildQueue[ItemID_LastID] = {};
 
-    for (const auto* pStructure : getStructureList()) {
-        if (pStructure->getOwner() != getHouse())
-            continue;
-
+    for (const auto* pStructure : getOwnStructureList()) {
         if (const auto* pBuilder = dune_cast<BuilderBase>(pStructure)) {
             if (pBuilder->getBuildListSize() > 0) {
                 ++buildQueue[pBuilder->getCurrentProducedItem()];
@@ -380,10 +367,7 @@ void SmartBot::build([[maybe_unused]] const GameContext& context) {
         }
     }
 
-    for (const auto* pStructure : getStructureList()) {
-        if (pStructure->getOwner() != getHouse())
-            continue;
-
+    for (const auto* pStructure : getOwnStructureList()) {
         if (!pStructure->isRepairing() && pStructure->getHealth() < pStructure->getMaxHealth()) {
             doRepair(pStructure);
         }
@@ -778,8 +762,8 @@ void SmartBot::attack() {
         return;
     }
 
-    for (const auto* pUnit : getUnitList()) {
-        if (pUnit->isRespondable() && (pUnit->getOwner() == getHouse()) && pUnit->isActive()
+    for (const auto* pUnit : getOwnUnitList()) {
+        if (pUnit->isRespondable() && pUnit->isActive()
             && (pUnit->getAttackMode() == AREAGUARD || pUnit->getAttackMode() == GUARD
                 || pUnit->getAttackMode() == AMBUSH)
             && pUnit->getItemID() != Unit_Harvester && pUnit->getItemID() != Unit_MCV
@@ -794,25 +778,20 @@ void SmartBot::attack() {
     attackTimer = getRandomGen().rand(10000, 20000);
 }
 
-void SmartBot::checkAllUnits() {
-    for (const UnitBase* pUnit : getUnitList()) {
-        if (pUnit->getItemID() == Unit_Sandworm) {
-            for (const UnitBase* pUnit2 : getUnitList()) {
-                if (pUnit2->getOwner() == getHouse() && pUnit2->getItemID() == Unit_Harvester) {
-                    const auto* pHarvester = static_cast<const Harvester*>(pUnit2);
-                    if (getMap().tileExists(pHarvester->getLocation())
-                        && !getMap().getTile(pHarvester->getLocation())->isRock()
-                        && blockDistance(pUnit->getLocation(), pHarvester->getLocation()) <= 5) {
-                        doReturn(pHarvester);
-                        scrambleUnitsAndDefend(pUnit);
-                    }
-                }
-            }
+void SmartBot::checkAllUnits(int slice) {
+    for (const auto& [pSandworm, pHarvester] : getHouse()->getSandwormContacts()) {
+        if (!isInUpdateSlice(pSandworm, slice, AIUPDATEINTERVAL))
+            continue;
+
+        if (getMap().tileExists(pHarvester->getLocation()) && !getMap().getTile(pHarvester->getLocation())->isRock()) {
+            doReturn(static_cast<const Harvester*>(pHarvester));
+            scrambleUnitsAndDefend(pSandworm);
         }
+    }
 
-        if (pUnit->getOwner() != getHouse()) {
+    for (const UnitBase* pUnit : getOwnUnitList()) {
+        if (!isInUpdateSlice(pUnit, slice, AIUPDATEINTERVAL))
             continue;
-        }
 
         switch (pUnit->getItemID()) {
             case Unit_MCV: {
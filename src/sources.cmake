@@ -1,15 +1,18 @@
 add_sources(TOP_SOURCES
+	AITournament.cpp
 	AStarSearch.cpp
 	Bullet.cpp
 	Choam.cpp
 	Command.cpp
 	CommandManager.cpp
 	Explosion.cpp
+	FogMask.cpp
 	Game.cpp
 	GameInitSettings.cpp
 	GameInterface.cpp
 	globals.cpp
 	House.cpp
+	HouseInfluence.cpp
 	Map.cpp
 	MapSeed.cpp
 	mmath.cpp
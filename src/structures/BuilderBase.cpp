@@ -398,6 +398,19 @@ void BuilderBase::updateBuildList() {
     }
 }
 
+bool BuilderBase::dependsOnStructure(ItemID_enum structureID) const {
+    const auto* const game = dune::globals::currentGame.get();
+
+    for (int i = 0; itemOrder[i] != ItemID_Invalid; i++) {
+        const auto& objData = game->objectData.data[itemOrder[i]][static_cast<int>(originalHouseID_)];
+
+        if (objData.builder == itemID_ && objData.prerequisiteStructuresSet[structureID])
+            return true;
+    }
+
+    return false;
+}
+
 void BuilderBase::setWaitingToPlace() {
     if (currentProducedItem_ == ItemID_Invalid)
         return;
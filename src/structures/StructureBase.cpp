@@ -67,6 +67,7 @@ void StructureBase::init() {
     animationCounter                                                 = 0;
 
     dune::globals::structureList.push_back(this);
+    owner_->addToStructureList(this);
 }
 
 StructureBase::~StructureBase() = default;
@@ -75,6 +76,7 @@ void StructureBase::cleanup(const GameContext& context, HumanPlayer* humanPlayer
     try {
         context.map.removeObjectFromMap(getObjectID()); // no map point will reference now
         dune::globals::structureList.remove(this);
+        owner_->removeFromStructureList(this);
         owner_->decrementStructures(itemID_, location_);
     } catch (std::exception& e) {
         sdl2::log_info("StructureBase::cleanup(): %s", e.what());
@@ -154,7 +154,7 @@ void AirUnit::move(const GameContext& context) {
     if (newLocation != location_) {
         unassignFromMap(location_);
         assignToMap(context, newLocation);
-        location_ = newLocation;
+        updateLocation(newLocation);
     }
 
     checkPos(context);
@@ -281,12 +281,12 @@ void Harvester::destroy(const GameContext& context) {
 
             /* now we can spread spice */
             map.for_each(xpos - circleRadius, ypos - circleRadius, xpos + circleRadius, ypos + circleRadius,
-                         [xpos, ypos, circleRadius, availableSandPos, spiceSpread](auto& tile) {
+                         [&context, xpos, ypos, circleRadius, availableSandPos, spiceSpread](auto& tile) {
                              if (distanceFrom({xpos, ypos}, tile.location_) + 0.0005_fix > circleRadius)
                                  return;
 
                              if (tile.isSand() || tile.isSpice())
-                                 tile.setSpice(tile.getSpice() + spiceSpread / availableSandPos);
+                                 tile.setSpice(context, tile.getSpice() + spiceSpread / availableSandPos);
                          });
         }
 
@@ -317,7 +317,6 @@ void InfantryBase::checkPos(const GameContext& context) {
                 // steal credits
                 pOwner->takeCredits(capturedSpice);
                 owner_->addCredits(capturedSpice, false);
-                owner_->updateBuildLists();
 
             } else {
                 const int damage = lround(std::min(pCapturedStructure->getHealth() / 2, getHealth() * 2));
@@ -412,7 +411,7 @@ void InfantryBase::move(const GameContext& context) {
                 // let something else go in
                 unassignFromMap(location_);
                 oldLocation_ = location_;
-                location_    = nextSpot;
+                updateLocation(nextSpot);
 
                 context.map.viewMap(owner_->getHouseID(), location_, getViewRange());
             }
@@ -102,6 +102,7 @@ void UnitBase::init() {
     drawnFrame = 0;
 
     dune::globals::unitList.push_back(this);
+    owner_->addToUnitList(this);
 }
 
 UnitBase::~UnitBase() = default;
@@ -115,6 +116,7 @@ void UnitBase::cleanup(const GameContext& context, HumanPlayer* humanPlayer) {
         game.getHouse(originalHouseID_)->decrementUnits(itemID_);
 
         dune::globals::unitList.remove(this);
+        owner_->removeFromUnitList(this);
     } catch (std::exception& e) {
         sdl2::log_info("UnitBase::cleanup(): %s", e.what());
     }
@@ -331,7 +333,7 @@ void UnitBase::destroy(const GameContext& context) {
 
             if (owner_->getHouseID() != originalHouseID_) {
                 // deviation is inherited
-                pNewUnit->owner_   = owner_;
+                pNewUnit->changeOwner(owner_);
                 pNewUnit->graphic_ = dune::globals::pGFXManager->getObjPic(pNewUnit->graphicID_, owner_->getHouseID());
                 pNewUnit->deviationTimer = deviationTimer;
             }
@@ -351,7 +353,7 @@ void UnitBase::deviate(const GameContext& context, House* newOwner) {
         setDestination(location_);
         clearPath();
         doSetAttackMode(context, GUARD);
-        owner_ = newOwner;
+        changeOwner(newOwner);
 
         graphic_ = dune::globals::pGFXManager->getObjPic(graphicID_, getOwner()->getHouseID());
 
@@ -572,7 +574,7 @@ void UnitBase::move(const GameContext& context) {
                 // let something else go in
                 unassignFromMap(location_);
                 oldLocation_ = location_;
-                location_    = nextSpot;
+                updateLocation(nextSpot);
 
                 if (!isAFlyingUnit() && itemID_ != Unit_Sandworm) {
                     context.map.viewMap(owner_->getHouseID(), location_, getViewRange());
@@ -1380,6 +1382,15 @@ void UnitBase::turnLeft(const GameContext& context) {
     drawnAngle_ = normalizeAngle(static_cast<ANGLETYPE>(lround(angle_)));
 }
 
+void UnitBase::changeOwner(House* newOwner) {
+    if (newOwner == owner_)
+        return;
+
+    owner_->removeFromUnitList(this);
+    owner_ = newOwner;
+    owner_->addToUnitList(this);
+}
+
 void UnitBase::turnRight(const GameContext& context) {
     angle_ -= context.game.objectData.data[itemID_][static_cast<int>(originalHouseID_)].turnspeed;
     if (angle_ <= -0.5_fix) {
@@ -1394,7 +1405,7 @@ void UnitBase::quitDeviation(const GameContext& context) {
         setTarget(nullptr);
         setGuardPoint(location_);
         setDestination(location_);
-        owner_         = context.game.getHouse(originalHouseID_);
+        changeOwner(context.game.getHouse(originalHouseID_));
         graphic_       = dune::globals::pGFXManager->getObjPic(graphicID_, getOwner()->getHouseID());
         deviationTimer = INVALID;
     }
@@ -0,0 +1,359 @@
+#include "FileClasses/Decode.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// The decoders as they were before the bounds checked versions replaced them. They trust their input, so they are
+// only fed well-formed data.
+void reference_memcpy_overlap(unsigned char* dst, const unsigned char* src, unsigned cnt) {
+    if (dst + cnt < src || src + cnt < dst) {
+        memcpy(dst, src, cnt);
+        return;
+    }
+    while (cnt--) {
+        *dst = *src;
+        dst++;
+        src++;
+    }
+}
+
+uint16_t read_le_uint16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8u));
+}
+
+int reference_decode40(const unsigned char* image_in, unsigned char* image_out) {
+    const unsigned char* readp = image_in;
+    unsigned char* writep      = image_out;
+    uint16_t count             = 0;
+    while (true) {
+        uint16_t code = *readp++;
+        if (~code & 0x80) {
+            if (!code) {
+                count = *readp++;
+                code  = *readp++;
+                while (count--)
+                    *writep++ ^= code;
+            } else {
+                count = code;
+                while (count--)
+                    *writep++ ^= *readp++;
+            }
+        } else {
+            count = code & 0x7f;
+            if (!count) {
+                count = read_le_uint16(readp);
+                readp += 2;
+                code = count >> 8;
+                if (~code & 0x80) {
+                    if (!count) {
+                        break;
+                    }
+                    writep += count;
+                } else {
+                    count &= 0x3fff;
+                    if (~code & 0x40) {
+                        while (count--) {
+                            *writep++ ^= *readp++;
+                        }
+                    } else {
+                        code = *readp++;
+                        while (count--) {
+                            *writep++ ^= code;
+                        }
+                    }
+                }
+            } else {
+                writep += count;
+            }
+        }
+    }
+    return static_cast<int>(writep - image_out);
+}
+
+int reference_decode80(const unsigned char* image_in, unsigned char* image_out, unsigned checksum) {
+    const unsigned char* readp = image_in;
+    unsigned char* writep      = image_out;
+    unsigned int total         = 0;
+
+    while (true) {
+        if ((*readp & 0xc0) == 0x80) {
+            const unsigned count = readp[0] & 0x3f;
+            total += count;
+            if (!count) {
+                break;
+            }
+            readp++;
+            reference_memcpy_overlap(writep, readp, count);
+            readp += count;
+            writep += count;
+        } else if ((*readp & 0x80) == 0x00) {
+            const unsigned count = ((readp[0] & 0x70) >> 4) + 3;
+            const unsigned short relpos =
+                static_cast<unsigned short>(readp[0] & 0xf) << 8 | static_cast<unsigned short>(readp[1]);
+            readp += 2;
+            total += count;
+            reference_memcpy_overlap(writep, writep - relpos, count);
+            writep += count;
+        } else if (*readp == 0xff) {
+            const unsigned short count = read_le_uint16(readp + 1);
+            const unsigned short pos   = read_le_uint16(readp + 3);
+            readp += 5;
+            total += count;
+            reference_memcpy_overlap(writep, image_out + pos, count);
+            writep += count;
+        } else if (*readp == 0xfe) {
+            const unsigned short count = read_le_uint16(readp + 1);
+            const unsigned char color  = readp[3];
+            readp += 4;
+            memset(writep, color, count);
+            writep += count;
+            total += count;
+        } else {
+            const unsigned short count = (*readp & 0x3f) + 3;
+            const unsigned short pos   = read_le_uint16(readp + 1);
+            readp += 3;
+            total += count;
+            reference_memcpy_overlap(writep, image_out + pos, count);
+            writep += count;
+        }
+    }
+    if (total != checksum)
+        return -1;
+
+    return 0;
+}
+
+int random_int(std::mt19937& rng, int min, int max) {
+    return std::uniform_int_distribution<int>{min, max}(rng);
+}
+
+void push_le_uint16(std::vector<unsigned char>& data, int value) {
+    data.push_back(static_cast<unsigned char>(value & 0xff));
+    data.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+std::vector<unsigned char> random_bytes(std::mt19937& rng, size_t size) {
+    std::vector<unsigned char> data(size);
+    std::ranges::generate(data, [&] { return static_cast<unsigned char>(random_int(rng, 0, 255)); });
+    return data;
+}
+
+/// Generates well-formed format80 data that fills up to size bytes. Returns the data and the checksum.
+std::pair<std::vector<unsigned char>, unsigned> random_format80(std::mt19937& rng, int size) {
+    std::vector<unsigned char> data;
+    auto written = 0;
+
+    while (size - written >= 3 && random_int(rng, 0, 50) != 0) {
+        const auto left = size - written;
+        auto count      = 0;
+
+        switch (random_int(rng, 0, 4)) {
+            case 0: { // 10cccccc: literal
+                count = random_int(rng, 1, std::min(63, left));
+                data.push_back(static_cast<unsigned char>(0x80 | count));
+                for (auto i = 0; i < count; ++i)
+                    data.push_back(static_cast<unsigned char>(random_int(rng, 0, 255)));
+            } break;
+
+            case 1: { // 0cccpppp p: relative copy
+                count             = random_int(rng, 3, std::min(10, left));
+                const auto relpos = random_int(rng, 0, std::min(0xfff, written));
+                data.push_back(static_cast<unsigned char>(((count - 3) << 4) | (relpos >> 8)));
+                data.push_back(static_cast<unsigned char>(relpos & 0xff));
+            } break;
+
+            case 2: { // 11cccccc p p: short absolute copy
+                count          = random_int(rng, 3, std::min(64, left));
+                const auto pos = random_int(rng, 0, std::min(0xffff, size - count));
+                data.push_back(static_cast<unsigned char>(0xc0 | (count - 3)));
+                push_le_uint16(data, pos);
+            } break;
+
+            case 3: { // 11111110 c c v: fill
+                count = random_int(rng, 0, std::min(1000, left));
+                data.push_back(0xfe);
+                push_le_uint16(data, count);
+                data.push_back(static_cast<unsigned char>(random_int(rng, 0, 255)));
+            } break;
+
+            default: { // 11111111 c c p p: long absolute copy
+                count          = random_int(rng, 0, std::min(1000, left));
+                const auto pos = random_int(rng, 0, std::min(0xffff, size - count));
+                data.push_back(0xff);
+                push_le_uint16(data, count);
+                push_le_uint16(data, pos);
+            } break;
+        }
+
+        written += count;
+    }
+
+    data.push_back(0x80);
+
+    return {std::move(data), static_cast<unsigned>(written)};
+}
+
+/// Generates well-formed format40 data for a frame of size bytes
+std::vector<unsigned char> random_format40(std::mt19937& rng, int size) {
+    std::vector<unsigned char> data;
+    auto written = 0;
+
+    while (written < size && random_int(rng, 0, 50) != 0) {
+        const auto left = size - written;
+        auto count      = 0;
+
+        switch (random_int(rng, 0, 5)) {
+            case 0: { // 00000000 c v: fill
+                count = random_int(rng, 0, std::min(255, left));
+                data.push_back(0);
+                data.push_back(static_cast<unsigned char>(count));
+                data.push_back(static_cast<unsigned char>(random_int(rng, 0, 255)));
+            } break;
+
+            case 1: { // 0ccccccc: copy
+                count = random_int(rng, 1, std::min(127, left));
+                data.push_back(static_cast<unsigned char>(count));
+                for (auto i = 0; i < count; ++i)
+                    data.push_back(static_cast<unsigned char>(random_int(rng, 0, 255)));
+            } break;
+
+            case 2: { // 10000000 c 0ccccccc: skip
+                count = random_int(rng, 1, std::min(0x7fff, left));
+                data.push_back(0x80);
+                push_le_uint16(data, count);
+            } break;
+
+            case 3: { // 10000000 c 10cccccc: copy
+                count = random_int(rng, 0, std::min(0x3fff, left));
+                data.push_back(0x80);
+                push_le_uint16(data, 0x8000 | count);
+                for (auto i = 0; i < count; ++i)
+                    data.push_back(static_cast<unsigned char>(random_int(rng, 0, 255)));
+            } break;
+
+            case 4: { // 10000000 c 11cccccc v: fill
+                count = random_int(rng, 0, std::min(0x3fff, left));
+                data.push_back(0x80);
+                push_le_uint16(data, 0xc000 | count);
+                data.push_back(static_cast<unsigned char>(random_int(rng, 0, 255)));
+            } break;
+
+            default: { // 1ccccccc: skip
+                count = random_int(rng, 1, std::min(127, left));
+                data.push_back(static_cast<unsigned char>(0x80 | count));
+            } break;
+        }
+
+        written += count;
+    }
+
+    data.push_back(0x80);
+    push_le_uint16(data, 0);
+
+    return data;
+}
+
+} // namespace
+
+TEST(decode, decode80_matches_reference) {
+    std::mt19937 rng{80};
+
+    for (auto i = 0; i < 2000; ++i) {
+        const auto size             = random_int(rng, 1, 20000);
+        const auto [data, checksum] = random_format80(rng, size);
+        const auto initial          = random_bytes(rng, size);
+        auto expected               = initial;
+        auto actual                 = initial;
+
+        ASSERT_EQ(reference_decode80(data.data(), expected.data(), checksum), 0);
+        ASSERT_EQ(decode80(data, actual, checksum), 0);
+        ASSERT_EQ(expected, actual) << "iteration " << i;
+
+        ASSERT_EQ(decode80(data, actual, checksum + 1), -1);
+    }
+}
+
+TEST(decode, decode40_matches_reference) {
+    std::mt19937 rng{40};
+
+    for (auto i = 0; i < 2000; ++i) {
+        const auto size    = random_int(rng, 1, 20000);
+        const auto data    = random_format40(rng, size);
+        const auto initial = random_bytes(rng, size);
+        auto expected      = initial;
+        auto actual        = initial;
+
+        const auto expected_written = reference_decode40(data.data(), expected.data());
+        ASSERT_EQ(decode40(data, actual), expected_written);
+        ASSERT_EQ(expected, actual) << "iteration " << i;
+    }
+}
+
+TEST(decode, decode80_rejects_overruns) {
+    std::vector<unsigned char> out(16);
+
+    // Literal of 20 bytes into 16 bytes
+    std::vector<unsigned char> literal(1 + 20, 0x11);
+    literal[0] = 0x80 | 20;
+    literal.push_back(0x80);
+    EXPECT_THROW(decode80(literal, out, 0), std::invalid_argument);
+
+    // Relative copy from before the start of the output
+    const std::vector<unsigned char> before{0x00, 0x05, 0x80};
+    EXPECT_THROW(decode80(before, out, 0), std::invalid_argument);
+
+    // Absolute copy from after the end of the output
+    const std::vector<unsigned char> after{0xff, 0x04, 0x00, 0x0e, 0x00, 0x80};
+    EXPECT_THROW(decode80(after, out, 0), std::invalid_argument);
+
+    // Missing end marker
+    const std::vector<unsigned char> truncated{0xfe, 0x04, 0x00, 0x22};
+    EXPECT_THROW(decode80(truncated, out, 0), std::invalid_argument);
+}
+
+TEST(decode, decode40_rejects_overruns) {
+    std::vector<unsigned char> out(16);
+
+    // Skip past the end of the frame
+    const std::vector<unsigned char> skip{0x80 | 20, 0x80, 0x00, 0x00};
+    EXPECT_THROW(decode40(skip, out), std::invalid_argument);
+
+    // Copy with less input than announced
+    const std::vector<unsigned char> copy{0x08, 0x01, 0x02};
+    EXPECT_THROW(decode40(copy, out), std::invalid_argument);
+}
+
+TEST(decode, fuzz_malformed_data) {
+    std::mt19937 rng{4080};
+
+    for (auto i = 0; i < 20000; ++i) {
+        const auto size = random_int(rng, 1, 4000);
+
+        // Either completely random data or well-formed data with a few corrupted bytes
+        auto data = random_bytes(rng, random_int(rng, 0, 2000));
+        if (i % 2) {
+            data = i % 4 == 1 ? random_format80(rng, size).first : random_format40(rng, size);
+            for (auto j = random_int(rng, 1, 4); j > 0 && !data.empty(); --j)
+                data[random_int(rng, 0, static_cast<int>(data.size()) - 1)] = static_cast<unsigned char>(rng());
+        }
+
+        std::vector<unsigned char> out(size);
+
+        try {
+            decode80(data, out, 0);
+        } catch (const std::invalid_argument&) { }
+
+        try {
+            EXPECT_LE(decode40(data, out), size);
+        } catch (const std::invalid_argument&) { }
+    }
+}
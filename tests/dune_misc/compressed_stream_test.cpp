@@ -0,0 +1,187 @@
+#include "misc/ICompressedStream.h"
+#include "misc/IMemoryStream.h"
+#include "misc/OCompressedStream.h"
+#include "misc/OMemoryStream.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+// Something resembling a savegame: a header, a string, a large tile array and some noise
+void write_savegame(OutputStream& stream) {
+    stream.writeUint32(8675309);
+    stream.writeUint32(9704);
+    stream.writeString("Dune Legacy");
+
+    for (auto i = 0; i < 128 * 128; ++i) {
+        stream.writeUint32(i % 7);
+        stream.writeUint8(static_cast<uint8_t>(i / 128));
+        stream.writeBool(i % 3 == 0);
+    }
+
+    std::mt19937 generator{42};
+    for (auto i = 0; i < 10000; ++i)
+        stream.writeUint64(generator());
+
+    stream.writeFloat(1.5f);
+    stream.writeString("end");
+}
+
+std::vector<uint8_t> uncompressed_savegame() {
+    OMemoryStream stream;
+    stream.open();
+    write_savegame(stream);
+
+    return stream.release();
+}
+
+std::vector<uint8_t> compressed_savegame() {
+    OMemoryStream stream;
+    stream.open();
+
+    OCompressedStream compressed{stream, 2 * sizeof(uint32_t)};
+    write_savegame(compressed);
+    compressed.finish();
+
+    return stream.release();
+}
+
+std::vector<uint8_t> read_all(InputStream& stream, size_t length) {
+    std::vector<uint8_t> data(length);
+    stream.readBytes(data);
+
+    return data;
+}
+
+} // namespace
+
+TEST(compressed_stream, round_trip) {
+    const auto original   = uncompressed_savegame();
+    const auto compressed = compressed_savegame();
+
+    EXPECT_LT(compressed.size(), original.size() / 2);
+
+    IMemoryStream memory{reinterpret_cast<const char*>(compressed.data()), compressed.size()};
+
+    // The header is readable without decompressing
+    EXPECT_EQ(memory.readUint32(), 8675309u);
+    EXPECT_EQ(memory.readUint32(), 9704u);
+
+    ICompressedStream stream{memory};
+    EXPECT_TRUE(stream.isCompressed());
+
+    const std::vector<uint8_t> body(original.begin() + 2 * sizeof(uint32_t), original.end());
+    EXPECT_EQ(read_all(stream, body.size()), body);
+
+    EXPECT_THROW(stream.readUint8(), InputStream::eof);
+}
+
+TEST(compressed_stream, reads_typed_values) {
+    const auto compressed = compressed_savegame();
+
+    IMemoryStream memory{reinterpret_cast<const char*>(compressed.data()), compressed.size()};
+    memory.readUint32();
+    memory.readUint32();
+
+    ICompressedStream stream{memory};
+
+    EXPECT_EQ(stream.readString(), "Dune Legacy");
+
+    for (auto i = 0; i < 128 * 128; ++i) {
+        ASSERT_EQ(stream.readUint32(), static_cast<uint32_t>(i % 7));
+        ASSERT_EQ(stream.readUint8(), static_cast<uint8_t>(i / 128));
+        ASSERT_EQ(stream.readBool(), i % 3 == 0);
+    }
+
+    std::mt19937 generator{42};
+    for (auto i = 0; i < 10000; ++i)
+        ASSERT_EQ(stream.readUint64(), generator());
+
+    EXPECT_EQ(stream.readFloat(), 1.5f);
+    EXPECT_EQ(stream.readString(), "end");
+}
+
+TEST(compressed_stream, uncompressed_data_passes_through) {
+    const auto original = uncompressed_savegame();
+
+    IMemoryStream memory{reinterpret_cast<const char*>(original.data()), original.size()};
+    memory.readUint32();
+    memory.readUint32();
+
+    ICompressedStream stream{memory};
+    EXPECT_FALSE(stream.isCompressed());
+
+    const std::vector<uint8_t> body(original.begin() + 2 * sizeof(uint32_t), original.end());
+    EXPECT_EQ(read_all(stream, body.size()), body);
+}
+
+TEST(compressed_stream, known_uncompressed_data_is_not_probed) {
+    OMemoryStream memory;
+    memory.open();
+    memory.writeUint32(COMPRESSEDSTREAMMAGIC);
+    memory.writeUint32(42);
+
+    IMemoryStream input{reinterpret_cast<const char*>(memory.getData().data()), memory.getDataLength()};
+    ICompressedStream stream{input, false};
+    EXPECT_FALSE(stream.isCompressed());
+
+    EXPECT_EQ(stream.readUint32(), COMPRESSEDSTREAMMAGIC);
+    EXPECT_EQ(stream.readUint32(), 42u);
+}
+
+TEST(compressed_stream, flush_starts_a_new_block) {
+    OMemoryStream memory;
+    memory.open();
+
+    { // Scope
+        OCompressedStream stream{memory};
+
+        for (auto i = 0u; i < 100; ++i) {
+            stream.writeUint32(i);
+            stream.flush();
+        }
+
+        stream.finish();
+    }
+
+    IMemoryStream input{reinterpret_cast<const char*>(memory.getData().data()), memory.getDataLength()};
+    ICompressedStream stream{input};
+
+    for (auto i = 0u; i < 100; ++i)
+        ASSERT_EQ(stream.readUint32(), i);
+
+    EXPECT_THROW(stream.readUint32(), InputStream::eof);
+}
+
+TEST(compressed_stream, truncated_data_throws) {
+    auto compressed = compressed_savegame();
+    compressed.resize(compressed.size() / 2);
+
+    IMemoryStream memory{reinterpret_cast<const char*>(compressed.data()), compressed.size()};
+    memory.readUint32();
+    memory.readUint32();
+
+    ICompressedStream stream{memory};
+
+    EXPECT_THROW(read_all(stream, 1024 * 1024), InputStream::exception);
+}
+
+TEST(compressed_stream, block_larger_than_its_header_throws) {
+    auto compressed = compressed_savegame();
+
+    // Shrink the raw size of the first block (after the savegame header and the compressed stream magic)
+    constexpr auto rawSizeOffset = 3 * sizeof(uint32_t);
+    const uint32_t rawSize       = SDL_SwapLE32(16);
+    memcpy(compressed.data() + rawSizeOffset, &rawSize, sizeof(rawSize));
+
+    IMemoryStream memory{reinterpret_cast<const char*>(compressed.data()), compressed.size()};
+    memory.readUint32();
+    memory.readUint32();
+
+    ICompressedStream stream{memory};
+
+    EXPECT_THROW(stream.readUint32(), InputStream::error);
+}
@@ -0,0 +1,77 @@
+#include "misc/draw_util.h"
+
+#include <Definitions.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <random>
+
+namespace {
+
+sdl2::surface_ptr create_random_surface(int width, int height) {
+    sdl2::surface_ptr surface{SDL_CreateRGBSurfaceWithFormat(0, width, height, 8, SDL_PIXELFORMAT_INDEX8)};
+
+    std::array<SDL_Color, 256> colors{};
+    for (auto i = 0; i < 256; ++i)
+        colors[i] = SDL_Color{static_cast<Uint8>(i), static_cast<Uint8>(255 - i), static_cast<Uint8>(i * 7), 255};
+    SDL_SetPaletteColors(surface->format->palette, colors.data(), 0, 256);
+
+    std::mt19937 rng{144};
+    std::uniform_int_distribution<int> distribution{0, 255};
+
+    auto* const pixels = static_cast<uint8_t*>(surface->pixels);
+    for (auto y = 0; y < height; ++y) {
+        for (auto x = 0; x < width; ++x)
+            pixels[y * surface->pitch + x] = static_cast<uint8_t>(distribution(rng));
+    }
+
+    SDL_SetColorKey(surface.get(), SDL_TRUE, 0);
+
+    return surface;
+}
+
+sdl2::surface_ptr to_rgba(SDL_Surface* surface) {
+    return sdl2::surface_ptr{SDL_ConvertSurfaceFormat(surface, SCREEN_FORMAT, 0)};
+}
+
+bool same_pixels(SDL_Surface* a, SDL_Surface* b) {
+    if (a->w != b->w || a->h != b->h || a->pitch != b->pitch)
+        return false;
+
+    return 0 == memcmp(a->pixels, b->pixels, static_cast<size_t>(a->pitch) * a->h);
+}
+
+} // namespace
+
+TEST(draw_util, color_range_map) {
+    const auto colorMap = createColorRangeMap(144, 160);
+
+    EXPECT_EQ(colorMap[143], 143);
+    EXPECT_EQ(colorMap[144], 160);
+    EXPECT_EQ(colorMap[150], 166);
+    EXPECT_EQ(colorMap[151], 151);
+    EXPECT_EQ(colorMap[160], 160);
+}
+
+TEST(draw_util, palette_color_range_matches_pixel_color_range) {
+    const auto source = create_random_surface(37, 23);
+
+    const auto mapped  = mapSurfaceColorRange(source.get(), 144, 160);
+    const auto palette = mapSurfacePaletteColorRange(source.get(), 144, 160);
+
+    ASSERT_NE(mapped, nullptr);
+    ASSERT_NE(palette, nullptr);
+
+    // The palette version shares its pixels with the source
+    EXPECT_EQ(palette->pixels, source->pixels);
+    EXPECT_TRUE(SDL_HasColorKey(palette.get()));
+
+    const auto mapped_rgba  = to_rgba(mapped.get());
+    const auto palette_rgba = to_rgba(palette.get());
+    const auto source_rgba  = to_rgba(source.get());
+
+    EXPECT_TRUE(same_pixels(mapped_rgba.get(), palette_rgba.get()));
+    EXPECT_FALSE(same_pixels(source_rgba.get(), palette_rgba.get()));
+}
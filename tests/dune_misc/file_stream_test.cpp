@@ -0,0 +1,121 @@
+#include "misc/IFileStream.h"
+#include "misc/OFileStream.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+class file_stream : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path()
+              / (std::string{"dune_file_stream_"} + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+
+    [[nodiscard]] std::vector<uint8_t> contents() const {
+        std::ifstream in{path_, std::ios::binary};
+
+        return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    }
+
+    std::filesystem::path path_;
+};
+
+} // namespace
+
+TEST_F(file_stream, little_endian_layout) {
+    { // Scope
+        OFileStream out;
+        ASSERT_TRUE(out.open(path_));
+
+        out.writeUint8(0x01);
+        out.writeUint16(0x0302);
+        out.writeUint32(0x07060504);
+        out.writeUint64(0x0f0e0d0c0b0a0908);
+        out.writeBool(true);
+        out.writeString("ab");
+        out.writeFloat(1.0f);
+
+        out.close();
+    }
+
+    const std::vector<uint8_t> expected{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+                                        0x0c, 0x0d, 0x0e, 0x0f, 0x01, 0x02, 0x00, 0x00, 0x00, 'a',  'b',
+                                        0x00, 0x00, 0x80, 0x3f};
+
+    EXPECT_EQ(contents(), expected);
+}
+
+TEST_F(file_stream, round_trip_across_buffer_boundaries) {
+    std::vector<uint8_t> block(200 * 1024);
+    std::iota(block.begin(), block.end(), uint8_t{0});
+
+    constexpr auto count = 50000u;
+
+    { // Scope
+        OFileStream out;
+        ASSERT_TRUE(out.open(path_));
+
+        for (auto i = 0u; i < count; ++i) {
+            out.writeUint8(static_cast<uint8_t>(i));
+            out.writeUint32(i);
+            out.writeUint64(static_cast<uint64_t>(i) << 32 | i);
+        }
+
+        out.writeUint8Vector(block);
+        out.writeString(std::string(70000, 'x'));
+        out.writeUint16(0xbeef);
+    }
+
+    EXPECT_EQ(contents().size(), count * 13 + 4 + block.size() + 4 + 70000 + 2);
+
+    IFileStream in;
+    ASSERT_TRUE(in.open(path_));
+
+    for (auto i = 0u; i < count; ++i) {
+        ASSERT_EQ(in.readUint8(), static_cast<uint8_t>(i));
+        ASSERT_EQ(in.readUint32(), i);
+        ASSERT_EQ(in.readUint64(), static_cast<uint64_t>(i) << 32 | i);
+    }
+
+    EXPECT_EQ(in.readUint8Vector(), block);
+    EXPECT_EQ(in.readString(), std::string(70000, 'x'));
+    EXPECT_EQ(in.readUint16(), 0xbeef);
+
+    EXPECT_THROW(in.readUint8(), InputStream::eof);
+}
+
+TEST_F(file_stream, flush_writes_buffered_data) {
+    OFileStream out;
+    ASSERT_TRUE(out.open(path_));
+
+    out.writeUint32(42);
+    out.flush();
+
+    EXPECT_EQ(contents().size(), 4u);
+}
+
+TEST_F(file_stream, truncated_read_throws_eof) {
+    { // Scope
+        OFileStream out;
+        ASSERT_TRUE(out.open(path_));
+
+        out.writeUint16(1);
+    }
+
+    IFileStream in;
+    ASSERT_TRUE(in.open(path_));
+
+    EXPECT_THROW(in.readUint32(), InputStream::eof);
+}
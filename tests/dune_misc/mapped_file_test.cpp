@@ -0,0 +1,57 @@
+#include "misc/MappedFile.h"
+#include "misc/exceptions.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+class mapped_file : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path()
+              / (std::string{"dune_mapped_file_"} + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+
+    void write(const std::vector<uint8_t>& data) const {
+        std::ofstream out{path_, std::ios::binary};
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    std::filesystem::path path_;
+};
+
+} // namespace
+
+TEST_F(mapped_file, content) {
+    std::vector<uint8_t> data(100000);
+    std::iota(data.begin(), data.end(), uint8_t{0});
+    write(data);
+
+    const dune::MappedFile file{path_};
+
+    ASSERT_EQ(file.size(), data.size());
+    EXPECT_TRUE(std::ranges::equal(file.data(), data));
+}
+
+TEST_F(mapped_file, empty) {
+    write({});
+
+    const dune::MappedFile file{path_};
+
+    EXPECT_EQ(file.size(), 0u);
+    EXPECT_FALSE(file.isMapped());
+}
+
+TEST_F(mapped_file, missing) {
+    EXPECT_THROW(dune::MappedFile{path_}, io_error);
+}
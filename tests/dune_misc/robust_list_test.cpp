@@ -0,0 +1,80 @@
+#include "misc/RobustList.h"
+#include "misc/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <vector>
+
+TEST(robust_list, remove_while_iterating) {
+    RobustList<int> list;
+    for (auto i = 0; i < 10; ++i)
+        list.push_back(i);
+
+    auto sum = 0;
+    for (const auto i : list) {
+        sum += i;
+        if (i % 2 == 0)
+            list.remove(i + 1);
+    }
+
+    EXPECT_EQ(sum, 0 + 2 + 4 + 6 + 8);
+    EXPECT_EQ(list.size(), 5);
+}
+
+TEST(robust_list, concurrent_reading) {
+    RobustList<int> list;
+    for (auto i = 0; i < 1000; ++i)
+        list.push_back(i);
+
+    const auto& const_list = list;
+
+    dune::ThreadPool pool{8};
+
+    std::vector<std::future<int>> futures;
+    for (auto task = 0; task < 64; ++task) {
+        futures.emplace_back(pool.submit([&const_list] {
+            const RobustListReadOnlyScope read_only;
+
+            auto sum = 0;
+            for (auto pass = 0; pass < 100; ++pass) {
+                for (const auto i : const_list)
+                    sum += i;
+            }
+            return sum;
+        }));
+    }
+
+    for (auto& f : futures)
+        EXPECT_EQ(f.get(), 100 * 999 * 1000 / 2);
+}
+
+TEST(robust_list, read_only_scope_is_left) {
+    RobustList<int> list;
+    for (auto i = 0; i < 10; ++i)
+        list.push_back(i);
+
+    {
+        const RobustListReadOnlyScope outer;
+        {
+            const RobustListReadOnlyScope inner;
+            EXPECT_TRUE(RobustListReadOnlyScope::isActive());
+        }
+        EXPECT_TRUE(RobustListReadOnlyScope::isActive());
+
+        auto sum = 0;
+        for (const auto i : list)
+            sum += i;
+        EXPECT_EQ(sum, 45);
+    }
+    EXPECT_FALSE(RobustListReadOnlyScope::isActive());
+
+    // Outside of the scope the iterators are registered again and follow removed elements
+    auto sum = 0;
+    for (const auto i : list) {
+        sum += i;
+        if (i % 2 == 0)
+            list.remove(i + 1);
+    }
+    EXPECT_EQ(sum, 0 + 2 + 4 + 6 + 8);
+}
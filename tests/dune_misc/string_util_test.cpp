@@ -89,3 +89,27 @@ TEST(string_util, unsigned_negative) {
     unsigned int value{};
     EXPECT_FALSE(parseString("-1", value));
 }
+
+TEST(string_util, case_insensitive_map) {
+    std::unordered_map<std::string, int, CaseInsensitiveStringHash, CaseInsensitiveStringEqualTo> map;
+    map["Dune.PAK"] = 1;
+
+    EXPECT_TRUE(map.contains("DUNE.PAK"));
+    EXPECT_TRUE(map.contains("dune.pak"));
+    EXPECT_FALSE(map.contains("dune.pa"));
+    EXPECT_EQ(map["DUNE.pak"], 1);
+}
+
+TEST(string_util, utf8_decode) {
+    EXPECT_EQ(utf8Decode(""), U"");
+    EXPECT_EQ(utf8Decode("Harkonnen"), U"Harkonnen");
+    EXPECT_EQ(utf8Decode("\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80"), U"ä€\U0001F600");
+}
+
+TEST(string_util, utf8_decode_invalid) {
+    // Stray continuation byte, truncated sequence, overlong encoding and surrogate
+    EXPECT_EQ(utf8Decode("a\x80z"), U"a\uFFFDz");
+    EXPECT_EQ(utf8Decode("a\xE2\x82"), U"a\uFFFD\uFFFD");
+    EXPECT_EQ(utf8Decode("\xC0\xAF"), U"\uFFFD");
+    EXPECT_EQ(utf8Decode("\xED\xA0\x80"), U"\uFFFD");
+}
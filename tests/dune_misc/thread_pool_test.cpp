@@ -0,0 +1,65 @@
+#include "misc/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(thread_pool, results_in_submission_order) {
+    dune::ThreadPool pool{4};
+
+    std::vector<std::future<int>> futures;
+    for (auto i = 0; i < 1000; ++i)
+        futures.emplace_back(pool.submit([i] { return i * i; }));
+
+    for (auto i = 0; i < 1000; ++i)
+        EXPECT_EQ(futures[i].get(), i * i);
+}
+
+TEST(thread_pool, inline_without_threads) {
+    dune::ThreadPool pool{0};
+
+    EXPECT_EQ(pool.size(), 0u);
+
+    const auto caller = std::this_thread::get_id();
+
+    auto future = pool.submit([] { return std::this_thread::get_id(); });
+
+    EXPECT_EQ(future.get(), caller);
+}
+
+TEST(thread_pool, exception_is_rethrown) {
+    dune::ThreadPool pool{2};
+
+    auto future = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(thread_pool, destructor_finishes_queued_tasks) {
+    std::atomic<int> count{0};
+
+    { // Scope
+        dune::ThreadPool pool{2};
+
+        for (auto i = 0; i < 100; ++i)
+            pool.submit([&count] { ++count; });
+    }
+
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST(thread_pool, move_only_results) {
+    dune::ThreadPool pool;
+
+    EXPECT_GE(pool.size(), 1u);
+
+    auto future = pool.submit([] { return std::make_unique<std::vector<int>>(10, 1); });
+
+    const auto result = future.get();
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(std::accumulate(result->begin(), result->end(), 0), 10);
+}
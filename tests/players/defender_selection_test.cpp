@@ -0,0 +1,70 @@
+#include "players/DefenderSelection.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+
+struct FakeUnit final {
+    ItemID_enum itemID    = Unit_Tank;
+    ATTACKMODE attackMode = GUARD;
+    bool respondable      = true;
+    int target            = -1; ///< the intruder this unit was sent against
+    int orders            = 0;  ///< how often this unit was ordered
+
+    [[nodiscard]] ItemID_enum getItemID() const { return itemID; }
+    [[nodiscard]] ATTACKMODE getAttackMode() const { return attackMode; }
+    [[nodiscard]] bool isRespondable() const { return respondable; }
+    [[nodiscard]] bool hasATarget() const { return target >= 0; }
+};
+
+std::vector<const FakeUnit*> pointers(const std::vector<FakeUnit>& units) {
+    std::vector<const FakeUnit*> result;
+    for (const auto& unit : units)
+        result.push_back(&unit);
+    return result;
+}
+
+} // namespace
+
+TEST(defender_selection, skips_busy_and_non_fighting_units) {
+    EXPECT_TRUE(dune::ai::isFreeDefender(FakeUnit{}));
+    EXPECT_TRUE(dune::ai::isFreeDefender(FakeUnit{.itemID = Unit_Launcher, .attackMode = AMBUSH}));
+
+    EXPECT_FALSE(dune::ai::isFreeDefender(FakeUnit{.attackMode = HUNT}));
+    EXPECT_FALSE(dune::ai::isFreeDefender(FakeUnit{.respondable = false}));
+    EXPECT_FALSE(dune::ai::isFreeDefender(FakeUnit{.target = 0}));
+
+    for (const auto itemID : {Unit_Harvester, Unit_MCV, Unit_Carryall, Unit_Frigate, Unit_Saboteur, Unit_Sandworm})
+        EXPECT_FALSE(dune::ai::isFreeDefender(FakeUnit{.itemID = itemID})) << itemID;
+}
+
+TEST(defender_selection, each_idle_unit_is_ordered_once_per_update) {
+    std::vector<FakeUnit> units{
+        {}, {.itemID = Unit_Harvester}, {.itemID = Unit_Launcher}, {.attackMode = HUNT}, {.target = 99}, {},
+    };
+    const auto unitList = pointers(units);
+
+    // One update with several contacts, e.g. several sandworms close to harvesters. The orders act at once, like the
+    // do-methods of the player on its own units, so the first intruder keeps the free units.
+    constexpr auto numContacts = 4;
+    for (auto intruder = 0; intruder < numContacts; ++intruder) {
+        dune::ai::scrambleFreeDefenders(unitList, [&](const FakeUnit* pUnit) {
+            auto& unit = units[pUnit - units.data()];
+            unit.target = intruder;
+            unit.orders++;
+        });
+    }
+
+    EXPECT_EQ(units[0].orders, 1);
+    EXPECT_EQ(units[0].target, 0);
+    EXPECT_EQ(units[1].orders, 0);
+    EXPECT_EQ(units[2].orders, 1);
+    EXPECT_EQ(units[2].target, 0);
+    EXPECT_EQ(units[3].orders, 0);
+    EXPECT_EQ(units[4].orders, 0);
+    EXPECT_EQ(units[4].target, 99);
+    EXPECT_EQ(units[5].orders, 1);
+    EXPECT_EQ(units[5].target, 0);
+}
@@ -0,0 +1,116 @@
+#ifndef REFERENCE_SCALER_H
+#define REFERENCE_SCALER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/// An 8-bit image whose rows are pitch bytes apart
+struct Image final {
+    int width{};
+    int height{};
+    int pitch{};
+    std::vector<uint8_t> pixels;
+};
+
+// The tiled Scale2x loop as it was in Scaler::doubleTiledSurfaceScale2x() before the kernels were split out
+inline std::vector<uint8_t> reference_scale2x(const Image& image, int tilesX, int tilesY, int destination_pitch) {
+    std::vector<uint8_t> destPixels(static_cast<size_t>(destination_pitch) * image.height * 2);
+
+    const auto* srcPixels   = image.pixels.data();
+    const auto source_pitch = image.pitch;
+    const int tileWidth     = image.width / tilesX;
+    const int tileHeight    = image.height / tilesY;
+
+    for (int j = 0; j < tilesY; ++j) {
+        for (int i = 0; i < tilesX; ++i) {
+            for (int y = 0; y < tileHeight; ++y) {
+                for (int x = 0; x < tileWidth; ++x) {
+                    uint8_t E = srcPixels[(j * tileHeight + y) * source_pitch + (i * tileWidth + x)];
+                    const uint8_t B =
+                        srcPixels[(j * tileHeight + std::max(0, y - 1)) * source_pitch + (i * tileWidth + x)];
+                    const uint8_t H = srcPixels[(j * tileHeight + std::min(tileHeight - 1, y + 1)) * source_pitch
+                                                + (i * tileWidth + x)];
+                    uint8_t D = srcPixels[(j * tileHeight + y) * source_pitch + (i * tileWidth + std::max(0, x - 1))];
+                    uint8_t F = srcPixels[(j * tileHeight + y) * source_pitch
+                                          + (i * tileWidth + std::min(tileWidth - 1, x + 1))];
+
+                    uint8_t E0 = E;
+                    uint8_t E1 = E;
+                    uint8_t E2 = E;
+                    uint8_t E3 = E;
+
+                    if (B != H && D != F) {
+                        E0 = D == B ? D : E;
+                        E1 = B == F ? F : E;
+                        E2 = D == H ? D : E;
+                        E3 = H == F ? F : E;
+                    }
+
+                    destPixels[(j * tileHeight + y) * 2 * destination_pitch + (i * tileWidth + x) * 2]           = E0;
+                    destPixels[(j * tileHeight + y) * 2 * destination_pitch + (i * tileWidth + x) * 2 + 1]       = E1;
+                    destPixels[((j * tileHeight + y) * 2 + 1) * destination_pitch + (i * tileWidth + x) * 2]     = E2;
+                    destPixels[((j * tileHeight + y) * 2 + 1) * destination_pitch + (i * tileWidth + x) * 2 + 1] = E3;
+                }
+            }
+        }
+    }
+
+    return destPixels;
+}
+
+// The tiled Scale3x loop as it was in Scaler::tripleTiledSurfaceScale3x() before the kernels were split out
+inline std::vector<uint8_t> reference_scale3x(const Image& image, int tilesX, int tilesY, int destination_pitch) {
+    std::vector<uint8_t> destination(static_cast<size_t>(destination_pitch) * image.height * 3);
+
+    const auto* source      = image.pixels.data();
+    const auto source_pitch = image.pitch;
+    const int tileWidth     = image.width / tilesX;
+    const int tileHeight    = image.height / tilesY;
+
+    for (int j = 0; j < tilesY; ++j) {
+        for (int i = 0; i < tilesX; ++i) {
+            for (int y = 0; y < tileHeight; ++y) {
+                for (int x = 0; x < tileWidth; ++x) {
+                    const auto up    = j * tileHeight + std::max(0, y - 1);
+                    const auto mid   = j * tileHeight + y;
+                    const auto down  = j * tileHeight + std::min(tileHeight - 1, y + 1);
+                    const auto left  = i * tileWidth + std::max(0, x - 1);
+                    const auto cx    = i * tileWidth + x;
+                    const auto right = i * tileWidth + std::min(tileWidth - 1, x + 1);
+
+                    const uint8_t A = source[up * source_pitch + left];
+                    const uint8_t B = source[up * source_pitch + cx];
+                    const uint8_t C = source[up * source_pitch + right];
+                    const uint8_t D = source[mid * source_pitch + left];
+                    const uint8_t E = source[mid * source_pitch + cx];
+                    const uint8_t F = source[mid * source_pitch + right];
+                    const uint8_t G = source[down * source_pitch + left];
+                    const uint8_t H = source[down * source_pitch + cx];
+                    const uint8_t I = source[down * source_pitch + right];
+
+                    uint8_t out[9] = {E, E, E, E, E, E, E, E, E};
+
+                    if (B != H && D != F) {
+                        out[0] = D == B ? D : E;
+                        out[1] = (D == B && E != C) || (B == F && E != A) ? B : E;
+                        out[2] = B == F ? F : E;
+                        out[3] = (D == B && E != G) || (D == H && E != A) ? D : E;
+                        out[4] = E;
+                        out[5] = (B == F && E != I) || (H == F && E != C) ? F : E;
+                        out[6] = D == H ? D : E;
+                        out[7] = (D == H && E != I) || (H == F && E != G) ? H : E;
+                        out[8] = H == F ? F : E;
+                    }
+
+                    for (auto k = 0; k < 9; ++k)
+                        destination[(mid * 3 + k / 3) * destination_pitch + cx * 3 + k % 3] = out[k];
+                }
+            }
+        }
+    }
+
+    return destination;
+}
+
+#endif // REFERENCE_SCALER_H
@@ -0,0 +1,102 @@
+#include "reference_scaler.h"
+
+#include "misc/scaler_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+Image random_image(std::mt19937& rng, int width, int height, int colors) {
+    std::uniform_int_distribution<int> dist{0, colors - 1};
+
+    // Pad the rows so the kernels have to honour the pitch
+    Image image{width, height, width + 7, {}};
+    image.pixels.resize(static_cast<size_t>(image.pitch) * height);
+
+    std::ranges::generate(image.pixels, [&] { return static_cast<uint8_t>(dist(rng)); });
+
+    return image;
+}
+
+template<typename Kernel>
+std::vector<uint8_t> run_kernel(Kernel&& kernel, const Image& image, int tilesX, int tilesY, int factor,
+                                int destination_pitch) {
+    std::vector<uint8_t> destination(static_cast<size_t>(destination_pitch) * image.height * factor);
+
+    const int tileWidth  = image.width / tilesX;
+    const int tileHeight = image.height / tilesY;
+
+    for (int j = 0; j < tilesY; ++j) {
+        for (int i = 0; i < tilesX; ++i) {
+            kernel(image.pixels.data() + j * tileHeight * image.pitch + i * tileWidth, image.pitch,
+                   destination.data() + j * tileHeight * factor * destination_pitch + i * tileWidth * factor,
+                   destination_pitch, tileWidth, tileHeight);
+        }
+    }
+
+    return destination;
+}
+
+} // namespace
+
+TEST(scaler_kernels, scale2x_matches_reference) {
+    std::mt19937 rng{2024};
+
+    for (auto colors : {2, 3, 16, 256}) {
+        for (auto width = 1; width <= 70; ++width) {
+            for (auto height : {1, 2, 3, 8}) {
+                for (auto tilesX : {1, 2, 3}) {
+                    const auto image = random_image(rng, width, height, colors);
+                    const auto pitch = width * 2 + 5;
+
+                    const auto expected = reference_scale2x(image, tilesX, 1, pitch);
+
+                    EXPECT_EQ(run_kernel(dune::scaler::scale2x_scalar, image, tilesX, 1, 2, pitch), expected)
+                        << "scalar " << width << "x" << height << " tiles " << tilesX << " colors " << colors;
+                    EXPECT_EQ(run_kernel(dune::scaler::scale2x, image, tilesX, 1, 2, pitch), expected)
+                        << dune::scaler::simd_name() << " " << width << "x" << height << " tiles " << tilesX
+                        << " colors " << colors;
+                }
+            }
+        }
+    }
+}
+
+TEST(scaler_kernels, scale3x_matches_reference) {
+    std::mt19937 rng{4711};
+
+    for (auto colors : {2, 3, 16, 256}) {
+        for (auto width = 1; width <= 70; ++width) {
+            for (auto height : {1, 2, 3, 8}) {
+                for (auto tilesX : {1, 2, 3}) {
+                    const auto image = random_image(rng, width, height, colors);
+                    const auto pitch = width * 3 + 5;
+
+                    const auto expected = reference_scale3x(image, tilesX, 1, pitch);
+
+                    EXPECT_EQ(run_kernel(dune::scaler::scale3x_scalar, image, tilesX, 1, 3, pitch), expected)
+                        << "scalar " << width << "x" << height << " tiles " << tilesX << " colors " << colors;
+                    EXPECT_EQ(run_kernel(dune::scaler::scale3x, image, tilesX, 1, 3, pitch), expected)
+                        << dune::scaler::simd_name() << " " << width << "x" << height << " tiles " << tilesX
+                        << " colors " << colors;
+                }
+            }
+        }
+    }
+}
+
+TEST(scaler_kernels, vertical_tiles_do_not_bleed) {
+    std::mt19937 rng{42};
+
+    const auto image = random_image(rng, 48, 36, 3);
+
+    for (auto tilesY : {2, 3, 4, 6}) {
+        EXPECT_EQ(run_kernel(dune::scaler::scale2x, image, 2, tilesY, 2, 96), reference_scale2x(image, 2, tilesY, 96));
+        EXPECT_EQ(run_kernel(dune::scaler::scale3x, image, 2, tilesY, 3, 144),
+                  reference_scale3x(image, 2, tilesY, 144));
+    }
+}
@@ -0,0 +1,106 @@
+#include "reference_scaler.h"
+
+#include "FileClasses/LoadSavePNG.h"
+#include "FileClasses/Pakfile.h"
+#include "misc/Scaler.h"
+#include "misc/scaler_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::pair<std::string, sdl2::surface_ptr>> load_sprites(const std::filesystem::path& pak_path) {
+    std::vector<std::pair<std::string, sdl2::surface_ptr>> sprites;
+
+    const Pakfile pak{pak_path};
+
+    for (auto i = 0; i < pak.getNumFiles(); ++i) {
+        const auto& name = pak.getFilename(i);
+
+        if (!name.ends_with(".png"))
+            continue;
+
+        auto surface = LoadPNG_RW(pak.openFile(i).get());
+        if (surface && surface->format->BitsPerPixel == 8)
+            sprites.emplace_back(name, std::move(surface));
+    }
+
+    return sprites;
+}
+
+std::vector<uint8_t> surface_pixels(SDL_Surface* surface) {
+    std::vector<uint8_t> pixels(static_cast<size_t>(surface->w) * surface->h);
+
+    const sdl2::surface_lock lock{surface};
+
+    for (auto y = 0; y < surface->h; ++y) {
+        const auto* const row = static_cast<const uint8_t*>(lock.pixels()) + static_cast<ptrdiff_t>(y) * lock.pitch();
+        std::copy_n(row, surface->w, pixels.begin() + static_cast<ptrdiff_t>(y) * surface->w);
+    }
+
+    return pixels;
+}
+
+template<typename Kernel>
+std::vector<uint8_t> scale_scalar(Kernel&& kernel, SDL_Surface* surface, int factor) {
+    const auto source = surface_pixels(surface);
+
+    std::vector<uint8_t> destination(static_cast<size_t>(surface->w) * surface->h * factor * factor);
+
+    kernel(source.data(), surface->w, destination.data(), surface->w * factor, surface->w, surface->h);
+
+    return destination;
+}
+
+Image surface_image(SDL_Surface* surface) {
+    return {surface->w, surface->h, surface->w, surface_pixels(surface)};
+}
+
+class ScalerSprites : public testing::TestWithParam<const char*> { };
+
+} // namespace
+
+TEST_P(ScalerSprites, scale2x_and_scale3x_match_scalar) {
+    const auto sprites = load_sprites(GetParam());
+
+    ASSERT_FALSE(sprites.empty());
+
+    for (const auto& [name, surface] : sprites) {
+        const auto doubled = Scaler::doubleSurfaceScale2x(surface.get());
+        ASSERT_NE(doubled, nullptr) << name;
+        EXPECT_EQ(surface_pixels(doubled.get()), scale_scalar(dune::scaler::scale2x_scalar, surface.get(), 2))
+            << name << " (" << dune::scaler::simd_name() << ")";
+
+        const auto tripled = Scaler::tripleSurfaceScale3x(surface.get());
+        ASSERT_NE(tripled, nullptr) << name;
+        EXPECT_EQ(surface_pixels(tripled.get()), scale_scalar(dune::scaler::scale3x_scalar, surface.get(), 3))
+            << name << " (" << dune::scaler::simd_name() << ")";
+    }
+}
+
+TEST_P(ScalerSprites, scale2x_and_scale3x_match_original_scaler) {
+    const auto sprites = load_sprites(GetParam());
+
+    ASSERT_FALSE(sprites.empty());
+
+    for (const auto& [name, surface] : sprites) {
+        const auto image = surface_image(surface.get());
+
+        const auto doubled = Scaler::doubleSurfaceScale2x(surface.get());
+        ASSERT_NE(doubled, nullptr) << name;
+        EXPECT_EQ(surface_pixels(doubled.get()), reference_scale2x(image, 1, 1, image.width * 2))
+            << name << " (" << dune::scaler::simd_name() << ")";
+
+        const auto tripled = Scaler::tripleSurfaceScale3x(surface.get());
+        ASSERT_NE(tripled, nullptr) << name;
+        EXPECT_EQ(surface_pixels(tripled.get()), reference_scale3x(image, 1, 1, image.width * 3))
+            << name << " (" << dune::scaler::simd_name() << ")";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Pakfiles, ScalerSprites, testing::Values("LEGACY.PAK", "GFXHD.PAK"));